@@ -0,0 +1,100 @@
+// 기록된 detection log 를 tracker 에 재생하고 프레임별 처리 시간 분포를 출력
+//
+// 사용법: run_replay <detections.bin|detections.csv> [speed] [tracks_out.bin] [trace.json]
+//   speed: 0 = 최대 속도 (기본), 1 = 실시간, 2 = 2 배속 ...
+//   tracks_out.bin: 프레임별 track 상태를 binary log 로 기록 (run_simulation 의 tracks.bin 과 같은 형식)
+//                   ("-" 면 기록하지 않음)
+//   trace.json: stage 별 Chrome trace-event JSON (chrome://tracing / ui.perfetto.dev)
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "replay.hpp"
+
+int main(int argc, char** argv) {
+    using namespace msf;
+
+    if (argc < 2) {
+        std::cerr << "Usage: run_replay <detections.bin|detections.csv> [speed] [tracks_out.bin|-] "
+                     "[trace.json]\n";
+        return 1;
+    }
+
+    const std::string in_path = argv[1];
+    ReplayParams replay_params;
+    if (argc >= 3) {
+        replay_params.speed = std::stod(argv[2]);
+    }
+
+    DetectionLogReader reader;
+    if (!reader.open(in_path)) {
+        std::cerr << "Failed to open detection log: " << in_path << "\n";
+        return 1;
+    }
+
+    BinaryLogWriter track_log;
+    if (argc >= 4 && std::string(argv[3]) != "-" &&
+        !track_log.open(argv[3], LogRecordType::Track, sizeof(TrackRecord))) {
+        std::cerr << "Failed to open track log: " << argv[3] << "\n";
+        return 1;
+    }
+
+    // run_simulation 과 같은 tracker 설정
+    TrackerParams params;
+    params.process_noise_std = 1.0;
+    params.cam_pos_noise_std = 1.0;
+    params.radar_r_noise_std = 1.0;
+    params.radar_angle_noise_std = 0.02;
+    params.radar_vr_noise_std = 0.5;
+    params.max_association_maha_dist = 16.0;
+    params.max_missed = 5;
+    params.min_hits_to_confirm = 3;
+
+    MultiSensorTracker tracker(params);
+    if (argc >= 5) {
+        tracker.stats().enable_trace();
+    }
+
+    std::cout << "Replaying " << in_path << " (" << (reader.is_binary() ? "binary" : "csv")
+              << ", speed=";
+    if (replay_params.speed > 0.0) {
+        std::cout << replay_params.speed << "x)\n";
+    } else {
+        std::cout << "max)\n";
+    }
+
+    ReplayStats stats;
+    if (track_log.is_open()) {
+        stats = replay(reader, tracker, replay_params,
+                       [&](double t, const std::vector<TrackState>& tracks) {
+                           for (const auto& tr : tracks) {
+                               track_log.append(to_record(tr, t));
+                           }
+                       });
+        if (!track_log.close()) {
+            std::cerr << "Failed to write track log.\n";
+            return 1;
+        }
+    } else {
+        stats = replay(reader, tracker, replay_params);
+    }
+
+    std::cout << "frames=" << stats.frames << " detections=" << stats.detections
+              << " wall=" << std::fixed << std::setprecision(3) << stats.wall_s << "s\n";
+    std::cout << "frame latency [ms]: p50=" << stats.latency_percentile(0.50)
+              << " p90=" << stats.latency_percentile(0.90)
+              << " p99=" << stats.latency_percentile(0.99)
+              << " max=" << stats.latency_percentile(1.0) << "\n";
+    std::cout << "\n" << tracker.stats().summary();
+
+    if (argc >= 5) {
+        if (!tracker.stats().write_trace(argv[4])) {
+            std::cerr << "Failed to write trace: " << argv[4] << "\n";
+            return 1;
+        }
+        std::cout << "trace written to " << argv[4] << "\n";
+    }
+
+    return 0;
+}
@@ -1,10 +1,13 @@
+#include <cstdio>
 #include <iostream>
 #include <fstream>
 #include <string>
 
 #include "tracker.hpp"
+#include "binary_log.hpp"
 #include "highway_scenario.hpp"
 #include "sensor_simulator.hpp"
+#include "track_metrics.hpp"
 
 int main(int argc, char** argv) {
     using namespace msf;
@@ -31,9 +34,21 @@ int main(int argc, char** argv) {
         }
     }
 
+    // 출력 형식: bin (기본, ground_truth.bin / tracks.bin / detections.bin), csv, both
+    std::string format = "bin";
+    if (argc >= 5) {
+        format = argv[4];
+    }
+    if (format != "bin" && format != "csv" && format != "both") {
+        std::cerr << "Unknown output format: " << format << " (bin, csv, both)\n";
+        return 1;
+    }
+    const bool write_csv = (format == "csv" || format == "both");
+    const bool write_bin = (format == "bin" || format == "both");
+
     std::cout << "Running simulation: objects=" << num_objects
               << ", steps=" << num_steps << ", dt=" << dt << "s\n";
-    std::cout << "Output directory: " << out_dir << "\n";
+    std::cout << "Output directory: " << out_dir << " (" << format << ")\n";
 
     HighwayScenario scenario(num_objects, dt);
 
@@ -58,18 +73,46 @@ int main(int argc, char** argv) {
 
     MultiSensorTracker tracker(params);
 
-    std::ofstream gt_file(out_dir + "ground_truth.csv");
-    std::ofstream track_file(out_dir + "tracks.csv");
-    std::ofstream det_file(out_dir + "detections.csv");
+    // 매 프레임 truth 와 tracker 출력으로 GOSPA / OSPA 등 품질 지표 누적
+    TrackMetrics metrics(TrackMetricsParams{/*cutoff=*/5.0, /*order=*/2.0});
+
+    std::ofstream gt_file;
+    std::ofstream track_file;
+    std::ofstream det_file;
+    std::ofstream metrics_file;
+    if (write_csv) {
+        gt_file.open(out_dir + "ground_truth.csv");
+        track_file.open(out_dir + "tracks.csv");
+        det_file.open(out_dir + "detections.csv");
+        metrics_file.open(out_dir + "metrics.csv");
+
+        if (!gt_file || !track_file || !det_file || !metrics_file) {
+            std::cerr << "Failed to open output CSV files. Check output directory." << std::endl;
+            return 1;
+        }
+
+        gt_file << "time,obj_id,x,y,vx,vy\n";
+        track_file << "time,track_id,x,y,vx,vy,confirmed,missed\n";
+        det_file << "time,sensor,x,y,z2\n";
+        metrics_file << "time,truths,tracks,matched,gospa,gospa_loc,gospa_missed,gospa_false,"
+                        "ospa,id_switches\n";
+    }
 
-    if (!gt_file || !track_file || !det_file) {
-        std::cerr << "Failed to open output CSV files. Check output directory." << std::endl;
-        return 1;
+    BinaryLogWriter gt_log;
+    BinaryLogWriter track_log;
+    BinaryLogWriter det_log;
+    if (write_bin) {
+        if (!gt_log.open(out_dir + "ground_truth.bin", LogRecordType::GroundTruth,
+                         sizeof(GroundTruthRecord)) ||
+            !track_log.open(out_dir + "tracks.bin", LogRecordType::Track, sizeof(TrackRecord)) ||
+            !det_log.open(out_dir + "detections.bin", LogRecordType::Detection,
+                          sizeof(DetectionRecord))) {
+            std::cerr << "Failed to open output log files. Check output directory." << std::endl;
+            return 1;
+        }
     }
 
-    gt_file << "time,obj_id,x,y,vx,vy\n";
-    track_file << "time,track_id,x,y,vx,vy,confirmed,missed\n";
-    det_file << "time,sensor,x,y,z2\n";
+    DetectionBatch detections;
 
     for (int step = 0; step < num_steps; ++step) {
         scenario.step();
@@ -79,28 +122,45 @@ int main(int argc, char** argv) {
 
         // ground truth 로그
         for (const auto& obj : objs) {
-            gt_file << t << "," << obj.id << ","
-                    << obj.x << "," << obj.y << ","
-                    << obj.vx << "," << obj.vy << "\n";
+            if (write_csv) {
+                gt_file << t << "," << obj.id << ","
+                        << obj.x << "," << obj.y << ","
+                        << obj.vx << "," << obj.vy << "\n";
+            }
+            if (write_bin) {
+                GroundTruthRecord r{};
+                r.timestamp = t;
+                r.obj_id = obj.id;
+                r.x[0] = obj.x;
+                r.x[1] = obj.y;
+                r.x[2] = obj.vx;
+                r.x[3] = obj.vy;
+                gt_log.append(r);
+            }
         }
 
-        auto detections = sensor_sim.generate(objs, t);
+        sensor_sim.generate(objs, t, detections);
 
         // detection 로그
-        for (const auto& d : detections) {
-            det_file << t << ",";
-            det_file << (d.sensor == SensorType::Camera ? "camera" : "radar") << ",";
-            if (d.z.size() >= 2) {
-                det_file << d.z(0) << "," << d.z(1) << ",";
-            } else {
-                det_file << "0,0,";
+        for (size_t i = 0; i < detections.size(); ++i) {
+            if (write_csv) {
+                det_file << t << ",";
+                det_file << (detections.sensor(i) == SensorType::Camera ? "camera" : "radar") << ",";
+                if (detections.dim(i) >= 2) {
+                    det_file << detections.z(i, 0) << "," << detections.z(i, 1) << ",";
+                } else {
+                    det_file << "0,0,";
+                }
+                if (detections.dim(i) >= 3) {
+                    det_file << detections.z(i, 2);
+                } else {
+                    det_file << "0";
+                }
+                det_file << "\n";
             }
-            if (d.z.size() >= 3) {
-                det_file << d.z(2);
-            } else {
-                det_file << "0";
+            if (write_bin) {
+                det_log.append(to_record(detections, i));
             }
-            det_file << "\n";
         }
 
         tracker.predict(t);
@@ -108,15 +168,42 @@ int main(int argc, char** argv) {
 
         const auto& tracks = tracker.get_tracks();
         for (const auto& tr : tracks) {
-            track_file << t << "," << tr.id << ","
-                       << tr.x(0) << "," << tr.x(1) << ","
-                       << tr.x(2) << "," << tr.x(3) << ","
-                       << (tr.confirmed ? 1 : 0) << ","
-                       << tr.missed << "\n";
+            if (write_csv) {
+                track_file << t << "," << tr.id << ","
+                           << tr.x(0) << "," << tr.x(1) << ","
+                           << tr.x(2) << "," << tr.x(3) << ","
+                           << (tr.confirmed ? 1 : 0) << ","
+                           << tr.missed << "\n";
+            }
+            if (write_bin) {
+                track_log.append(to_record(tr, t));
+            }
+        }
+
+        const FrameMetrics& fm = metrics.add_frame(t, objs, tracks);
+        if (write_csv) {
+            metrics_file << t << "," << fm.truths << "," << fm.tracks << "," << fm.matched << ","
+                         << fm.gospa << "," << fm.gospa_loc << "," << fm.gospa_missed << ","
+                         << fm.gospa_false << "," << fm.ospa << "," << fm.id_switches << "\n";
         }
     }
 
+    if (write_bin && !(gt_log.close() & track_log.close() & det_log.close())) {
+        std::cerr << "Failed to write output log files." << std::endl;
+        return 1;
+    }
+
     std::cout << "Simulation finished.\n";
+
+    const MetricsSummary ms = metrics.summary();
+    std::printf("GOSPA %.3f  OSPA %.3f (c=%.1f m, p=%.0f)\n", ms.gospa, ms.ospa,
+                metrics.params().cutoff, metrics.params().order);
+    std::printf("RMSE pos %.3f m, vel %.3f m/s  miss %.2f%%  false tracks %.2f/frame (%.2f%%)\n",
+                ms.pos_rmse, ms.vel_rmse, 100.0 * ms.miss_rate, ms.false_tracks,
+                100.0 * ms.false_track_rate);
+    std::printf("ID switches %llu  confirmed %d/%d objects, latency mean %.2f s max %.2f s\n",
+                static_cast<unsigned long long>(ms.id_switches), ms.truths_confirmed,
+                ms.truths_seen, ms.confirm_latency, ms.confirm_latency_max);
     std::cout << "Generated files in: " << out_dir << "\n";
 
     return 0;
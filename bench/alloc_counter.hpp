@@ -0,0 +1,57 @@
+#pragma once
+
+// bench 공용 heap 할당 계수기
+//
+// 전역 operator new / delete (정렬 overload 포함) 를 바꿔서 g_counting 이 켜진 동안의
+// 할당 횟수를 g_allocs 에 센다 (스레드 구분 없이 전체). 그중 정렬 할당
+// (AlignedAllocator 를 쓰는 AlignedDoubles / RadarPredictionSoA / SoA 저장소 등) 은
+// g_aligned_allocs 에도 따로 센다. 전역 operator 정의가 들어 있으므로
+// 실행 파일마다 main 이 있는 .cpp 하나에서만 include 한다.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<std::uint64_t> g_allocs{0};
+std::atomic<std::uint64_t> g_aligned_allocs{0};
+
+} // namespace
+
+void* operator new(std::size_t n) {
+    if (g_counting.load(std::memory_order_relaxed)) {
+        g_allocs.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t n, std::align_val_t al) {
+    if (g_counting.load(std::memory_order_relaxed)) {
+        g_allocs.fetch_add(1, std::memory_order_relaxed);
+        g_aligned_allocs.fetch_add(1, std::memory_order_relaxed);
+    }
+    // aligned_alloc 은 크기가 정렬의 배수여야 한다
+    const std::size_t a = static_cast<std::size_t>(al);
+    const std::size_t bytes = n == 0 ? a : (n + a - 1) / a * a;
+    if (void* p = std::aligned_alloc(a, bytes)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t n) { return operator new(n); }
+void* operator new[](std::size_t n, std::align_val_t al) { return operator new(n, al); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
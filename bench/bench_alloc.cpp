@@ -0,0 +1,204 @@
+// 프레임당 heap 할당 횟수 측정
+//
+// 전역 operator new (정렬 overload 포함, bench/alloc_counter.hpp) 를 바꿔서 predict + update
+// 구간의 할당 횟수를 센다. warmup 프레임 이후 (track_capacity 를 넉넉히 잡은 상태) 에는 프레임 arena 와
+// 미리 확보한 track 저장소만 쓰므로 할당이 0 이어야 하고, 아니면 0 이 아닌 값으로 종료한다.
+//
+// 계수기 자체의 확인: mht-growth 는 track_capacity 를 작게 잡고 첫 프레임부터 재므로
+// MHT leaf 수가 capacity 를 넘으면서 정렬 버퍼 (radar_px_ 등) 가 늘어나야 한다.
+// 정렬 할당이 하나도 안 잡히면 실패로 본다.
+//
+// 사용법: bench_alloc [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "tracker.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+struct Config {
+    const char* name;
+    bool spatial_gating;
+    msf::AssociationMethod method;
+    msf::TrackStorage storage;
+    int num_threads;
+    int radar_delay;   // > 0 이면 radar 를 늦게 넣고 OOSM 사용
+    msf::RadarFilter radar_filter;
+    msf::MotionModel motion_model;
+    msf::FusionMode fusion_mode;
+    msf::DetectionUpdate detection_update{msf::DetectionUpdate::Single};
+    int track_capacity{-1};   // < 0 이면 4 * num_objects + 256
+    bool expect_growth{false};   // warmup 없이 재고, 정렬 할당이 있어야 통과
+};
+
+struct RunResult {
+    std::uint64_t allocs{0};
+    std::uint64_t aligned_allocs{0};
+    std::uint64_t worst_frame_allocs{0};
+    double frame_ms{0.0};
+    double max_frame_ms{0.0};
+    std::size_t arena_capacity{0};
+    std::size_t arena_high_water{0};
+    std::uint64_t arena_overflows{0};
+};
+
+RunResult run(const Config& cfg, int num_objects, int frames) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.2);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.use_spatial_gating = cfg.spatial_gating;
+    params.association_method = cfg.method;
+    params.track_storage = cfg.storage;
+    params.num_threads = cfg.num_threads;
+    params.radar_filter = cfg.radar_filter;
+    params.motion_model = cfg.motion_model;
+    params.fusion_mode = cfg.fusion_mode;
+    params.detection_update = cfg.detection_update;
+    params.oosm_history_size = cfg.radar_delay > 0 ? 2 * cfg.radar_delay + 4 : 0;
+    params.track_capacity = cfg.track_capacity >= 0 ? cfg.track_capacity : 4 * num_objects + 256;
+    params.frame_arena_bytes = 0;   // arena 가 스스로 크기를 맞추는지 확인
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch all, camera, radar;
+    std::deque<DetectionBatch> radar_queue;
+
+    RunResult result;
+    const int warmup = cfg.expect_growth ? 0 : 30;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, all);
+
+        const DetectionBatch* late = nullptr;
+        if (cfg.radar_delay > 0) {
+            camera.clear();
+            radar.clear();
+            for (size_t j = 0; j < all.size(); ++j) {
+                (all.sensor(j) == SensorType::Camera ? camera : radar).push_back(all.at(j));
+            }
+            radar_queue.push_back(radar);
+            if (static_cast<int>(radar_queue.size()) > cfg.radar_delay) {
+                late = &radar_queue.front();
+            }
+        }
+
+        const bool measure = step >= warmup;
+        g_allocs.store(0);
+        g_aligned_allocs.store(0);
+        g_counting.store(measure);
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        if (cfg.radar_delay > 0) {
+            tracker.update(camera);
+            if (late) tracker.update(*late);
+        } else {
+            tracker.update(all);
+        }
+        auto t1 = Clock::now();
+        g_counting.store(false);
+
+        if (late) {
+            radar_queue.pop_front();
+        }
+        if (measure) {
+            const std::uint64_t n = g_allocs.load();
+            const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.allocs += n;
+            result.aligned_allocs += g_aligned_allocs.load();
+            result.worst_frame_allocs = std::max(result.worst_frame_allocs, n);
+            result.frame_ms += ms;
+            result.max_frame_ms = std::max(result.max_frame_ms, ms);
+        }
+    }
+    result.frame_ms /= frames;
+    result.arena_capacity = tracker.frame_arena().capacity();
+    result.arena_high_water = tracker.frame_arena().high_water();
+    result.arena_overflows = tracker.frame_arena().overflow_count();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::AssociationMethod;
+    using msf::TrackStorage;
+    using msf::RadarFilter;
+    using msf::MotionModel;
+    using msf::FusionMode;
+    using msf::DetectionUpdate;
+
+    int num_objects = 200;
+    int frames = 200;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    const Config configs[] = {
+        {"grid-greedy",   true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-optimal",  true,  AssociationMethod::Optimal, TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"dense-greedy",  false, AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"dense-optimal", false, AssociationMethod::Optimal, TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-soa-mt",   true,  AssociationMethod::Greedy,  TrackStorage::SoA, 4, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-oosm",     true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 2, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-ukf",      true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::UKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-ukf-oosm", true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 2, RadarFilter::UKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-imm",      true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::IMM, FusionMode::Joint},
+        {"grid-imm-mt",   true,  AssociationMethod::Greedy,  TrackStorage::SoA, 4, 0, RadarFilter::EKF, MotionModel::IMM, FusionMode::Joint},
+        {"grid-imm-oosm", true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 2, RadarFilter::EKF, MotionModel::IMM, FusionMode::Joint},
+        {"grid-seq",      true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Sequential},
+        {"grid-seq-oosm", true,  AssociationMethod::Optimal, TrackStorage::AoS, 1, 2, RadarFilter::EKF, MotionModel::CV,  FusionMode::Sequential},
+        {"grid-info",     true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint, DetectionUpdate::Information},
+        {"dense-info-mt", false, AssociationMethod::Optimal, TrackStorage::SoA, 4, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint, DetectionUpdate::Information},
+        {"grid-info-imm", true,  AssociationMethod::Greedy,  TrackStorage::AoS, 1, 2, RadarFilter::EKF, MotionModel::IMM, FusionMode::Sequential, DetectionUpdate::Information},
+        {"grid-jpda",     true,  AssociationMethod::JPDA,    TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"dense-jpda-mt", false, AssociationMethod::JPDA,    TrackStorage::SoA, 4, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-jpda-imm", true,  AssociationMethod::JPDA,    TrackStorage::AoS, 1, 2, RadarFilter::UKF, MotionModel::IMM, FusionMode::Joint},
+        {"grid-mht",      true,  AssociationMethod::MHT,     TrackStorage::AoS, 1, 0, RadarFilter::EKF, MotionModel::CV,  FusionMode::Joint},
+        {"grid-mht-mt",   true,  AssociationMethod::MHT,     TrackStorage::AoS, 4, 0, RadarFilter::UKF, MotionModel::CV,  FusionMode::Sequential},
+        {"mht-growth",    true,  AssociationMethod::MHT,     TrackStorage::AoS, 1, 0, RadarFilter::UKF, MotionModel::CV,  FusionMode::Joint, DetectionUpdate::Single, 16, true},
+    };
+
+    std::printf("objects=%d frames=%d (after 30 warmup frames)\n", num_objects, frames);
+    std::printf("%-14s %10s %10s %12s %10s %10s %12s %12s %10s\n",
+                "config", "allocs", "aligned", "worst/frame", "ms/frame", "max ms",
+                "arena [KB]", "peak [KB]", "overflows");
+
+    bool ok = true;
+    for (const auto& cfg : configs) {
+        const RunResult r = run(cfg, num_objects, frames);
+        std::printf("%-14s %10llu %10llu %12llu %10.3f %10.3f %12.1f %12.1f %10llu\n", cfg.name,
+                    static_cast<unsigned long long>(r.allocs),
+                    static_cast<unsigned long long>(r.aligned_allocs),
+                    static_cast<unsigned long long>(r.worst_frame_allocs),
+                    r.frame_ms, r.max_frame_ms,
+                    r.arena_capacity / 1024.0, r.arena_high_water / 1024.0,
+                    static_cast<unsigned long long>(r.arena_overflows));
+        if (cfg.expect_growth) {
+            if (r.aligned_allocs == 0) {
+                std::printf("FAIL: %s: aligned buffer growth was not counted\n", cfg.name);
+                ok = false;
+            }
+            continue;
+        }
+        ok = ok && r.allocs == 0;
+    }
+
+    if (!ok) {
+        std::printf("FAIL: heap allocation in steady-state frames\n");
+        return 1;
+    }
+    return 0;
+}
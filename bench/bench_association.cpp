@@ -0,0 +1,146 @@
+// associate_greedy vs associate_optimal 마이크로벤치마크
+//
+// 고속도로(3차선) 위에 촘촘히 배치한 track 과, 그 주변의 noisy detection + clutter 로
+// Mahalanobis 비용 행렬을 만든 뒤 latency 와 전체 할당 비용을 비교한다.
+//
+// 사용법: bench_association [n_tracks ...]   (detection 수 = 2 * n_tracks)
+//   기본값: 100 500 1000 2000
+
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "data_association.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Problem {
+    int n_tracks{0};
+    int n_dets{0};
+    Eigen::MatrixXd dense;                 // gating 밖은 inf
+    std::vector<msf::GateCandidate> sparse;
+};
+
+Problem make_problem(int n_tracks, int n_dets, double gate, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> lane_dist(-1, 1);
+    std::normal_distribution<double> lane_noise(0.0, 0.3);
+    std::normal_distribution<double> meas_noise(0.0, 1.0);
+    std::uniform_real_distribution<double> uni01(0.0, 1.0);
+
+    // 차량 간격 ~8 m, 3 차선 → 게이트가 서로 겹치는 혼잡 상황
+    const double road_length = n_tracks * 8.0 / 3.0;
+    std::uniform_real_distribution<double> x_dist(0.0, road_length);
+
+    std::vector<double> tx(n_tracks), ty(n_tracks);
+    for (int i = 0; i < n_tracks; ++i) {
+        tx[i] = x_dist(rng);
+        ty[i] = 3.5 * lane_dist(rng) + lane_noise(rng);
+    }
+
+    std::vector<double> dx, dy;
+    dx.reserve(n_dets);
+    dy.reserve(n_dets);
+    for (int i = 0; i < n_tracks && static_cast<int>(dx.size()) < n_dets; ++i) {
+        if (uni01(rng) < 0.9) {
+            dx.push_back(tx[i] + meas_noise(rng));
+            dy.push_back(ty[i] + meas_noise(rng));
+        }
+    }
+    std::uniform_real_distribution<double> clutter_y(-6.0, 6.0);
+    while (static_cast<int>(dx.size()) < n_dets) {
+        dx.push_back(x_dist(rng));
+        dy.push_back(clutter_y(rng));
+    }
+
+    // S = P_pos + R ~ diag(2, 2) 로 가정한 Mahalanobis 거리 제곱
+    const double s_inv = 1.0 / 2.0;
+
+    Problem prob;
+    prob.n_tracks = n_tracks;
+    prob.n_dets = n_dets;
+    prob.dense.setConstant(n_tracks, n_dets, std::numeric_limits<double>::infinity());
+    for (int i = 0; i < n_tracks; ++i) {
+        for (int j = 0; j < n_dets; ++j) {
+            const double ex = dx[j] - tx[i];
+            const double ey = dy[j] - ty[i];
+            const double d2 = (ex * ex + ey * ey) * s_inv;
+            if (d2 <= gate) {
+                prob.dense(i, j) = d2;
+                prob.sparse.push_back({i, j, d2});
+            }
+        }
+    }
+    return prob;
+}
+
+// sum(매칭 cost) + max_cost * (미할당 track 수)
+double total_cost(const Problem& prob, const msf::AssociationResult& r, double max_cost) {
+    double sum = 0.0;
+    for (int i = 0; i < prob.n_tracks; ++i) {
+        const int j = r.track_assignment[i];
+        sum += (j >= 0) ? prob.dense(i, j) : max_cost;
+    }
+    return sum;
+}
+
+template <typename Fn>
+double time_ms(int reps, Fn&& fn) {
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; ++r) {
+        fn();
+    }
+    auto t1 = Clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / reps;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace msf;
+
+    std::vector<int> sizes = {100, 500, 1000, 2000};
+    if (argc >= 2) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) {
+            sizes.push_back(std::stoi(argv[i]));
+        }
+    }
+
+    const double gate = 9.21;
+
+    std::printf("%6s %6s %8s | %12s %12s %12s | %12s %12s %8s\n",
+                "tracks", "dets", "pairs",
+                "greedy-d[ms]", "greedy-s[ms]", "optimal[ms]",
+                "greedy cost", "optimal cost", "gain");
+
+    for (int n : sizes) {
+        Problem prob = make_problem(n, 2 * n, gate, 7u + n);
+        const int reps = n <= 500 ? 20 : 3;
+
+        AssociationResult greedy_dense, greedy_sparse, optimal;
+        const double t_gd = time_ms(reps, [&] { greedy_dense = associate_greedy(prob.dense, gate); });
+        const double t_gs = time_ms(reps, [&] {
+            greedy_sparse = associate_greedy(prob.sparse, prob.n_tracks, prob.n_dets, gate);
+        });
+        const double t_op = time_ms(reps, [&] {
+            optimal = associate_optimal(prob.sparse, prob.n_tracks, prob.n_dets, gate);
+        });
+
+        const double c_greedy = total_cost(prob, greedy_sparse, gate);
+        const double c_opt = total_cost(prob, optimal, gate);
+
+        std::printf("%6d %6d %8zu | %12.3f %12.3f %12.3f | %12.2f %12.2f %7.2f%%\n",
+                    prob.n_tracks, prob.n_dets, prob.sparse.size(),
+                    t_gd, t_gs, t_op,
+                    c_greedy, c_opt, 100.0 * (c_greedy - c_opt) / c_greedy);
+        (void)greedy_dense;
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+// MonteCarloRunner 확인과 처리량
+//
+// 작은 TrackerParams 격자를 스레드 수 1 / 2 / 4 로 돌려
+//   - run 별 정확도 지표 (pos err, miss rate, false tracks, GOSPA, ID switch, births) 가 bit 단위로 같은지
+//   - 같은 seed 에서 config 만 바꾸면 지표가 달라지는지 (설정이 실제로 적용되는지)
+// 를 확인하고 runs/s 를 출력한다. 어긋나면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_batch [seeds] [objects] [steps]
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "monte_carlo.hpp"
+
+namespace {
+
+bool same_accuracy(const msf::RunMetrics& a, const msf::RunMetrics& b) {
+    return a.config == b.config && a.seed == b.seed && a.pos_err == b.pos_err &&
+           a.miss_rate == b.miss_rate && a.false_tracks == b.false_tracks &&
+           a.gospa == b.gospa && a.id_switches == b.id_switches &&
+           a.confirm_latency == b.confirm_latency && a.births == b.births;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace msf;
+
+    int num_seeds = 6;
+    int num_objects = 60;
+    int num_steps = 100;
+    if (argc >= 2) num_seeds = std::stoi(argv[1]);
+    if (argc >= 3) num_objects = std::stoi(argv[2]);
+    if (argc >= 4) num_steps = std::stoi(argv[3]);
+
+    MonteCarloScenario scenario;
+    scenario.traffic.num_objects = num_objects;
+    scenario.num_steps = num_steps;
+
+    std::vector<TrackerParams> configs;
+    for (int min_hits : {2, 4}) {
+        for (double gate : {9.21, 16.0}) {
+            TrackerParams p;
+            p.radar_angle_noise_std = scenario.radar_angle_std;
+            p.min_hits_to_confirm = min_hits;
+            p.max_association_maha_dist = gate;
+            configs.push_back(p);
+        }
+    }
+
+    std::printf("configs=%zu seeds=%d objects=%d steps=%d\n", configs.size(), num_seeds,
+                num_objects, num_steps);
+    std::printf("%8s %10s %10s %12s\n", "threads", "runs", "wall [s]", "runs/s");
+
+    bool ok = true;
+    std::vector<RunMetrics> reference;
+    std::vector<ConfigSummary> summary;
+    for (int threads : {1, 2, 4}) {
+        MonteCarloRunner runner(threads);
+        const auto t0 = std::chrono::steady_clock::now();
+        summary = runner.run(scenario, configs, num_seeds);
+        const double wall =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::printf("%8d %10zu %10.3f %12.1f\n", threads, runner.runs().size(), wall,
+                    runner.runs().size() / wall);
+
+        if (reference.empty()) {
+            reference = runner.runs();
+            continue;
+        }
+        for (size_t k = 0; k < reference.size(); ++k) {
+            if (!same_accuracy(reference[k], runner.runs()[k])) {
+                std::printf("run %zu differs with %d threads\n", k, threads);
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    std::printf("\n%4s %6s %5s %14s %9s %11s %12s\n", "cfg", "gate", "hits", "pos err [m]",
+                "miss [%]", "false/frame", "births/frame");
+    for (const auto& s : summary) {
+        std::printf("%4d %6.2f %5d %7.3f+-%5.3f %9.2f %11.2f %12.2f\n", s.config,
+                    configs[s.config].max_association_maha_dist,
+                    configs[s.config].min_hits_to_confirm, s.mean.pos_err, s.stddev.pos_err,
+                    100.0 * s.mean.miss_rate, s.mean.false_tracks, s.mean.births);
+    }
+    // min_hits 가 크면 confirm 이 늦어 false track 이 줄어야 한다
+    if (!(summary[2].mean.false_tracks < summary[0].mean.false_tracks)) {
+        std::printf("config change had no effect on false tracks\n");
+        ok = false;
+    }
+
+    if (!ok) {
+        std::printf("FAIL: Monte Carlo runner check failed\n");
+        return 1;
+    }
+    return 0;
+}
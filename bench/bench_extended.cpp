@@ -0,0 +1,279 @@
+// extended object: 차량 하나에서 radar return 이 여러 개 나오는 장면에서 detection update 방식 비교
+//
+// 차량마다 차체 위 scatterer 4 곳에서 각각 확률적으로 radar return 이 생기고 camera 는 중심 하나.
+//   single       : association 으로 track 당 detection 하나, 나머지는 새 track (기존 경로)
+//   information  : 게이트 안의 detection 을 모두 정보 형태로 합산 (DetectionUpdate::Information)
+// 지표: 프레임당 생성 track 수, confirmed track 수 / object 수 (1 이면 중복 없음),
+//       각 object 와 가장 가까운 confirmed track 의 위치 오차, 프레임 시간.
+// 이어서 track 하나에 radar return N 개를 반영하는 비용을 비교한다
+//   sequential EKF (N 번 update, S 분해 N 번) vs 정보 형태 (누적 후 4x4 분해 한 번).
+// information 의 중복 track 이나 위치 오차가 single 보다 많거나,
+// N >= 4 에서 정보 형태가 sequential 보다 느리면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_extended [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "detection_batch.hpp"
+#include "highway_scenario.hpp"
+#include "kalman_filter.hpp"
+#include "sensor_models.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr double kLength = 4.5;   // 차체 [m]
+constexpr double kWidth = 1.8;
+constexpr int kScatterers = 4;
+
+// 3 차선, 차선마다 속도가 달라 옆 차선 차량과 계속 나란히 지나간다
+class LaneScenario {
+public:
+    LaneScenario(int num_objects, double dt) : dt_(dt) {
+        for (int i = 0; i < num_objects; ++i) {
+            msf::ObjectState o;
+            o.id = i;
+            o.x = 40.0 + 20.0 * (i / 3) + 7.0 * (i % 3);
+            o.y = -3.5 + 3.5 * (i % 3);
+            o.vx = 22.0 + 3.0 * (i % 3);
+            objects_.push_back(o);
+        }
+    }
+
+    void step() {
+        time_ += dt_;
+        for (auto& o : objects_) {
+            o.x += o.vx * dt_;
+        }
+    }
+
+    const std::vector<msf::ObjectState>& objects() const { return objects_; }
+    double time() const { return time_; }
+
+private:
+    double dt_;
+    double time_{0.0};
+    std::vector<msf::ObjectState> objects_;
+};
+
+// scatterer 마다 확률 p_return 으로 차체 위 임의 점에서 radar return
+class ExtendedSensor {
+public:
+    explicit ExtendedSensor(unsigned seed) : rng_(seed) {}
+
+    void generate(const std::vector<msf::ObjectState>& objects, double t,
+                  msf::DetectionBatch& out) {
+        out.clear();
+        std::normal_distribution<double> cam_noise(0.0, 0.5);
+        std::normal_distribution<double> r_noise(0.0, 0.3);
+        std::normal_distribution<double> angle_noise(0.0, 0.003);
+        std::normal_distribution<double> vr_noise(0.0, 0.3);
+        std::uniform_real_distribution<double> uni01(0.0, 1.0);
+
+        for (const auto& o : objects) {
+            if (uni01(rng_) < 0.9) {
+                out.push_camera(o.x + cam_noise(rng_), o.y + cam_noise(rng_), t);
+            }
+            for (int k = 0; k < kScatterers; ++k) {
+                if (uni01(rng_) >= 0.7) continue;
+                const double px = o.x + kLength * (uni01(rng_) - 0.5);
+                const double py = o.y + kWidth * (uni01(rng_) - 0.5);
+                const double r = std::hypot(px, py);
+                const double vr = (px * o.vx + py * o.vy) / r;
+                out.push_radar(r + r_noise(rng_), std::atan2(py, px) + angle_noise(rng_),
+                               vr + vr_noise(rng_), t);
+            }
+        }
+    }
+
+private:
+    std::mt19937 rng_;
+};
+
+struct RunResult {
+    double born_per_frame{0.0};
+    double confirmed_per_object{0.0};
+    double absorbed_per_frame{0.0};
+    double pos_err{0.0};
+    double frame_ms{0.0};
+};
+
+RunResult run(msf::DetectionUpdate mode, int num_objects, int frames) {
+    using namespace msf;
+
+    LaneScenario scenario(num_objects, 0.1);
+    ExtendedSensor sensor(7);
+
+    // 측정 노이즈에 차체 위 scatterer 위치의 퍼짐을 더해 둔다
+    TrackerParams params;
+    params.cam_pos_noise_std = 0.5;
+    params.radar_r_noise_std = 1.4;
+    params.radar_angle_noise_std = 0.012;
+    params.radar_vr_noise_std = 0.5;
+    params.max_association_maha_dist = 11.34;   // chi-square 3 자유도 99%
+    params.detection_update = mode;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch batch;
+
+    RunResult result;
+    const int warmup = 20;
+    int measured = 0;
+    std::size_t confirmed = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor.generate(scenario.objects(), t, batch);
+
+        if (step == warmup) {
+            tracker.stats().reset();
+        }
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(batch);
+        auto t1 = Clock::now();
+
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.pos_err += frame_error(scenario.objects(), tracker.get_tracks());
+            for (const auto& track : tracker.get_tracks()) {
+                confirmed += track.confirmed;
+            }
+            ++measured;
+        }
+    }
+
+    const auto& totals = tracker.stats().totals();
+    result.frame_ms /= measured;
+    result.pos_err /= measured;
+    result.born_per_frame = static_cast<double>(totals.tracks_born) / measured;
+    result.absorbed_per_frame = static_cast<double>(totals.dets_absorbed) / measured;
+    result.confirmed_per_object = static_cast<double>(confirmed) / measured / num_objects;
+    return result;
+}
+
+// track 하나에 radar return n 개: sequential EKF vs 정보 형태 [ns/track]
+struct KernelResult {
+    double sequential_ns{0.0};
+    double information_ns{0.0};
+    double max_diff{0.0};   // 두 방식의 사후 위치 차이 (선형화 점 차이만큼)
+};
+
+KernelResult time_kernels(int n) {
+    using namespace msf;
+    using Filter = KalmanFilter<4>;
+
+    const int n_tracks = 2000;
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(0.0, 1.0);
+
+    std::vector<Vec4> x0(n_tracks);
+    std::vector<Mat4> P0(n_tracks);
+    std::vector<Eigen::Vector3d> z(static_cast<size_t>(n_tracks) * n);
+    for (int i = 0; i < n_tracks; ++i) {
+        x0[i] << 40.0 + 0.1 * i, 3.0 * noise(rng), 20.0 + noise(rng), noise(rng);
+        P0[i] = Mat4::Identity() * 2.0;
+        const Eigen::Vector3d h = radar_measurement(x0[i]);
+        for (int k = 0; k < n; ++k) {
+            z[i * n + k] = h + Eigen::Vector3d(noise(rng), 0.005 * noise(rng), 0.3 * noise(rng));
+        }
+    }
+    Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+    R.diagonal() << 1.0, 0.01 * 0.01, 0.25;
+    const Eigen::Vector3d r_info = R.diagonal().cwiseInverse();
+
+    std::vector<Vec4> xs(n_tracks), xi(n_tracks);
+    KernelResult result;
+    const int reps = 5;
+    for (int rep = 0; rep < reps; ++rep) {
+        auto t0 = Clock::now();
+        for (int i = 0; i < n_tracks; ++i) {
+            Vec4 x = x0[i];
+            Mat4 P = P0[i];
+            for (int k = 0; k < n; ++k) {
+                Eigen::Vector3d y = z[i * n + k] - radar_measurement(x);
+                y(1) = normalize_angle(y(1));
+                Filter::update_innovation<3>(x, P, y, radar_H_jacobian(x), R);
+            }
+            xs[i] = x;
+        }
+        auto t1 = Clock::now();
+        for (int i = 0; i < n_tracks; ++i) {
+            Vec4 x = x0[i];
+            Mat4 P = P0[i];
+            const Eigen::Vector3d h = radar_measurement(x);
+            Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+            for (int k = 0; k < n; ++k) {
+                Eigen::Vector3d y = z[i * n + k] - h;
+                y(1) = normalize_angle(y(1));
+                sum += y;
+            }
+            const Eigen::Matrix<double, 3, 4> H = radar_H_jacobian(x);
+            const Eigen::Matrix<double, 4, 3> HtRi = H.transpose() * r_info.asDiagonal();
+            const Mat4 J = n * (HtRi * H);
+            const Vec4 g = HtRi * sum;
+            Filter::update_information(x, P, J, g);
+            xi[i] = x;
+        }
+        auto t2 = Clock::now();
+        result.sequential_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        result.information_ns += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    }
+    result.sequential_ns /= reps * n_tracks;
+    result.information_ns /= reps * n_tracks;
+    for (int i = 0; i < n_tracks; ++i) {
+        result.max_diff = std::max(result.max_diff, (xs[i].head<2>() - xi[i].head<2>()).norm());
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::DetectionUpdate;
+
+    int num_objects = 45;
+    int frames = 300;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    std::printf("objects=%d frames=%d\n", num_objects, frames);
+    std::printf("%-12s %12s %14s %15s %12s %10s\n", "update", "born/frame", "confirmed/obj",
+                "absorbed/frame", "pos err [m]", "ms/frame");
+
+    const RunResult single = run(DetectionUpdate::Single, num_objects, frames);
+    const RunResult info = run(DetectionUpdate::Information, num_objects, frames);
+    for (const auto* r : {&single, &info}) {
+        std::printf("%-12s %12.2f %14.3f %15.1f %12.3f %10.3f\n",
+                    r == &single ? "single" : "information", r->born_per_frame,
+                    r->confirmed_per_object, r->absorbed_per_frame, r->pos_err, r->frame_ms);
+    }
+
+    std::printf("\n%8s %16s %16s %10s %14s\n", "returns", "sequential [ns]", "information [ns]",
+                "speedup", "pos diff [m]");
+    bool kernel_ok = true;
+    for (int n : {1, 2, 4, 8, 16}) {
+        const KernelResult k = time_kernels(n);
+        std::printf("%8d %16.1f %16.1f %9.2fx %14.4f\n", n, k.sequential_ns, k.information_ns,
+                    k.sequential_ns / k.information_ns, k.max_diff);
+        if (n >= 4 && k.information_ns > k.sequential_ns) {
+            kernel_ok = false;
+        }
+    }
+
+    if (std::abs(info.confirmed_per_object - 1.0) > std::abs(single.confirmed_per_object - 1.0) ||
+        info.pos_err > single.pos_err || !kernel_ok) {
+        std::printf("FAIL: information update keeps duplicate tracks, is less accurate or slower\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// 센서 융합 방식 비교: Joint (camera + radar 를 한 association 문제로) vs Sequential (센서별)
+//
+// 같은 detection 열을 두 방식의 tracker 에 넣고 다음을 비교한다.
+//   born/frame     : 프레임당 새로 생긴 track 수 (중복 / 가짜 track)
+//   confirmed/obj  : confirmed track 수 / 실제 object 수 (1 에 가까울수록 중복이 적음)
+//   updates/frame  : 프레임당 측정 update 수 (Joint 는 track 당 최대 1, Sequential 은 센서마다 1)
+//   assoc [us]     : association 단계 평균 시간 (Sequential 은 두 pass 합)
+//   pos err        : 각 object 와 가장 가까운 confirmed track 의 위치 오차 평균
+// Sequential 의 track 생성이 Joint 보다 많거나 위치 오차가 5% 넘게 크면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_fusion [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+struct RunResult {
+    double born_per_frame{0.0};
+    double confirmed_per_object{0.0};
+    double updates_per_frame{0.0};
+    double assoc_us{0.0};
+    double pos_err{0.0};
+    double frame_ms{0.0};
+};
+
+RunResult run(msf::FusionMode mode, int num_objects, int frames) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.2);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.fusion_mode = mode;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch batch;
+
+    RunResult result;
+    const int warmup = 20;
+    int measured = 0;
+    std::size_t confirmed = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, batch);
+
+        if (step == warmup) {
+            tracker.stats().reset();
+        }
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(batch);
+        auto t1 = Clock::now();
+
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.pos_err += frame_error(scenario.objects(), tracker.get_tracks());
+            for (const auto& track : tracker.get_tracks()) {
+                confirmed += track.confirmed;
+            }
+            ++measured;
+        }
+    }
+
+    const auto& stats = tracker.stats();
+    const auto& totals = stats.totals();
+    result.frame_ms /= measured;
+    result.pos_err /= measured;
+    result.born_per_frame = static_cast<double>(totals.tracks_born) / measured;
+    result.updates_per_frame = static_cast<double>(totals.ekf_updates) / measured;
+    result.confirmed_per_object = static_cast<double>(confirmed) / measured / num_objects;
+    // association 구간은 pass 마다 기록되므로 프레임당으로 환산
+    const auto& assoc = stats.stage(TrackerStage::Association);
+    result.assoc_us = assoc.total_ns * 1e-3 / measured;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::FusionMode;
+
+    int num_objects = 200;
+    int frames = 300;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    std::printf("objects=%d frames=%d\n", num_objects, frames);
+    std::printf("%-11s %12s %14s %14s %11s %12s %10s\n", "mode", "born/frame",
+                "confirmed/obj", "updates/frame", "assoc [us]", "pos err [m]", "ms/frame");
+
+    const RunResult joint = run(FusionMode::Joint, num_objects, frames);
+    const RunResult seq = run(FusionMode::Sequential, num_objects, frames);
+    for (const auto* r : {&joint, &seq}) {
+        std::printf("%-11s %12.2f %14.3f %14.1f %11.1f %12.3f %10.3f\n",
+                    r == &joint ? "joint" : "sequential", r->born_per_frame,
+                    r->confirmed_per_object, r->updates_per_frame, r->assoc_us, r->pos_err,
+                    r->frame_ms);
+    }
+
+    if (seq.born_per_frame > joint.born_per_frame || seq.pos_err > 1.05 * joint.pos_err) {
+        std::printf("FAIL: sequential update creates more tracks or is less accurate\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+// Spatial grid gating vs dense 비용 행렬 update() 스케일링 벤치마크
+// 시작 전에 NaN / inf / 아주 먼 좌표가 섞인 점으로 SpatialGrid 를 만들어 보고
+// build 가 끝나고 유한한 점만 질의에 나오는지 확인한다 (아니면 1 로 종료).
+//
+// 사용법: bench_gating [object_count ...]
+//   기본값: 10 100 1000 5000
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "gating.hpp"
+#include "tracker.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+struct RunResult {
+    double update_ms{0.0};   // 프레임당 평균 update() 시간
+    double num_tracks{0.0};  // 측정 구간 평균 track 수
+    double num_dets{0.0};    // 측정 구간 평균 detection 수
+};
+
+RunResult run(int num_objects, bool use_grid, int warmup_frames, int measure_frames) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    const double dt = 0.1;
+    HighwayScenario scenario(num_objects, dt);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.use_spatial_gating = use_grid;
+    MultiSensorTracker tracker(params);
+
+    RunResult result;
+    for (int step = 0; step < warmup_frames + measure_frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        auto detections = sensor_sim.generate(scenario.objects(), t);
+
+        tracker.predict(t);
+        const size_t n_tracks = tracker.get_tracks().size();
+
+        auto t0 = Clock::now();
+        tracker.update(detections);
+        auto t1 = Clock::now();
+
+        if (step >= warmup_frames) {
+            result.update_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.num_tracks += static_cast<double>(n_tracks);
+            result.num_dets += static_cast<double>(detections.size());
+        }
+    }
+
+    result.update_ms /= measure_frames;
+    result.num_tracks /= measure_frames;
+    result.num_dets /= measure_frames;
+    return result;
+}
+
+// 유한하지 않은 좌표가 있어도 build 가 끝나고, 그 점은 질의 결과에 나오지 않아야 한다
+bool grid_handles_non_finite() {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    bool ok = true;
+
+    // 1) NaN / inf 가 섞인 경우: 유한한 점 0, 3 만 나와야 함
+    std::vector<Eigen::Vector2d> points = {
+        {0.0, 0.0}, {nan, 1.0}, {inf, -inf}, {5.0, 5.0}, {1.0, nan},
+    };
+    msf::SpatialGrid grid(10.0);
+    grid.build(points);
+    std::vector<int> found;
+    grid.query(2.0, 2.0, 10.0, found);
+    ok = ok && found.size() == 2;
+    for (int i : found) {
+        ok = ok && (i == 0 || i == 3);
+    }
+    found.clear();
+    grid.query(nan, 0.0, 10.0, found);
+    ok = ok && found.empty();
+
+    // 2) 범위가 double 을 넘는 경우 (max - min = inf): 셀 하나로 두고 모든 점이 나와야 함
+    points = {{-1e308, 0.0}, {1e308, 0.0}, {0.0, 0.0}};
+    grid.build(points);
+    found.clear();
+    grid.query(0.0, 0.0, 10.0, found);
+    ok = ok && found.size() == 3;
+
+    std::printf("non-finite / huge points in SpatialGrid: %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<int> counts = {10, 100, 1000, 5000};
+    if (argc >= 2) {
+        counts.clear();
+        for (int i = 1; i < argc; ++i) {
+            counts.push_back(std::stoi(argv[i]));
+        }
+    }
+
+    if (!grid_handles_non_finite()) {
+        return 1;
+    }
+
+    std::printf("%8s %10s %10s %14s %14s %9s\n",
+                "objects", "tracks", "dets", "dense [ms]", "grid [ms]", "speedup");
+
+    for (int n : counts) {
+        // dense 경로는 O(N*M) 이므로 큰 N 에서는 측정 프레임 수를 줄임
+        const int warmup = n >= 5000 ? 2 : 3;
+        const int frames = n >= 5000 ? 1 : (n >= 1000 ? 3 : 20);
+
+        RunResult dense = run(n, false, warmup, frames);
+        RunResult grid = run(n, true, warmup, frames);
+
+        std::printf("%8d %10.0f %10.0f %14.3f %14.3f %8.1fx\n",
+                    n, grid.num_tracks, grid.num_dets,
+                    dense.update_ms, grid.update_ms,
+                    dense.update_ms / grid.update_ms);
+    }
+
+    return 0;
+}
@@ -0,0 +1,305 @@
+// 운동 모델 비교: CV (기본 노이즈 / 키운 노이즈) vs IMM (CV / CA / CT)
+//
+// 차량들이 감속, 가속, 차선 변경, 곡선 주행을 반복하는 장면에서 세 설정을 비교한다.
+//   cv       : process_noise_std = 1 (직진 구간에 맞춘 값)
+//   cv-wide  : process_noise_std = 4 (기동을 따라가도록 키운 값, 게이트가 넓어짐)
+//   imm      : process_noise_std = 1 인 CV + CA + CT
+// 지표는 각 ground truth object 와 가장 가까운 confirmed track 의 위치 / 속도 오차 평균,
+// 프레임당 게이트 통과 쌍 수 (association 비용), 프레임당 predict + update 시간.
+// IMM 의 위치 오차가 cv-wide 보다 크거나 프레임 시간이 cv 의 4 배를 넘으면 0 이 아닌 값으로 종료한다.
+//
+// 먼저 ImmFilterBank 의 외부 보정 경로를 확인한다 (어긋나면 0 이 아닌 값으로 종료).
+//   - camera detection 하나를 정보형 (update_information) 으로 넣은 결과가 update() 와 같은지
+//   - 선회 중인 track 에 작은 공분산의 object 를 fuse 하거나 (track-to-track) 공분산을 키우는 보정
+//     (JPDA 혼합) 을 apply_correction 으로 넣은 뒤 predict 해도 결합 공분산이 양의 정부호인지
+//
+// 사용법: bench_imm [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "imm.hpp"
+#include "track_fusion.hpp"
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+// 기동 단계: 직진 → 감속 → 차선 변경 → 가속 → 곡선 → 반대 곡선 (track 마다 시작 단계가 다름)
+class ManeuverScenario {
+public:
+    ManeuverScenario(int num_objects, double dt) : dt_(dt) {
+        for (int i = 0; i < num_objects; ++i) {
+            Vehicle v;
+            v.s.id = i;
+            v.s.x = 20.0 + 8.0 * (i / 3);
+            v.s.y = -3.5 + 3.5 * (i % 3);
+            v.speed = 20.0 + (i % 4) * 2.0;
+            v.heading = 0.0;
+            v.phase_time = 0.7 * i;
+            vehicles_.push_back(v);
+        }
+        sync();
+    }
+
+    void step() {
+        // 시뮬레이션은 더 작은 간격으로 적분
+        const int sub = 10;
+        const double h = dt_ / sub;
+        for (int k = 0; k < sub; ++k) {
+            for (auto& v : vehicles_) {
+                double accel = 0.0, turn_rate = 0.0;
+                const double t = std::fmod(time_ + v.phase_time, kCycle);
+                if (t < 3.0) {
+                } else if (t < 5.0) {
+                    accel = -4.0;                                  // 감속
+                } else if (t < 8.0) {
+                    turn_rate = 0.12 * std::sin(2.0 * M_PI * (t - 5.0) / 3.0);   // 차선 변경
+                } else if (t < 10.0) {
+                    accel = 4.0;                                   // 가속
+                } else if (t < 13.0) {
+                    turn_rate = 0.15;                              // 곡선
+                } else if (t < 16.0) {
+                    turn_rate = -0.15;
+                }
+                v.speed = std::max(5.0, v.speed + accel * h);
+                v.heading += turn_rate * h;
+                v.s.x += v.speed * std::cos(v.heading) * h;
+                v.s.y += v.speed * std::sin(v.heading) * h;
+            }
+            time_ += h;
+        }
+        sync();
+    }
+
+    const std::vector<msf::ObjectState>& objects() const { return objects_; }
+    double time() const { return time_; }
+
+private:
+    static constexpr double kCycle = 18.0;
+
+    struct Vehicle {
+        msf::ObjectState s;
+        double speed{0.0};
+        double heading{0.0};
+        double phase_time{0.0};
+    };
+
+    void sync() {
+        objects_.clear();
+        for (auto v : vehicles_) {
+            v.s.vx = v.speed * std::cos(v.heading);
+            v.s.vy = v.speed * std::sin(v.heading);
+            objects_.push_back(v.s);
+        }
+    }
+
+    double dt_;
+    double time_{0.0};
+    std::vector<Vehicle> vehicles_;
+    std::vector<msf::ObjectState> objects_;
+};
+
+struct Config {
+    const char* name;
+    msf::MotionModel model;
+    double process_noise_std;
+};
+
+struct RunResult {
+    double pos_err{0.0};
+    double vel_err{0.0};
+    double gated_per_frame{0.0};
+    double frame_ms{0.0};
+};
+
+RunResult run(const Config& cfg, int num_objects, int frames) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    ManeuverScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(0.5, 0.5, 0.01, 0.3, 0.95, 0.1);
+
+    TrackerParams params;
+    params.cam_pos_noise_std = 0.5;
+    params.radar_r_noise_std = 0.5;
+    params.radar_angle_noise_std = 0.01;
+    params.radar_vr_noise_std = 0.3;
+    params.max_association_maha_dist = 16.0;
+    params.motion_model = cfg.model;
+    params.process_noise_std = cfg.process_noise_std;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch batch;
+
+    RunResult result;
+    const int warmup = 20;
+    int measured = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, batch);
+
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(batch);
+        auto t1 = Clock::now();
+
+        if (step == warmup) {
+            tracker.stats().reset();
+        }
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            accumulate_error(scenario.objects(), tracker.get_tracks(),
+                             result.pos_err, result.vel_err);
+            ++measured;
+        }
+    }
+    result.frame_ms /= measured;
+    result.pos_err /= measured;
+    result.vel_err /= measured;
+    result.gated_per_frame =
+        static_cast<double>(tracker.stats().totals().pairs_gated) / std::max(1, measured - 1);
+    return result;
+}
+
+double min_eigenvalue(const msf::Mat4& P) {
+    return Eigen::SelfAdjointEigenSolver<msf::Mat4>(0.5 * (P + P.transpose())).eigenvalues()(0);
+}
+
+// 반경 R 의 원을 도는 target 을 camera 로 frames 번 추적한 IMM track 하나
+void track_turn(msf::ImmFilterBank& bank, msf::TrackState& t, int frames) {
+    using namespace msf;
+    const double w = 0.3, speed = 20.0, radius = speed / w;
+    const Eigen::Matrix2d R_cam = Eigen::Matrix2d::Identity();
+    const Eigen::Matrix3d R_rad = Eigen::Matrix3d::Identity();
+
+    t.x << 0.0, 0.0, speed, 0.0;
+    t.P = Mat4::Identity();
+    t.last_timestamp = 0.0;
+    bank.push_back(t.x, t.P);
+    DetectionBatch batch;
+    for (int f = 1; f <= frames; ++f) {
+        const double time = 0.1 * f;
+        bank.predict(&t, 0, 1, time);
+        t.last_timestamp = time;
+        Detection d;
+        d.sensor = SensorType::Camera;
+        d.z.resize(2);
+        d.z << radius * std::sin(w * time), radius * (1.0 - std::cos(w * time));
+        d.timestamp = time;
+        batch.clear();
+        batch.push_back(d);
+        const int assignment = 0;
+        bank.update(&t, 0, 1, &assignment, batch, R_cam, R_rad);
+    }
+}
+
+bool check_corrections() {
+    using namespace msf;
+    TrackerParams params;
+    bool ok = true;
+
+    // 1) camera 하나: 정보형 J = H^T R^-1 H, info = H^T R^-1 z 는 모델별 KF update 와 같아야 한다
+    {
+        ImmFilterBank a(params), b(params);
+        TrackState ta, tb;
+        track_turn(a, ta, 30);
+        track_turn(b, tb, 30);
+        a.predict(&ta, 0, 1, 3.1);
+        b.predict(&tb, 0, 1, 3.1);
+
+        const Eigen::Vector2d z(ta.x(0) + 0.7, ta.x(1) - 0.4);
+        Detection d;
+        d.sensor = SensorType::Camera;
+        d.z = z;
+        d.timestamp = 3.1;
+        DetectionBatch batch;
+        batch.push_back(d);
+        const int assignment = 0;
+        a.update(&ta, 0, 1, &assignment, batch, Eigen::Matrix2d::Identity(),
+                 Eigen::Matrix3d::Identity());
+
+        Mat4 J = Mat4::Zero();
+        J(0, 0) = J(1, 1) = 1.0;
+        Vec4 info = Vec4::Zero();
+        info.head<2>() = z;
+        b.update_information(0, J, info, tb.x, tb.P);
+
+        const double err = std::max({(ta.x - tb.x).cwiseAbs().maxCoeff(),
+                                     (ta.P - tb.P).cwiseAbs().maxCoeff(),
+                                     (a.probabilities(0) - b.probabilities(0)).cwiseAbs().maxCoeff()});
+        std::printf("information-form camera update vs update(): max diff %.2e\n", err);
+        ok = ok && err < 1e-9;
+    }
+
+    // 2) 선회 중 정확한 object 를 fuse (모델 간 퍼짐보다 훨씬 작은 P) / 3) 공분산을 키우는 보정
+    for (int k = 0; k < 2; ++k) {
+        ImmFilterBank bank(params);
+        TrackState t;
+        track_turn(bank, t, 30);
+        const Vec4 x_prior = t.x;
+        const Mat4 P_prior = t.P;
+        if (k == 0) {
+            fuse_information(t.x, t.P, t.x, 0.01 * Mat4::Identity());
+        } else {
+            Vec4 shift;
+            shift << 1.0, -0.5, 0.3, 0.2;
+            t.x += shift;
+            t.P += 0.5 * shift * shift.transpose();
+        }
+        bank.apply_correction(0, x_prior, P_prior, t.x, t.P);
+        const double after_correction = min_eigenvalue(t.P);
+        bank.predict(&t, 0, 1, 3.1);
+        const double after_predict = min_eigenvalue(t.P);
+        std::printf("%s correction: min eigenvalue %.3e, after predict %.3e\n",
+                    k == 0 ? "fusion" : "widening", after_correction, after_predict);
+        ok = ok && after_correction > 0.0 && after_predict > 0.0;
+    }
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::MotionModel;
+
+    int num_objects = 60;
+    int frames = 400;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    const Config configs[] = {
+        {"cv",      MotionModel::CV,  1.0},
+        {"cv-wide", MotionModel::CV,  4.0},
+        {"imm",     MotionModel::IMM, 1.0},
+    };
+
+    if (!check_corrections()) {
+        std::printf("FAIL: IMM correction path\n");
+        return 1;
+    }
+
+    std::printf("\nobjects=%d frames=%d\n", num_objects, frames);
+    std::printf("%-8s %14s %14s %14s %10s\n",
+                "model", "pos err [m]", "vel err [m/s]", "gated/frame", "ms/frame");
+
+    RunResult r[3];
+    for (int k = 0; k < 3; ++k) {
+        r[k] = run(configs[k], num_objects, frames);
+        std::printf("%-8s %14.3f %14.3f %14.1f %10.3f\n", configs[k].name,
+                    r[k].pos_err, r[k].vel_err, r[k].gated_per_frame, r[k].frame_ms);
+    }
+
+    if (r[2].pos_err > r[1].pos_err || r[2].frame_ms > 4.0 * r[0].frame_ms) {
+        std::printf("FAIL: IMM is less accurate than the widened CV model or too slow\n");
+        return 1;
+    }
+    return 0;
+}
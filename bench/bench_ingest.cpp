@@ -0,0 +1,75 @@
+// 프레임 단위 detection 수집 비용: std::vector<Detection> vs DetectionBatch
+//
+// 전역 operator new 를 교체해 프레임당 heap 할당 횟수를 센다.
+// DetectionBatch 경로는 warm-up 이후 할당이 0 이어야 하며, 아니면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_ingest [num_objects] [frames]
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "alloc_counter.hpp"
+#include "detection_batch.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+int main(int argc, char** argv) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    int num_objects = 1000;
+    int frames = 200;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sim_vec(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+    SensorSimulator sim_batch(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+
+    DetectionBatch batch;
+    // warm-up: batch capacity 확보
+    sim_batch.generate(scenario.objects(), 0.0, batch);
+    batch.reserve(batch.size() * 2);
+
+    double vec_ms = 0.0, batch_ms = 0.0;
+    long long vec_allocs = 0, batch_allocs = 0;
+    size_t total_dets = 0;
+
+    for (int f = 0; f < frames; ++f) {
+        const double t = 0.1 * (f + 1);
+
+        g_allocs.store(0);
+        g_counting.store(true);
+        auto t0 = Clock::now();
+        auto dets = sim_vec.generate(scenario.objects(), t);
+        auto t1 = Clock::now();
+        g_counting.store(false);
+        vec_allocs += static_cast<long long>(g_allocs.load());
+        vec_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        total_dets += dets.size();
+
+        g_allocs.store(0);
+        g_counting.store(true);
+        t0 = Clock::now();
+        sim_batch.generate(scenario.objects(), t, batch);
+        t1 = Clock::now();
+        g_counting.store(false);
+        batch_allocs += static_cast<long long>(g_allocs.load());
+        batch_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+
+    std::printf("objects=%d frames=%d avg detections/frame=%.0f\n",
+                num_objects, frames, static_cast<double>(total_dets) / frames);
+    std::printf("%-22s %12s %14s\n", "path", "ms/frame", "allocs/frame");
+    std::printf("%-22s %12.3f %14.1f\n", "vector<Detection>",
+                vec_ms / frames, static_cast<double>(vec_allocs) / frames);
+    std::printf("%-22s %12.3f %14.1f\n", "DetectionBatch",
+                batch_ms / frames, static_cast<double>(batch_allocs) / frames);
+
+    if (batch_allocs != 0) {
+        std::printf("FAIL: DetectionBatch ingestion allocated %lld times\n", batch_allocs);
+        return 1;
+    }
+    return 0;
+}
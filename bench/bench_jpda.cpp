@@ -0,0 +1,391 @@
+// JpdaSolver (JPDA association 확률) 확인과 tracker 비교
+//
+//   - 작은 무작위 후보 그래프에서 열거 (exact) 결과가 전수 탐색으로 구한 beta / beta_miss 와 같은지
+//   - cluster 하나짜리 그래프에서 Murty k-best 가 전수 탐색의 가중치 상위 max_events 개 event 와 같은지
+//   - track 하나짜리 cluster 에서 cheap JPDA 가 exact 와 같은지 (여러 track cluster 의 오차는 출력만)
+//   - 큰 장면에서 스레드 1 / 2 / 4 의 결과가 bit 단위로 같은지
+//   - 큰 cluster (k-best / cheap JPDA 로 넘어가는 크기) 에서 solve 시간이 bounded 인지
+//   - clutter 가 많은 traffic 장면에서 Greedy / Optimal / JPDA 의 GOSPA / RMSE / false track / 시간
+// 하나라도 어긋나면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_jpda [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "jpda.hpp"
+#include "parallel_sensor_simulator.hpp"
+#include "track_metrics.hpp"
+#include "tracker.hpp"
+#include "traffic_scenario.hpp"
+
+namespace {
+
+using namespace msf;
+using Clock = std::chrono::steady_clock;
+
+struct Problem {
+    int n_tracks{0};
+    int n_dets{0};
+    std::vector<GateCandidate> candidates;
+    std::vector<double> likelihood;
+};
+
+// track 마다 무작위 detection 몇 개 (connected 이면 모든 track 이 detection 0 을 공유 → cluster 하나)
+Problem random_problem(std::mt19937& rng, int n_tracks, int n_dets, bool connected) {
+    std::uniform_int_distribution<int> det(0, n_dets - 1);
+    std::uniform_int_distribution<int> degree(0, 3);
+    std::uniform_real_distribution<double> log_g(-4.0, 6.0);
+    Problem p;
+    p.n_tracks = n_tracks;
+    p.n_dets = n_dets;
+    for (int i = 0; i < n_tracks; ++i) {
+        std::vector<int> dets;
+        if (connected) dets.push_back(0);
+        for (int k = degree(rng); k > 0; --k) {
+            const int j = det(rng);
+            if (std::find(dets.begin(), dets.end(), j) == dets.end()) dets.push_back(j);
+        }
+        std::sort(dets.begin(), dets.end());
+        for (int j : dets) {
+            p.candidates.push_back({i, j, 0.0});
+            p.likelihood.push_back(std::exp(log_g(rng)));
+        }
+    }
+    return p;
+}
+
+// 모든 (track → 미검출 또는 후보 하나) 조합 중 detection 이 겹치지 않는 것의 가중치 합으로 정규화
+// top_k > 0 이면 가중치 상위 top_k 개 event 만 쓴다 (k-best 기준값)
+void brute_force(const Problem& p, double pd, std::uint64_t top_k, std::vector<double>& beta,
+                 std::vector<double>& beta_miss, std::uint64_t& valid_events) {
+    std::vector<std::vector<int>> by_track(p.n_tracks);
+    for (int k = 0; k < static_cast<int>(p.candidates.size()); ++k) {
+        by_track[p.candidates[k].track].push_back(k);
+    }
+
+    // event: 가중치와 track 별 선택 (-1: 미검출, 그 밖은 후보 index)
+    std::vector<std::pair<double, std::vector<int>>> events;
+    std::vector<int> pick(p.n_tracks, -1);   // -1: 미검출, 그 밖은 by_track 안의 위치
+    while (true) {
+        std::vector<char> used(p.n_dets, 0);
+        std::vector<int> event(p.n_tracks, -1);
+        bool ok = true;
+        double w = 1.0;
+        for (int i = 0; i < p.n_tracks && ok; ++i) {
+            if (pick[i] < 0) {
+                w *= 1.0 - pd;
+                continue;
+            }
+            const int k = by_track[i][pick[i]];
+            ok = !used[p.candidates[k].det];
+            used[p.candidates[k].det] = 1;
+            w *= p.likelihood[k];
+            event[i] = k;
+        }
+        if (ok) {
+            events.emplace_back(w, event);
+        }
+        int i = 0;
+        while (i < p.n_tracks && ++pick[i] >= static_cast<int>(by_track[i].size())) {
+            pick[i] = -1;
+            ++i;
+        }
+        if (i == p.n_tracks) break;
+    }
+    valid_events = events.size();
+    if (top_k > 0 && top_k < events.size()) {
+        std::sort(events.begin(), events.end(),
+                  [](const auto& a, const auto& b) { return a.first > b.first; });
+        events.resize(top_k);
+    }
+
+    beta.assign(p.candidates.size(), 0.0);
+    beta_miss.assign(p.n_tracks, 0.0);
+    double total = 0.0;
+    for (const auto& [w, event] : events) {
+        total += w;
+        for (int i = 0; i < p.n_tracks; ++i) {
+            (event[i] < 0 ? beta_miss[i] : beta[event[i]]) += w;
+        }
+    }
+    for (double& b : beta) b /= total;
+    for (double& b : beta_miss) b /= total;
+}
+
+double max_diff(const std::vector<double>& a, const std::vector<double>& b) {
+    double d = 0.0;
+    for (size_t k = 0; k < a.size(); ++k) {
+        d = std::max(d, std::abs(a[k] - b[k]));
+    }
+    return d;
+}
+
+double solver_diff(const JpdaSolver& s, const std::vector<double>& beta,
+                   const std::vector<double>& beta_miss) {
+    return std::max(max_diff(s.beta(), beta), max_diff(s.beta_miss(), beta_miss));
+}
+
+bool check_solver() {
+    constexpr double kPd = 0.9;
+    constexpr double kTol = 1e-9;
+    std::mt19937 rng(7);
+    ThreadPool pool(1);
+    JpdaSolver solver;
+    bool ok = true;
+
+    // exact vs 전수 탐색 (여러 cluster)
+    int exact_bad = 0;
+    const int trials = 400;
+    for (int t = 0; t < trials; ++t) {
+        const Problem p = random_problem(rng, 1 + t % 6, 2 + t % 7, false);
+        std::vector<double> beta, beta_miss;
+        std::uint64_t valid = 0;
+        brute_force(p, kPd, 0, beta, beta_miss, valid);
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, kPd, 1 << 20, 64, pool);
+        if (solver.stats().k_best + solver.stats().approximate > 0 ||
+            solver_diff(solver, beta, beta_miss) > kTol) {
+            ++exact_bad;
+        }
+    }
+    std::printf("exact vs brute force          : %d/%d match\n", trials - exact_bad, trials);
+    ok = ok && exact_bad == 0;
+
+    // Murty k-best: 가중치 상위 K 개 event 만 쓴 결과가 전수 탐색의 상위 K 개와 같아야 한다
+    // (K 를 유효 event 수보다 작게 두면 열거 대신 k-best 로 간다)
+    int kbest_bad = 0, kbest_used = 0;
+    for (int t = 0; t < trials; ++t) {
+        const Problem p = random_problem(rng, 2 + t % 5, 2 + t % 5, true);
+        std::vector<double> beta, beta_miss;
+        std::uint64_t valid = 0;
+        brute_force(p, kPd, 0, beta, beta_miss, valid);
+        if (valid < 3) continue;
+        const std::uint64_t k = t % 2 ? valid - 1 : valid / 2;
+        brute_force(p, kPd, k, beta, beta_miss, valid);
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, kPd,
+                     static_cast<int>(k), 64, pool);
+        ++kbest_used;
+        if (solver.stats().k_best != 1 || solver.stats().events != k ||
+            solver_diff(solver, beta, beta_miss) > kTol) {
+            ++kbest_bad;
+        }
+    }
+    std::printf("k-best vs brute-force top-K   : %d/%d match\n", kbest_used - kbest_bad, kbest_used);
+    ok = ok && kbest_bad == 0 && kbest_used > trials / 2;
+
+    // 상위 1/4 event 만 쓰는 k-best 와 cheap JPDA 의 전체 JPDA 대비 오차 (참고용)
+    double kbest_err = 0.0, approx_err = 0.0;
+    int single_bad = 0;
+    for (int t = 0; t < trials; ++t) {
+        const Problem p = random_problem(rng, 3 + t % 4, 3 + t % 5, true);
+        std::vector<double> beta, beta_miss;
+        std::uint64_t valid = 0;
+        brute_force(p, kPd, 0, beta, beta_miss, valid);
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, kPd,
+                     std::max<int>(1, static_cast<int>(valid / 4)), 64, pool);
+        kbest_err = std::max(kbest_err, solver_diff(solver, beta, beta_miss));
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, kPd, 1, 0, pool);
+        approx_err = std::max(approx_err, solver_diff(solver, beta, beta_miss));
+
+        // detection 을 공유하지 않는 track 하나짜리 cluster: cheap JPDA = PDA (정확)
+        Problem q;
+        q.n_tracks = p.n_tracks;
+        q.n_dets = static_cast<int>(p.candidates.size());
+        q.likelihood = p.likelihood;
+        for (int k = 0; k < q.n_dets; ++k) {
+            q.candidates.push_back({p.candidates[k].track, k, 0.0});
+        }
+        brute_force(q, kPd, 0, beta, beta_miss, valid);
+        solver.solve(q.candidates, q.likelihood, q.n_tracks, q.n_dets, kPd, 1, 0, pool);
+        if (solver.stats().approximate != solver.stats().clusters ||
+            solver_diff(solver, beta, beta_miss) > kTol) {
+            ++single_bad;
+        }
+    }
+    std::printf("single-track cheap JPDA       : %d/%d match\n", trials - single_bad, trials);
+    std::printf("max |beta error|  k-best(1/4 events)=%.3f  cheap JPDA=%.3f\n",
+                kbest_err, approx_err);
+    ok = ok && single_bad == 0;
+    return ok;
+}
+
+// 차선 위에 늘어선 track / detection (이웃끼리 후보가 겹쳐 크고 작은 cluster 가 섞임)
+Problem lane_problem(std::mt19937& rng, int n_tracks, double spacing) {
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    Problem p;
+    p.n_tracks = n_tracks;
+    std::vector<double> det_x;
+    for (int i = 0; i < n_tracks; ++i) {
+        if (u(rng) < 0.9) det_x.push_back(i * spacing + noise(rng));
+        if (u(rng) < 0.3) det_x.push_back(u(rng) * n_tracks * spacing);
+    }
+    std::sort(det_x.begin(), det_x.end());
+    p.n_dets = static_cast<int>(det_x.size());
+    for (int i = 0; i < n_tracks; ++i) {
+        for (int j = 0; j < p.n_dets; ++j) {
+            const double d2 = (det_x[j] - i * spacing) * (det_x[j] - i * spacing);
+            if (d2 <= 16.0) {
+                p.candidates.push_back({i, j, d2});
+                p.likelihood.push_back(0.9 * std::exp(-0.5 * d2) / (std::sqrt(2.0 * M_PI) * 0.01));
+            }
+        }
+    }
+    return p;
+}
+
+bool check_threads() {
+    std::mt19937 rng(11);
+    const Problem p = lane_problem(rng, 20000, 4.0);
+    std::vector<double> ref_beta, ref_miss;
+    bool ok = true;
+    for (int threads : {1, 2, 4}) {
+        ThreadPool pool(threads);
+        JpdaSolver solver;
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, 0.9, 100, 12, pool);
+        const auto t0 = Clock::now();
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, 0.9, 100, 12, pool);
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        const JpdaStats& s = solver.stats();
+        std::printf("threads=%d  clusters=%d exact=%d k-best=%d cheap=%d max_tracks=%d  %.2f ms\n",
+                    threads, s.clusters, s.exact, s.k_best, s.approximate,
+                    s.max_cluster_tracks, ms);
+        if (threads == 1) {
+            ref_beta = solver.beta();
+            ref_miss = solver.beta_miss();
+        } else if (solver.beta() != ref_beta || solver.beta_miss() != ref_miss) {
+            std::printf("  FAIL: result differs from 1 thread\n");
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool check_bounded() {
+    // 간격을 좁혀 cluster 하나에 track 이 수십 ~ 수백 개
+    std::mt19937 rng(13);
+    ThreadPool pool(1);
+    bool ok = true;
+    for (int n : {12, 40, 400}) {
+        const Problem p = lane_problem(rng, n, 1.0);
+        JpdaSolver solver;
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, 0.9, 100, 12, pool);
+        const auto t0 = Clock::now();
+        solver.solve(p.candidates, p.likelihood, p.n_tracks, p.n_dets, 0.9, 100, 12, pool);
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        const JpdaStats& s = solver.stats();
+        std::printf("dense lane n=%-4d candidates=%-5zu clusters=%d k-best=%d cheap=%d events=%llu  %.3f ms\n",
+                    n, p.candidates.size(), s.clusters, s.k_best, s.approximate,
+                    static_cast<unsigned long long>(s.events), ms);
+        if (s.events > static_cast<std::uint64_t>(100) * s.clusters || ms > 200.0) {
+            std::printf("  FAIL: unbounded cluster cost\n");
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+struct TrackerRun {
+    MetricsSummary metrics;
+    double frame_ms{0.0};
+    double clusters{0.0};
+    double events{0.0};
+    double truncated{0.0};
+};
+
+TrackerRun run_tracker(AssociationMethod method, int num_objects, int frames) {
+    constexpr double kClutterRate = 0.5;   // object 당 clutter detection 수
+    TrafficParams traffic;
+    traffic.num_objects = num_objects;
+    traffic.seed = 5;
+    TrafficScenario world(traffic);
+    ParallelSensorSimulator sensor(1.0, 1.0, 0.02, 0.5, 0.9, kClutterRate, 77, 1);
+    sensor.set_clutter_region(world.x_min(), world.x_max(), world.y_min(), world.y_max());
+    const double area = (world.x_max() - world.x_min()) * (world.y_max() - world.y_min());
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.association_method = method;
+    params.detection_prob = 0.9;
+    params.camera_clutter_density = kClutterRate * num_objects / area;
+    MultiSensorTracker tracker(params);
+    TrackMetrics metrics(TrackMetricsParams{5.0, 2.0});
+
+    DetectionBatch batch;
+    TrackerRun r;
+    const int warmup = 20;
+    for (int step = 0; step < warmup + frames; ++step) {
+        world.step();
+        sensor.generate(world.objects(), world.time(), batch);
+        if (step == warmup) tracker.stats().reset();
+        const auto t0 = Clock::now();
+        tracker.predict(world.time());
+        tracker.update(batch);
+        const auto t1 = Clock::now();
+        if (step < warmup) continue;
+        r.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        metrics.add_frame(world.time(), world.objects(), tracker.get_tracks());
+    }
+    r.frame_ms /= frames;
+    r.metrics = metrics.summary();
+    r.events = static_cast<double>(tracker.stats().totals().jpda_events) / frames;
+    r.clusters = static_cast<double>(tracker.stats().totals().jpda_clusters) / frames;
+    r.truncated = static_cast<double>(tracker.stats().totals().jpda_truncated) / frames;
+    return r;
+}
+
+bool check_tracker(int num_objects, int frames) {
+    std::printf("\n%d objects, %d frames, clutter 0.5/object\n", num_objects, frames);
+    std::printf("%-8s %8s %9s %9s %10s %9s %11s %9s %9s %9s\n", "method", "GOSPA", "pos RMSE",
+                "vel RMSE", "miss rate", "false/f", "clusters/f", "events/f", "trunc/f",
+                "ms/frame");
+    const struct { const char* name; AssociationMethod method; } methods[] = {
+        {"greedy", AssociationMethod::Greedy},
+        {"optimal", AssociationMethod::Optimal},
+        {"jpda", AssociationMethod::JPDA},
+    };
+    TrackerRun runs[3];
+    for (int k = 0; k < 3; ++k) {
+        runs[k] = run_tracker(methods[k].method, num_objects, frames);
+        const MetricsSummary& s = runs[k].metrics;
+        std::printf("%-8s %8.3f %9.3f %9.3f %10.4f %9.2f %11.1f %9.1f %9.2f %9.3f\n",
+                    methods[k].name, s.gospa, s.pos_rmse, s.vel_rmse, s.miss_rate,
+                    s.false_tracks, runs[k].clusters, runs[k].events, runs[k].truncated,
+                    runs[k].frame_ms);
+    }
+    // 먼 거리 radar 는 각도 오차로 게이트가 커서 cluster 가 크다 (상당수가 k-best / cheap JPDA).
+    // 혼합 update 라 가까운 track 끼리 한 object 로 모이는 경향 (coalescence) 이 있어 위치 RMSE /
+    // miss rate 는 단일 할당보다 나쁠 수 있지만, clutter 로 생긴 false track 이 줄어 GOSPA 는 낮아야 한다
+    const MetricsSummary& j = runs[2].metrics;
+    const MetricsSummary& o = runs[1].metrics;
+    const bool ok = std::isfinite(j.gospa) && j.gospa < o.gospa &&
+                    j.false_tracks < o.false_tracks;
+    if (!ok) std::printf("  FAIL: JPDA GOSPA / false tracks not below optimal assignment\n");
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int num_objects = 500;
+    int frames = 150;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    bool ok = check_solver();
+    std::printf("\n");
+    ok = check_threads() && ok;
+    std::printf("\n");
+    ok = check_bounded() && ok;
+    ok = check_tracker(num_objects, frames) && ok;
+
+    std::printf("\n%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
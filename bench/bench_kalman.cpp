@@ -0,0 +1,100 @@
+// KalmanFilter<4> predict / update 지연 시간 + heap 할당 횟수 확인
+//
+// 전역 operator new 를 교체해 할당 횟수를 센다.
+// predict / camera update / radar EKF update 구간에서 할당이 한 번이라도 발생하면
+// 0 이 아닌 값으로 종료한다.
+
+#include <chrono>
+#include <cstdio>
+
+#include "alloc_counter.hpp"
+#include "kalman_filter.hpp"
+#include "sensor_models.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Filter = msf::KalmanFilter<4>;
+
+struct Result {
+    double ns_per_op;
+    long long allocs;
+};
+
+template <typename Fn>
+Result measure(int iterations, Fn&& fn) {
+    g_allocs.store(0);
+    g_counting.store(true);
+    auto t0 = Clock::now();
+    for (int k = 0; k < iterations; ++k) {
+        fn(k);
+    }
+    auto t1 = Clock::now();
+    g_counting.store(false);
+    return {std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations,
+            static_cast<long long>(g_allocs.load())};
+}
+
+} // namespace
+
+int main() {
+    using namespace msf;
+
+    const int iterations = 1000000;
+    const double dt = 0.1;
+
+    Filter::StateMat F = Filter::StateMat::Identity();
+    F(0, 2) = dt;
+    F(1, 3) = dt;
+    Filter::StateMat Q = Filter::StateMat::Identity() * 0.01;
+
+    Eigen::Matrix2d R_cam = Eigen::Matrix2d::Identity();
+    Eigen::Matrix3d R_rad = Eigen::Vector3d(1.0, 0.02 * 0.02, 0.25).asDiagonal();
+
+    Filter kf;
+    Filter::StateVec x0;
+    x0 << 50.0, 2.0, 20.0, 0.0;
+    kf.init(x0, Filter::StateMat::Identity() * 10.0);
+    kf.setF(F);
+    kf.setQ(Q);
+
+    volatile double sink = 0.0;
+
+    Result predict = measure(iterations, [&](int) {
+        kf.predict();
+        kf.init(x0, kf.P());  // 상태가 발산하지 않도록 x 만 되돌림
+    });
+
+    Result cam = measure(iterations, [&](int k) {
+        Eigen::Vector2d z(x0(0) + 0.1 * (k & 7), x0(1));
+        kf.update<2>(z, camera_H(), R_cam);
+        kf.predict();
+        sink = sink + kf.x()(0);
+    });
+
+    // 외부 상태 (TrackState 와 같은 방식) 에 대한 EKF 업데이트
+    Filter::StateVec x = x0;
+    Filter::StateMat P = Filter::StateMat::Identity() * 10.0;
+    Result radar = measure(iterations, [&](int k) {
+        Eigen::Vector3d z = radar_measurement(x0);
+        z(0) += 0.1 * (k & 7);
+        Eigen::Vector3d y = z - radar_measurement(x);
+        y(1) = normalize_angle(y(1));
+        Filter::update_innovation<3>(x, P, y, radar_H_jacobian(x), R_rad);
+        Filter::predict(x, P, F, Q);
+        sink = sink + x(0);
+    });
+
+    std::printf("%-24s %12s %12s\n", "kernel", "ns/op", "allocs");
+    std::printf("%-24s %12.1f %12lld\n", "predict", predict.ns_per_op, predict.allocs);
+    std::printf("%-24s %12.1f %12lld\n", "camera update+predict", cam.ns_per_op, cam.allocs);
+    std::printf("%-24s %12.1f %12lld\n", "radar update+predict", radar.ns_per_op, radar.allocs);
+
+    const long long total = predict.allocs + cam.allocs + radar.allocs;
+    if (total != 0) {
+        std::printf("FAIL: %lld heap allocations in predict/update\n", total);
+        return 1;
+    }
+    std::printf("OK: no heap allocations in predict/update\n");
+    return 0;
+}
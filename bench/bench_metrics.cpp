@@ -0,0 +1,255 @@
+// TrackMetrics (streaming GOSPA / OSPA / track 품질 지표) 확인과 처리량
+//
+//   - 작은 무작위 집합에서 GOSPA / OSPA 가 전수 탐색 최솟값과 같은지 (p = 1, 2)
+//   - 경계 경우: 같은 집합이면 0, track 이 없으면 OSPA = c
+//   - 격자로 움직이는 truth 위의 합성 track (잡음 + 누락 + false track + id 교체 + 늦은 confirm) 에서
+//     miss rate / false track / ID switch / confirm latency 가 만든 값과 맞는지
+//   - steady state 에서 add_frame 의 heap 할당이 0 인지 (메모리가 run 길이와 무관)
+//   - object 수 별 add_frame 시간
+// 하나라도 어긋나면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_metrics [max_objects]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "philox.hpp"
+#include "track_metrics.hpp"
+
+namespace {
+
+using namespace msf;
+using Clock = std::chrono::steady_clock;
+
+TrackState make_track(int id, double x, double y, double vx, double vy, bool confirmed) {
+    TrackState t;
+    t.id = id;
+    t.x << x, y, vx, vy;
+    t.confirmed = confirmed;
+    return t;
+}
+
+// 짧은 쪽을 dummy 로 채운 모든 순열에서 최소 비용 (GOSPA^p, OSPA^p * n)
+void brute_force(const std::vector<ObjectState>& truth, const std::vector<TrackState>& tracks,
+                 double c, double p, double& gospa, double& ospa) {
+    const int nx = static_cast<int>(truth.size());
+    const int ny = static_cast<int>(tracks.size());
+    const int n = std::max(nx, ny);
+    const double cp = std::pow(c, p);
+    std::vector<int> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    double best_g = 1e300, best_o = 1e300;
+    do {
+        double g = 0.0, o = 0.0;
+        for (int i = 0; i < n; ++i) {
+            const int j = perm[i];
+            if (i < nx && j < ny) {
+                const double d = std::hypot(truth[i].x - tracks[j].x(0), truth[i].y - tracks[j].x(1));
+                g += d < c ? std::pow(d, p) : cp;
+                o += std::pow(std::min(d, c), p);
+            } else if (i < nx || j < ny) {
+                g += 0.5 * cp;
+                o += cp;
+            }
+        }
+        best_g = std::min(best_g, g);
+        best_o = std::min(best_o, o);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    gospa = std::pow(best_g, 1.0 / p);
+    ospa = n > 0 ? std::pow(best_o / n, 1.0 / p) : 0.0;
+}
+
+bool near(double a, double b, double tol) { return std::abs(a - b) <= tol; }
+
+bool check_brute_force() {
+    int trials = 0, bad = 0;
+    for (double p : {1.0, 2.0}) {
+        TrackMetrics metrics(TrackMetricsParams{3.0, p});
+        for (std::uint32_t trial = 0; trial < 400; ++trial) {
+            PhiloxStream rng(7, trial, static_cast<std::uint32_t>(p), 0);
+            const int nx = static_cast<int>(rng.next_u32() % 7);
+            const int ny = static_cast<int>(rng.next_u32() % 7);
+            std::vector<ObjectState> truth(nx);
+            std::vector<TrackState> tracks;
+            for (int i = 0; i < nx; ++i) {
+                truth[i] = ObjectState{i, rng.uniform(0.0, 8.0), rng.uniform(0.0, 8.0), 0.0, 0.0};
+            }
+            for (int j = 0; j < ny; ++j) {
+                tracks.push_back(make_track(j, rng.uniform(0.0, 8.0), rng.uniform(0.0, 8.0),
+                                            0.0, 0.0, true));
+                // 미확정 track 은 지표에 들어가면 안 된다
+                tracks.push_back(make_track(100 + j, rng.uniform(0.0, 8.0),
+                                            rng.uniform(0.0, 8.0), 0.0, 0.0, false));
+            }
+            std::vector<TrackState> confirmed;
+            for (const auto& t : tracks) {
+                if (t.confirmed) confirmed.push_back(t);
+            }
+
+            double gospa = 0.0, ospa = 0.0;
+            brute_force(truth, confirmed, 3.0, p, gospa, ospa);
+            const FrameMetrics& f = metrics.add_frame(0.1 * trial, truth, tracks);
+            ++trials;
+            if (!near(f.gospa, gospa, 1e-9) || !near(f.ospa, ospa, 1e-9)) {
+                if (bad++ < 3) {
+                    std::printf("  p=%.0f trial %u (%d truths, %d tracks): gospa %.6f vs %.6f, "
+                                "ospa %.6f vs %.6f\n", p, trial, nx, ny, f.gospa, gospa, f.ospa,
+                                ospa);
+                }
+            }
+        }
+    }
+    std::printf("brute force: %d/%d frames match\n", trials - bad, trials);
+    return bad == 0;
+}
+
+bool check_edge_cases() {
+    const double c = 4.0;
+    TrackMetrics metrics(TrackMetricsParams{c, 2.0});
+    std::vector<ObjectState> truth{{0, 0.0, 0.0, 10.0, 0.0}, {1, 50.0, 3.5, 12.0, 0.0}};
+    std::vector<TrackState> tracks{make_track(3, 0.0, 0.0, 10.0, 0.0, true),
+                                   make_track(4, 50.0, 3.5, 12.0, 0.0, true)};
+    bool ok = true;
+    const FrameMetrics same = metrics.add_frame(0.0, truth, tracks);
+    ok &= same.gospa == 0.0 && same.ospa == 0.0 && same.matched == 2;
+
+    const FrameMetrics none = metrics.add_frame(0.1, truth, {});
+    ok &= near(none.gospa, std::sqrt(0.5 * c * c * 2), 1e-12) && near(none.ospa, c, 1e-12);
+
+    const FrameMetrics empty = metrics.add_frame(0.2, {}, {});
+    ok &= empty.gospa == 0.0 && empty.ospa == 0.0;
+    std::printf("edge cases: %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+struct SyntheticRun {
+    double metrics_us{0.0};       // add_frame 평균 시간
+    std::uint64_t allocs{0};      // 측정 구간 heap 할당 수
+    MetricsSummary summary;
+};
+
+// truth 에 잡음을 더한 합성 track 으로 지표 계산
+//   i % 10 == 3: track 없음 (miss), i % 20 == 5: truth 와 먼 false track 하나 추가
+//   i % 10 == 7: 처음 confirm_frames 프레임 동안 미확정, i % 10 == 0: 매 switch_every 프레임마다 새 id
+constexpr int kConfirmFrames = 5;
+constexpr int kSwitchEvery = 50;
+
+SyntheticRun run_synthetic(int num_objects, int num_frames, int warmup) {
+    const double dt = 0.1;
+    TrackMetrics metrics(TrackMetricsParams{3.0, 2.0});
+
+    // truth 가 서로 지나치면 어느 track 이 누구 것인지 모호해지므로 (TrafficScenario 는 추월이 있음)
+    // 10 m 간격 격자가 같은 속도로 움직이는 장면을 쓴다
+    std::vector<ObjectState> truth(num_objects);
+    std::vector<TrackState> tracks;
+    tracks.reserve(2 * num_objects);
+    SyntheticRun r;
+    double total_us = 0.0;
+    for (int frame = 0; frame < num_frames; ++frame) {
+        const double t = dt * (frame + 1);
+        for (int i = 0; i < num_objects; ++i) {
+            truth[i] = ObjectState{i, 10.0 * (i % 100) + 20.0 * t, 10.0 * (i / 100), 20.0, 0.0};
+        }
+        tracks.clear();
+        for (const auto& o : truth) {
+            const int i = o.id;
+            PhiloxStream rng(3, static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(frame), 0);
+            const double ex = 0.2 * rng.normal(), ey = 0.2 * rng.normal();
+            if (i % 20 == 5) {
+                tracks.push_back(make_track(2000000 + i, o.x, o.y + 1000.0, o.vx, o.vy, true));
+            }
+            if (i % 10 == 3) continue;
+            const int id = i % 10 == 0 ? i + 10000000 * (frame / kSwitchEvery) : i;
+            const bool confirmed = i % 10 != 7 || frame >= kConfirmFrames;
+            tracks.push_back(make_track(id, o.x + ex, o.y + ey, o.vx + 0.1, o.vy, confirmed));
+        }
+
+        if (frame == warmup) {
+            g_allocs.store(0);
+            g_counting.store(true);
+        }
+        const auto t0 = Clock::now();
+        metrics.add_frame(t, truth, tracks);
+        const auto t1 = Clock::now();
+        if (frame >= warmup) {
+            g_counting.store(false);
+            total_us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+            g_counting.store(true);
+        }
+    }
+    g_counting.store(false);
+    r.allocs = g_allocs.load();
+    r.metrics_us = total_us / std::max(1, num_frames - warmup);
+    r.summary = metrics.summary();
+    return r;
+}
+
+bool check_synthetic() {
+    const int n = 2000;
+    const int frames = 200;
+    const SyntheticRun r = run_synthetic(n, frames, 20);
+    const MetricsSummary& s = r.summary;
+
+    // 미확정 프레임 동안 i % 10 == 7 도 miss 로 센다
+    const double expect_miss =
+        (0.1 * frames + 0.1 * kConfirmFrames) / frames;
+    const double expect_false = n / 20.0;
+    const std::uint64_t expect_switches =
+        static_cast<std::uint64_t>(n / 10) * ((frames - 1) / kSwitchEvery);
+    const double dt = 0.1;
+    const double expect_latency = (0.1 * kConfirmFrames * dt) / 0.9;   // confirm 되는 truth 평균
+
+    bool ok = true;
+    ok &= near(s.miss_rate, expect_miss, 1e-9);
+    ok &= near(s.false_tracks, expect_false, 1e-9);
+    ok &= s.id_switches == expect_switches;
+    ok &= near(s.confirm_latency, expect_latency, 1e-9);
+    ok &= near(s.confirm_latency_max, kConfirmFrames * dt, 1e-9);
+    ok &= s.truths_seen == n && s.truths_confirmed == n - n / 10;
+    ok &= near(s.pos_rmse, 0.2 * std::sqrt(2.0), 0.01) && near(s.vel_rmse, 0.1, 1e-9);
+    ok &= r.allocs == 0;
+
+    std::printf("synthetic (%d objects, %d frames):\n", n, frames);
+    std::printf("  miss %.4f (expect %.4f)  false/frame %.2f (%.2f)  id switches %llu (%llu)\n",
+                s.miss_rate, expect_miss, s.false_tracks, expect_false,
+                static_cast<unsigned long long>(s.id_switches),
+                static_cast<unsigned long long>(expect_switches));
+    std::printf("  confirm latency %.4f s (%.4f) max %.2f s  confirmed %d/%d\n", s.confirm_latency,
+                expect_latency, s.confirm_latency_max, s.truths_confirmed, s.truths_seen);
+    std::printf("  pos rmse %.4f m  vel rmse %.4f m/s  gospa %.3f  ospa %.3f\n", s.pos_rmse,
+                s.vel_rmse, s.gospa, s.ospa);
+    std::printf("  heap allocs after warmup: %llu\n", static_cast<unsigned long long>(r.allocs));
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int max_objects = 100000;
+    if (argc >= 2) max_objects = std::stoi(argv[1]);
+
+    bool ok = true;
+    ok &= check_brute_force();
+    ok &= check_edge_cases();
+    ok &= check_synthetic();
+
+    std::printf("\n%10s %14s %14s\n", "objects", "add_frame [us]", "ns/object");
+    for (int n = 1000; n <= max_objects; n *= 10) {
+        const SyntheticRun r = run_synthetic(n, 60, 10);
+        std::printf("%10d %14.1f %14.1f\n", n, r.metrics_us, 1000.0 * r.metrics_us / n);
+    }
+
+    if (!ok) {
+        std::printf("FAIL: track metrics check failed\n");
+        return 1;
+    }
+    return 0;
+}
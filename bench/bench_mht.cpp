@@ -0,0 +1,463 @@
+// MhtEngine (track-oriented MHT) 확인과 tracker 비교
+//
+//   - 합성 1차원 장면에서 scan 마다 hypothesis 수 / node pool 사용량이 상한 안인지,
+//     tree id / best track 순서가 맞는지, node pool 이 작으면 leaf 를 버려서라도 상한을 지키는지
+//   - 스레드 1 / 2 / 4 의 engine 결과가 bit 단위로 같은지
+//   - 시간 예산이 걸리면 cluster 가 greedy 로 끝나고 (degraded) 프레임 시간이 줄어드는지
+//   - 서로 교차하는 target 쌍 장면에서 Greedy / Optimal / JPDA / MHT 의 ID switch / GOSPA
+//   - clutter 가 많은 traffic 장면에서 같은 비교와 프레임당 hypothesis 수 / 시간
+//   - update_tracks() 입력도 MhtEngine 을 거쳐 한 번 보인 object 는 max_missed 뒤 사라지고,
+//     계속 보이는 object 는 id 를 유지하며 이어지는 update() 와도 연결되는지
+// 하나라도 어긋나면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_mht [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mht.hpp"
+#include "parallel_sensor_simulator.hpp"
+#include "track_metrics.hpp"
+#include "tracker.hpp"
+#include "traffic_scenario.hpp"
+
+namespace {
+
+using namespace msf;
+using Clock = std::chrono::steady_clock;
+
+// 합성 장면: 직선 위 target (random walk) 과 clutter, leaf 상태는 x(0) 만 쓴다
+struct SyntheticScan {
+    std::vector<GateCandidate> candidates;
+    std::vector<double> likelihood;
+    std::vector<TrackState> posterior;
+    std::vector<TrackState> births;
+};
+
+void make_scan(std::mt19937& rng, std::vector<double>& targets, const MhtEngine& mht,
+               SyntheticScan& s) {
+    std::normal_distribution<double> noise(0.0, 0.5);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    const double extent = 10.0 * targets.size();
+    std::vector<double> dets;
+    for (double& x : targets) {
+        x += noise(rng);
+        if (u(rng) < 0.9) dets.push_back(x + noise(rng));
+        if (u(rng) < 0.5) dets.push_back(u(rng) * extent);
+    }
+
+    s.births.assign(dets.size(), TrackState{});
+    for (size_t j = 0; j < dets.size(); ++j) {
+        s.births[j].x(0) = dets[j];
+    }
+    s.candidates.clear();
+    s.likelihood.clear();
+    s.posterior.clear();
+    const auto& leaves = mht.leaves();
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        for (size_t j = 0; j < dets.size(); ++j) {
+            const double d = dets[j] - leaves[i].x(0);
+            if (d * d > 9.0) continue;
+            s.candidates.push_back({static_cast<int>(i), static_cast<int>(j), d * d});
+            s.likelihood.push_back(0.9 * std::exp(-0.5 * d * d) / (std::sqrt(2.0 * M_PI) * 0.01));
+            TrackState post = leaves[i];
+            post.x(0) = 0.5 * (leaves[i].x(0) + dets[j]);
+            s.posterior.push_back(post);
+        }
+    }
+}
+
+struct EngineRun {
+    bool ok{true};
+    std::vector<int> best_ids;       // scan 마다 best track id 를 이어 붙인 것
+    std::vector<double> best_x;
+    int max_leaves{0};
+    int max_nodes{0};
+    int dropped{0};
+    int truncated{0};
+    int degraded{0};
+    int clusters{0};
+    double ms{0.0};
+};
+
+EngineRun run_engine(const TrackerParams& params, int threads, int n_targets, int scans) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(0.0, 10.0 * n_targets);
+    std::vector<double> targets(n_targets);
+    for (double& x : targets) x = u(rng);
+
+    ThreadPool pool(threads);
+    MhtEngine mht(params);
+    SyntheticScan s;
+    EngineRun r;
+    for (int k = 0; k < scans; ++k) {
+        make_scan(rng, targets, mht, s);
+        const auto t0 = Clock::now();
+        mht.update(s.candidates, s.likelihood, s.posterior, s.births, pool);
+        r.ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+        const MhtStats& st = mht.stats();
+        const auto& leaves = mht.leaves();
+        const auto& best = mht.best_tracks();
+        r.max_leaves = std::max(r.max_leaves, st.leaves);
+        r.max_nodes = std::max(r.max_nodes, st.nodes);
+        r.dropped += st.dropped;
+        r.truncated += st.truncated;
+        r.degraded += st.degraded;
+        r.clusters += st.clusters;
+
+        // leaf 는 tree id 순서, tree 별 leaf 수 상한, 사용 node 는 pool 안
+        int run = 0;
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            run = (i > 0 && leaves[i].id == leaves[i - 1].id) ? run + 1 : 1;
+            if ((i > 0 && leaves[i].id < leaves[i - 1].id) ||
+                run > params.mht_max_leaves_per_track) {
+                r.ok = false;
+            }
+        }
+        if (st.nodes > static_cast<int>(mht.node_capacity()) || st.leaves > st.nodes ||
+            st.leaves != static_cast<int>(leaves.size())) {
+            r.ok = false;
+        }
+        // best track 은 tree 당 하나, id 오름차순, 모두 살아 있는 leaf
+        for (size_t i = 0; i < best.size(); ++i) {
+            if (i > 0 && best[i].id <= best[i - 1].id) r.ok = false;
+            const bool alive = std::any_of(leaves.begin(), leaves.end(), [&](const TrackState& t) {
+                return t.id == best[i].id && t.x(0) == best[i].x(0);
+            });
+            if (!alive) r.ok = false;
+            r.best_ids.push_back(best[i].id);
+            r.best_x.push_back(best[i].x(0));
+        }
+        r.best_ids.push_back(-1);
+    }
+    return r;
+}
+
+bool check_engine() {
+    TrackerParams params;
+    params.mht_n_scan = 3;
+    params.mht_k_best = 8;
+    params.mht_max_leaves_per_track = 8;
+    const int n_targets = 2000;
+    const int scans = 40;
+    bool ok = true;
+
+    // 스레드 수와 무관
+    EngineRun ref;
+    for (int threads : {1, 2, 4}) {
+        const EngineRun r = run_engine(params, threads, n_targets, scans);
+        std::printf("synthetic threads=%d  max leaves=%d max nodes=%d/%d clusters/scan=%.0f "
+                    "truncated=%d  %.2f ms/scan\n",
+                    threads, r.max_leaves, r.max_nodes, params.mht_max_nodes,
+                    static_cast<double>(r.clusters) / scans, r.truncated, r.ms / scans);
+        if (!r.ok) {
+            std::printf("  FAIL: hypothesis / pool invariant violated\n");
+            ok = false;
+        }
+        if (threads == 1) {
+            ref = r;
+        } else if (r.best_ids != ref.best_ids || r.best_x != ref.best_x) {
+            std::printf("  FAIL: result differs from 1 thread\n");
+            ok = false;
+        }
+    }
+    // leaf 수 상한: tree (target + 살아 있는 clutter tree) 당 max_leaves_per_track
+    if (ref.max_leaves > params.mht_max_leaves_per_track * 4 * n_targets) {
+        std::printf("  FAIL: hypothesis count not bounded\n");
+        ok = false;
+    }
+
+    // node pool 이 모자라면 최적 hypothesis 밖의 leaf 를 버리고 상한을 지킨다
+    TrackerParams small = params;
+    small.mht_max_nodes = 6000;
+    const EngineRun r = run_engine(small, 1, n_targets, scans);
+    std::printf("pool %d nodes      max nodes=%d dropped=%d\n", small.mht_max_nodes,
+                r.max_nodes, r.dropped);
+    if (!r.ok || r.max_nodes > small.mht_max_nodes || r.dropped == 0) {
+        std::printf("  FAIL: node pool limit not enforced\n");
+        ok = false;
+    }
+
+    // 시간 예산을 넘기면 남은 cluster 는 greedy 하나로 끝낸다
+    TrackerParams budget = params;
+    budget.mht_time_budget_ms = 1e-6;
+    budget.mht_k_best = 64;
+    budget.mht_max_search_nodes = 100000;
+    TrackerParams full = budget;
+    full.mht_time_budget_ms = 0.0;
+    const EngineRun rf = run_engine(full, 1, n_targets, scans);
+    const EngineRun rb = run_engine(budget, 1, n_targets, scans);
+    std::printf("k_best=64 no budget  %.2f ms/scan degraded=%d | budget %.0e ms  %.2f ms/scan "
+                "degraded=%d/%d\n",
+                rf.ms / scans, rf.degraded, budget.mht_time_budget_ms, rb.ms / scans,
+                rb.degraded, rb.clusters);
+    if (!rb.ok || rf.degraded != 0 || rb.degraded < rb.clusters / 2 || rb.ms >= rf.ms) {
+        std::printf("  FAIL: time budget not applied\n");
+        ok = false;
+    }
+    return ok;
+}
+
+// target 두 개가 X 자로 교차하는 쌍을 격자로 배치 (dt 0.1 s, 중간 시각에 같은 위치)
+std::vector<ObjectState> crossing_objects(int n_pairs, double t, double duration) {
+    std::vector<ObjectState> objects;
+    for (int k = 0; k < n_pairs; ++k) {
+        const double cx = 60.0 + 80.0 * (k % 5);
+        const double cy = -45.0 + 25.0 * (k / 5);
+        const double vy = 0.8 + 0.1 * (k % 4);       // 교차 각도를 조금씩 다르게
+        const double s = t - 0.5 * duration;
+        ObjectState a{2 * k, cx + 10.0 * s, cy + vy * s, 10.0, vy};
+        ObjectState b{2 * k + 1, cx + 10.0 * s, cy - vy * s, 10.0, -vy};
+        objects.push_back(a);
+        objects.push_back(b);
+    }
+    return objects;
+}
+
+struct TrackerRun {
+    MetricsSummary metrics;
+    double frame_ms{0.0};
+    double hypotheses{0.0};
+    double clusters{0.0};
+    double truncated{0.0};
+};
+
+TrackerParams tracker_params(AssociationMethod method, double clutter_density) {
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.association_method = method;
+    params.detection_prob = 0.9;
+    params.camera_clutter_density = clutter_density;
+    return params;
+}
+
+TrackerRun run_crossing(AssociationMethod method, int n_pairs) {
+    constexpr double kDuration = 8.0;
+    constexpr double kClutterRate = 0.5;
+    ParallelSensorSimulator sensor(1.0, 1.0, 0.02, 0.5, 0.9, kClutterRate, 91, 1);
+    sensor.set_clutter_region(0.0, 450.0, -60.0, 60.0);
+    const double density = kClutterRate * 2 * n_pairs / (450.0 * 120.0);
+    // MHT 는 센서 pass 단위로 처리하므로 비교 대상도 Sequential 로 맞춘다
+    TrackerParams params = tracker_params(method, density);
+    params.fusion_mode = FusionMode::Sequential;
+    MultiSensorTracker tracker(params);
+    TrackMetrics metrics(TrackMetricsParams{5.0, 2.0});
+
+    DetectionBatch batch;
+    TrackerRun r;
+    const int frames = static_cast<int>(kDuration / 0.1);
+    for (int step = 1; step <= frames; ++step) {
+        const double t = 0.1 * step;
+        const auto objects = crossing_objects(n_pairs, t, kDuration);
+        sensor.generate(objects, t, batch);
+        const auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(batch);
+        r.frame_ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        metrics.add_frame(t, objects, tracker.get_tracks());
+    }
+    r.frame_ms /= frames;
+    r.metrics = metrics.summary();
+    return r;
+}
+
+TrackerRun run_traffic(AssociationMethod method, int num_objects, int frames,
+                       double time_budget_ms) {
+    constexpr double kClutterRate = 0.5;   // object 당 clutter detection 수
+    TrafficParams traffic;
+    traffic.num_objects = num_objects;
+    traffic.seed = 5;
+    TrafficScenario world(traffic);
+    ParallelSensorSimulator sensor(1.0, 1.0, 0.02, 0.5, 0.9, kClutterRate, 77, 1);
+    sensor.set_clutter_region(world.x_min(), world.x_max(), world.y_min(), world.y_max());
+    const double area = (world.x_max() - world.x_min()) * (world.y_max() - world.y_min());
+
+    TrackerParams params = tracker_params(method, kClutterRate * num_objects / area);
+    params.mht_time_budget_ms = time_budget_ms;
+    MultiSensorTracker tracker(params);
+    TrackMetrics metrics(TrackMetricsParams{5.0, 2.0});
+
+    DetectionBatch batch;
+    TrackerRun r;
+    const int warmup = 20;
+    for (int step = 0; step < warmup + frames; ++step) {
+        world.step();
+        sensor.generate(world.objects(), world.time(), batch);
+        if (step == warmup) tracker.stats().reset();
+        const auto t0 = Clock::now();
+        tracker.predict(world.time());
+        tracker.update(batch);
+        const auto t1 = Clock::now();
+        if (step < warmup) continue;
+        r.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        metrics.add_frame(world.time(), world.objects(), tracker.get_tracks());
+    }
+    r.frame_ms /= frames;
+    r.metrics = metrics.summary();
+    const auto& totals = tracker.stats().totals();
+    r.hypotheses = static_cast<double>(totals.mht_hypotheses) / frames;
+    r.clusters = static_cast<double>(totals.mht_clusters) / frames;
+    r.truncated = static_cast<double>(totals.mht_truncated) / frames;
+    return r;
+}
+
+const struct {
+    const char* name;
+    AssociationMethod method;
+} kMethods[] = {
+    {"greedy", AssociationMethod::Greedy},
+    {"optimal", AssociationMethod::Optimal},
+    {"jpda", AssociationMethod::JPDA},
+    {"mht", AssociationMethod::MHT},
+};
+
+bool check_crossing() {
+    const int n_pairs = 20;
+    std::printf("\ncrossing pairs=%d, clutter 0.5/object, sequential fusion\n", n_pairs);
+    std::printf("%-8s %8s %9s %10s %9s %10s %9s\n", "method", "GOSPA", "pos RMSE", "miss rate",
+                "false/f", "ID switch", "ms/frame");
+    TrackerRun runs[4];
+    for (int k = 0; k < 4; ++k) {
+        runs[k] = run_crossing(kMethods[k].method, n_pairs);
+        const MetricsSummary& s = runs[k].metrics;
+        std::printf("%-8s %8.3f %9.3f %10.4f %9.2f %10llu %9.3f\n", kMethods[k].name, s.gospa,
+                    s.pos_rmse, s.miss_rate, s.false_tracks,
+                    static_cast<unsigned long long>(s.id_switches), runs[k].frame_ms);
+    }
+    // 교차 구간에서 association 을 N scan 미뤄 두므로 ID switch 가 단일 할당보다 많지 않아야 한다
+    const MetricsSummary& m = runs[3].metrics;
+    const MetricsSummary& o = runs[1].metrics;
+    const bool ok = std::isfinite(m.gospa) && m.id_switches <= o.id_switches && m.gospa < o.gospa;
+    if (!ok) std::printf("  FAIL: MHT ID switches / GOSPA not better than optimal assignment\n");
+
+    return ok;
+}
+
+bool check_traffic(int num_objects, int frames) {
+    std::printf("\n%d objects, %d frames, clutter 0.5/object\n", num_objects, frames);
+    std::printf("%-10s %8s %9s %10s %9s %10s %8s %11s %8s %9s\n", "method", "GOSPA", "pos RMSE",
+                "miss rate", "false/f", "ID switch", "hyp/f", "clusters/f", "trunc/f",
+                "ms/frame");
+    TrackerRun runs[5];
+    for (int k = 0; k < 5; ++k) {
+        // 마지막은 MHT + 프레임 시간 예산 (MHT 기본 실행 시간의 절반)
+        const bool budget = k == 4;
+        const double budget_ms = budget ? 0.5 * runs[3].frame_ms : 0.0;
+        runs[k] = run_traffic(kMethods[budget ? 3 : k].method, num_objects, frames, budget_ms);
+        const MetricsSummary& s = runs[k].metrics;
+        std::printf("%-10s %8.3f %9.3f %10.4f %9.2f %10llu %8.0f %11.1f %8.2f %9.3f\n",
+                    budget ? "mht+budget" : kMethods[k].name, s.gospa, s.pos_rmse, s.miss_rate,
+                    s.false_tracks, static_cast<unsigned long long>(s.id_switches),
+                    runs[k].hypotheses, runs[k].clusters, runs[k].truncated, runs[k].frame_ms);
+    }
+    const MetricsSummary& m = runs[3].metrics;
+    const MetricsSummary& o = runs[1].metrics;
+    bool ok = std::isfinite(m.gospa) && m.gospa < o.gospa && m.false_tracks < o.false_tracks;
+    if (!ok) std::printf("  FAIL: MHT GOSPA / false tracks not below optimal assignment\n");
+    // hypothesis 수는 tree 당 leaf 상한으로 bounded (object + clutter tree 수에 비례)
+    const TrackerParams defaults;
+    if (runs[3].hypotheses > defaults.mht_max_leaves_per_track * 3.0 * num_objects) {
+        std::printf("  FAIL: hypothesis count not bounded\n");
+        ok = false;
+    }
+    if (!std::isfinite(runs[4].metrics.gospa) || runs[4].truncated <= 0.0) {
+        std::printf("  FAIL: time budget did not degrade any cluster\n");
+        ok = false;
+    }
+    return ok;
+}
+
+bool check_update_tracks() {
+    constexpr int kFrames = 20;
+    TrackerParams params = tracker_params(AssociationMethod::MHT, 1e-4);
+    params.max_missed = 5;
+    MultiSensorTracker tracker(params);
+
+    // 계속 보이는 object 하나 + 프레임마다 한 번만 보이는 먼 object
+    std::vector<SensorTrack> objects(2);
+    for (auto& o : objects) {
+        o.P.diagonal() << 0.25, 0.25, 0.5, 0.5;
+    }
+    size_t max_tracks = 0;
+    int steady_id = -1;
+    bool steady_kept = true;
+    for (int step = 1; step <= kFrames; ++step) {
+        const double t = 0.1 * step;
+        objects[0].x << 10.0 * t, 0.0, 10.0, 0.0;
+        objects[1].x << 1000.0 + 100.0 * step, 500.0, 0.0, 0.0;
+        for (auto& o : objects) {
+            o.timestamp = t;
+        }
+        tracker.predict(t);
+        tracker.update_tracks(objects);
+        max_tracks = std::max(max_tracks, tracker.get_tracks().size());
+        const auto& tracks = tracker.get_tracks();
+        const auto it = std::find_if(tracks.begin(), tracks.end(), [&](const TrackState& tr) {
+            return std::abs(tr.x(0) - objects[0].x(0)) < 1.0 && std::abs(tr.x(1)) < 1.0;
+        });
+        // 새 tree 는 best hypothesis 에 들기까지 몇 scan 걸릴 수 있다
+        if (step <= params.mht_n_scan) continue;
+        if (it == tracks.end()) {
+            steady_kept = false;
+        } else {
+            if (steady_id < 0) steady_id = it->id;
+            steady_kept = steady_kept && it->id == steady_id;
+        }
+    }
+
+    // 이어지는 detection 프레임 (계속 보이는 object 의 camera 측정만)
+    const double t = 0.1 * (kFrames + 1);
+    std::vector<Detection> dets(1);
+    dets[0].sensor = SensorType::Camera;
+    dets[0].z = MeasVec(2);
+    dets[0].z << 10.0 * t, 0.0;
+    dets[0].timestamp = t;
+    tracker.predict(t);
+    tracker.update(dets);
+    const auto& tracks = tracker.get_tracks();
+    const bool kept_after_update =
+        std::any_of(tracks.begin(), tracks.end(), [&](const TrackState& tr) {
+            return tr.id == steady_id && std::abs(tr.x(0) - 10.0 * t) < 1.0;
+        });
+
+    std::printf("\nupdate_tracks: %d frames, max tracks %zu, steady id kept %s, "
+                "after update() %zu tracks\n",
+                kFrames, max_tracks, steady_kept && kept_after_update ? "yes" : "no",
+                tracks.size());
+    // 한 번 보인 object 는 max_missed 번 놓친 뒤 삭제되어야 한다 (+1: 계속 보이는 object)
+    bool ok = true;
+    if (max_tracks > static_cast<size_t>(params.max_missed + 2)) {
+        std::printf("  FAIL: single-shot objects are not deleted\n");
+        ok = false;
+    }
+    if (!steady_kept || !kept_after_update) {
+        std::printf("  FAIL: fused track lost or renumbered\n");
+        ok = false;
+    }
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int num_objects = 500;
+    int frames = 150;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    bool ok = check_engine();
+    ok = check_crossing() && ok;
+    ok = check_traffic(num_objects, frames) && ok;
+    ok = check_update_tracks() && ok;
+
+    std::printf("\n%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
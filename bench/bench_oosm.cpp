@@ -0,0 +1,167 @@
+// out-of-sequence measurement 처리 비교
+//
+// radar detection 이 delay 프레임 늦게 도착하는 상황에서 세 가지 방식을 비교한다.
+//   in-order : 지연 없음, 같은 프레임에서 camera → radar 순서로 update (기준)
+//   naive    : 늦은 radar 를 현재 측정인 것처럼 그대로 융합
+//   oosm     : oosm_history_size > 0, 늦은 radar 를 rewind-and-replay 로 반영
+// 지표는 각 ground truth object 와 가장 가까운 confirmed track 사이 위치 오차 평균
+// (cap_m 에서 자름). oosm 이 naive 보다 나쁘면 0 이 아닌 값으로 종료한다.
+// 늦은 detection 만 든 batch 를 여러 번 재전송해도 track 의 missed 가 늘지 않는지도 확인한다.
+//
+// 사용법: bench_oosm [num_objects] [frames] [delay_frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+enum class Mode { InOrder, Naive, Oosm };
+
+struct RunResult {
+    double pos_err{0.0};
+    double frame_ms{0.0};
+};
+
+RunResult run(Mode mode, int num_objects, int frames, int delay) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.oosm_history_size = (mode == Mode::Oosm) ? 2 * delay + 4 : 0;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch all, camera, radar;
+    std::deque<DetectionBatch> radar_queue;
+
+    RunResult result;
+    const int warmup = 20;
+    int measured = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, all);
+
+        camera.clear();
+        radar.clear();
+        for (size_t j = 0; j < all.size(); ++j) {
+            (all.sensor(j) == SensorType::Camera ? camera : radar).push_back(all.at(j));
+        }
+
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        if (mode == Mode::InOrder) {
+            tracker.update(camera);
+            tracker.update(radar);
+        } else {
+            // camera 는 즉시, radar 는 delay 프레임 뒤 도착
+            radar_queue.push_back(radar);
+            tracker.update(camera);
+            if (static_cast<int>(radar_queue.size()) > delay) {
+                tracker.update(radar_queue.front());
+                radar_queue.pop_front();
+            }
+        }
+        auto t1 = Clock::now();
+
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.pos_err += frame_error(scenario.objects(), tracker.get_tracks());
+            ++measured;
+        }
+    }
+    result.frame_ms /= measured;
+    result.pos_err /= measured;
+    return result;
+}
+
+// 정상 추적 중에 지난 프레임의 radar batch 만 반복해서 다시 넣는다 (재전송 패킷).
+// 현재 프레임의 미검출이 아니므로 track 은 그대로 남고 missed 도 늘지 않아야 한다
+// (replay 에서 그 detection 을 새로 얻은 track 은 missed 가 줄 수 있다)
+bool late_only_keeps_tracks(int num_objects) {
+    using namespace msf;
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.oosm_history_size = 8;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch all, late;
+    for (int step = 0; step < 30; ++step) {
+        scenario.step();
+        sensor_sim.generate(scenario.objects(), scenario.time(), all);
+        tracker.predict(scenario.time());
+        tracker.update(all);
+        if (step == 27) {
+            for (size_t j = 0; j < all.size(); ++j) {
+                if (all.sensor(j) == SensorType::Radar) late.push_back(all.at(j));
+            }
+        }
+    }
+
+    const std::vector<TrackState> before = tracker.get_tracks();
+    for (int k = 0; k < 2 * params.max_missed + 2; ++k) {
+        tracker.update(late);
+    }
+    const std::vector<TrackState> after = tracker.get_tracks();
+
+    bool same = before.size() == after.size();
+    for (size_t i = 0; same && i < before.size(); ++i) {
+        same = before[i].id == after[i].id && after[i].missed <= before[i].missed;
+    }
+    std::printf("late-only retransmission keeps tracks: %s (%zu -> %zu)\n",
+                same ? "yes" : "NO", before.size(), after.size());
+    return same;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int num_objects = 20;
+    int frames = 300;
+    int delay = 2;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+    if (argc >= 4) delay = std::stoi(argv[3]);
+
+    std::printf("objects=%d frames=%d radar delay=%d frames\n", num_objects, frames, delay);
+    std::printf("%-10s %14s %12s\n", "mode", "mean err [m]", "ms/frame");
+
+    const RunResult in_order = run(Mode::InOrder, num_objects, frames, delay);
+    const RunResult naive = run(Mode::Naive, num_objects, frames, delay);
+    const RunResult oosm = run(Mode::Oosm, num_objects, frames, delay);
+
+    std::printf("%-10s %14.3f %12.3f\n", "in-order", in_order.pos_err, in_order.frame_ms);
+    std::printf("%-10s %14.3f %12.3f\n", "naive", naive.pos_err, naive.frame_ms);
+    std::printf("%-10s %14.3f %12.3f\n", "oosm", oosm.pos_err, oosm.frame_ms);
+
+    const bool late_ok = late_only_keeps_tracks(num_objects);
+
+    if (!late_ok) {
+        std::printf("FAIL: late-only batch aged tracks\n");
+        return 1;
+    }
+    if (oosm.pos_err > naive.pos_err) {
+        std::printf("FAIL: OOSM error is larger than naive late fusion\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+// AoS (track 별 F, Q 재계산) vs SoA batched predict 벤치마크
+//
+// 사용법: bench_predict [n_tracks ...]
+//   기본값: 100 1000 10000 100000
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "kalman_filter.hpp"
+#include "track_store.hpp"
+#include "tracker.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// tracker.cpp 의 AoS predict 와 같은 방식 (track 마다 F, Q 구성)
+void predict_aos(std::vector<msf::TrackState>& tracks, double timestamp, double sigma_a) {
+    using namespace msf;
+    for (auto& track : tracks) {
+        double dt = timestamp - track.last_timestamp;
+        if (dt <= 0.0) dt = 1e-3;
+
+        Mat4 F = Mat4::Identity();
+        F(0, 2) = dt;
+        F(1, 3) = dt;
+
+        const double dt2 = dt * dt;
+        const double dt3 = dt2 * dt;
+        const double dt4 = dt3 * dt;
+        Mat4 Q = Mat4::Zero();
+        Q(0, 0) = Q(1, 1) = dt4 / 4.0;
+        Q(0, 2) = Q(2, 0) = Q(1, 3) = Q(3, 1) = dt3 / 2.0;
+        Q(2, 2) = Q(3, 3) = dt2;
+        Q *= sigma_a * sigma_a;
+
+        KalmanFilter<4>::predict(track.x, track.P, F, Q);
+        track.last_timestamp = timestamp;
+    }
+}
+
+template <typename Fn>
+double time_us(int reps, Fn&& fn) {
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; ++r) {
+        fn(r);
+    }
+    auto t1 = Clock::now();
+    return std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace msf;
+
+    std::vector<int> sizes = {100, 1000, 10000, 100000};
+    if (argc >= 2) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) {
+            sizes.push_back(std::stoi(argv[i]));
+        }
+    }
+
+    const double dt = 0.1;
+    const double sigma_a = 1.0;
+
+    std::printf("SoA kernel backend: %s\n", TrackStoreSoA::simd_backend());
+    std::printf("%8s | %12s %12s %8s | %14s %14s | %10s\n",
+                "tracks", "AoS [us]", "SoA [us]", "speedup",
+                "tracker AoS", "tracker SoA", "max |dx|");
+
+    for (int n : sizes) {
+        std::mt19937 rng(n);
+        std::normal_distribution<double> noise(0.0, 5.0);
+
+        std::vector<TrackState> aos(n);
+        TrackStoreSoA soa;
+        soa.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto& t = aos[i];
+            t.x << noise(rng), noise(rng), noise(rng), noise(rng);
+            Mat4 A = Mat4::Random();
+            t.P = A * A.transpose() + Mat4::Identity();
+            t.last_timestamp = dt;
+            soa.push_back(t.x, t.P, t.last_timestamp);
+        }
+
+        const int reps = n >= 100000 ? 20 : 200;
+        const double t_aos = time_us(reps, [&](int r) { predict_aos(aos, dt * (r + 2), sigma_a); });
+        const double t_soa = time_us(reps, [&](int r) { soa.predict(dt * (r + 2), sigma_a); });
+
+        // 두 경로의 결과 비교
+        double max_diff = 0.0;
+        for (int i = 0; i < n; ++i) {
+            Vec4 x;
+            Mat4 P;
+            soa.load(i, x, P);
+            max_diff = std::max(max_diff, (x - aos[i].x).cwiseAbs().maxCoeff());
+        }
+
+        // tracker 단위 (SoA 모드는 AoS view 갱신 비용 포함)
+        double t_tracker[2];
+        for (int mode = 0; mode < 2; ++mode) {
+            TrackerParams params;
+            params.track_storage = mode == 0 ? TrackStorage::AoS : TrackStorage::SoA;
+            MultiSensorTracker tracker(params);
+
+            std::vector<Detection> dets(n);
+            for (int i = 0; i < n; ++i) {
+                dets[i].sensor = SensorType::Camera;
+                dets[i].timestamp = dt;
+                dets[i].z = Eigen::Vector2d(noise(rng), noise(rng));
+            }
+            tracker.update(dets);
+
+            t_tracker[mode] = time_us(reps, [&](int r) { tracker.predict(dt * (r + 2)); });
+        }
+
+        std::printf("%8d | %12.1f %12.1f %7.1fx | %14.1f %14.1f | %10.2e\n",
+                    n, t_aos, t_soa, t_aos / t_soa,
+                    t_tracker[0], t_tracker[1], max_diff);
+    }
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+// radar 예측 측정 / Jacobian: track 별 scalar 함수 vs SoA batch kernel
+//
+// 1) 정확도: radar_measurement / radar_H_jacobian (std::atan2, 나눗셈) 과 batch kernel 결과의
+//    최대 오차를 확인한다. phi 는 radar_atan2_max_error() 이하, 나머지는 상대 1e-12 이하여야 하고,
+//    branch-free normalize_angle 은 while 루프 기준과 1e-12 이내, h(x) 전용 kernel 과 track 하나씩 호출한
+//    결과 (SIMD 꼬리 경로) 는 bit 단위로 같아야 한다. 넘으면 0 이 아닌 값으로 종료.
+// 2) 처리량: n 개 track 의 h(x) + H 계산 시간
+//
+// 사용법: bench_radar [n_tracks ...]
+//   기본값: 1000 10000 100000
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "radar_batch.hpp"
+#include "sensor_models.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct States {
+    msf::AlignedDoubles px, py, vx, vy;
+    std::vector<msf::Vec4> aos;
+};
+
+// 도로 위 일반적인 분포 + 원점 근처 / 축 위 / 뒤쪽 등 경계 사례
+States make_states(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> pos(-300.0, 300.0);
+    std::uniform_real_distribution<double> vel(-40.0, 40.0);
+    std::uniform_real_distribution<double> tiny(-1e-3, 1e-3);
+
+    States s;
+    s.px.resize(n);
+    s.py.resize(n);
+    s.vx.resize(n);
+    s.vy.resize(n);
+    s.aos.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double x = pos(rng), y = pos(rng);
+        switch (i % 16) {
+        case 0: x = tiny(rng); y = tiny(rng); break;   // 특이점 근처
+        case 1: y = 0.0; break;                         // x 축
+        case 2: x = 0.0; break;                         // y 축
+        case 3: y = x; break;                           // 대각선 (|x| == |y|)
+        case 4: y = -0.0; x = -std::fabs(x); break;     // 뒤쪽 (phi = -pi)
+        default: break;
+        }
+        s.px[i] = x;
+        s.py[i] = y;
+        s.vx[i] = vel(rng);
+        s.vy[i] = vel(rng);
+        s.aos[i] << x, y, s.vx[i], s.vy[i];
+    }
+    return s;
+}
+
+double rel_err(double a, double b) {
+    return std::fabs(a - b) / std::max(1.0, std::fabs(b));
+}
+
+// 기존 while 루프 방식 (기준)
+double normalize_angle_loop(double angle) {
+    while (angle > M_PI) angle -= 2.0 * M_PI;
+    while (angle < -M_PI) angle += 2.0 * M_PI;
+    return angle;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace msf;
+
+    std::vector<std::size_t> sizes = {1000, 10000, 100000};
+    if (argc >= 2) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) {
+            sizes.push_back(static_cast<std::size_t>(std::stoul(argv[i])));
+        }
+    }
+
+    std::printf("radar batch kernel: %s\n", radar_batch_backend());
+
+    // ---------------------------------------------------------------- 정확도
+    // kernel 폭 (4, 8) 으로 나누어떨어지지 않는 크기로 scalar 꼬리 처리도 함께 확인
+    const std::size_t n_check = 100003;
+    const States s = make_states(n_check, 1);
+    RadarPredictionSoA out;
+    out.resize(n_check);
+    radar_predict_batch(s.px.data(), s.py.data(), s.vx.data(), s.vy.data(), 0, n_check, out);
+
+    double err_rho = 0.0, err_phi = 0.0, err_rho_dot = 0.0, err_H = 0.0;
+    for (std::size_t i = 0; i < n_check; ++i) {
+        const Eigen::Vector3d z = radar_measurement(s.aos[i]);
+        const Eigen::Matrix<double, 3, 4> H = radar_H_jacobian(s.aos[i]);
+        const Eigen::Matrix<double, 3, 4> Hb = out.H(i);
+
+        err_rho = std::max(err_rho, rel_err(out.rho[i], z(0)));
+        err_phi = std::max(err_phi, std::fabs(normalize_angle(out.phi[i] - z(1))));
+        err_rho_dot = std::max(err_rho_dot, rel_err(out.rho_dot[i], z(2)));
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                err_H = std::max(err_H, rel_err(Hb(r, c), H(r, c)));
+            }
+        }
+    }
+
+    // h(x) 만 계산하는 kernel 은 같은 식이므로 bit 단위로 같아야 한다
+    std::vector<double> m_rho(n_check), m_phi(n_check), m_rho_dot(n_check);
+    radar_measurement_batch(s.px.data(), s.py.data(), s.vx.data(), s.vy.data(), 0, n_check,
+                            m_rho.data(), m_phi.data(), m_rho_dot.data());
+    bool meas_same = true;
+    for (std::size_t i = 0; i < n_check; ++i) {
+        meas_same = meas_same && m_rho[i] == out.rho[i] && m_phi[i] == out.phi[i] &&
+                    m_rho_dot[i] == out.rho_dot[i];
+    }
+
+    double err_wrap = 0.0;
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> angle(-50.0, 50.0);
+    for (int k = 0; k < 1000000; ++k) {
+        const double a = angle(rng);
+        // 두 방식 모두 [-pi, pi] 지만 경계 (+-pi) 에서 고르는 쪽이 다를 수 있어 2pi 차이는 같은 값으로 본다
+        double d = std::fabs(normalize_angle(a) - normalize_angle_loop(a));
+        d = std::min(d, std::fabs(d - 2.0 * M_PI));
+        err_wrap = std::max(err_wrap, d);
+        if (std::fabs(normalize_angle(a)) > M_PI) {
+            err_wrap = 1.0;
+        }
+    }
+
+    std::printf("\naccuracy vs scalar (n=%zu)\n", n_check);
+    std::printf("  rho      max rel err %.3e\n", err_rho);
+    std::printf("  phi      max abs err %.3e rad (bound %.1e)\n", err_phi, radar_atan2_max_error());
+    std::printf("  rho_dot  max rel err %.3e\n", err_rho_dot);
+    std::printf("  H        max rel err %.3e\n", err_H);
+    std::printf("  normalize_angle max abs err %.3e\n", err_wrap);
+    std::printf("  h(x)-only kernel identical: %s\n", meas_same ? "yes" : "no");
+
+    // 구간을 어떻게 나누든 (스레드 분할) 같아야 한다: track 하나씩 호출하면 전부 scalar 꼬리로 계산된다
+    RadarPredictionSoA single;
+    single.resize(n_check);
+    for (std::size_t i = 0; i < n_check; ++i) {
+        radar_predict_batch(s.px.data(), s.py.data(), s.vx.data(), s.vy.data(), i, i + 1, single);
+    }
+    bool split_same = true;
+    for (std::size_t i = 0; i < n_check; ++i) {
+        split_same = split_same && std::memcmp(single.z(i).data(), out.z(i).data(), sizeof(double) * 3) == 0 &&
+                     std::memcmp(single.H(i).data(), out.H(i).data(), sizeof(double) * 12) == 0;
+    }
+    std::printf("  per-track calls identical: %s\n", split_same ? "yes" : "no");
+
+    const bool ok = err_rho <= 1e-12 && err_phi <= radar_atan2_max_error() &&
+                    err_rho_dot <= 1e-12 && err_H <= 1e-12 && err_wrap <= 1e-12 && meas_same &&
+                    split_same;
+
+    // ---------------------------------------------------------------- 처리량
+    std::printf("\n%10s %14s %14s %10s\n", "tracks", "scalar [ns/t]", "batch [ns/t]", "speedup");
+    for (std::size_t n : sizes) {
+        const States st = make_states(n, 3);
+        RadarPredictionSoA batch;
+        batch.resize(n);
+        std::vector<Eigen::Vector3d> z(n);
+        std::vector<Eigen::Matrix<double, 3, 4>> H(n);
+
+        const int reps = static_cast<int>(std::max<std::size_t>(3, 2000000 / n));
+        double t_scalar = 1e300, t_batch = 1e300;
+        for (int r = 0; r < reps; ++r) {
+            auto t0 = Clock::now();
+            for (std::size_t i = 0; i < n; ++i) {
+                z[i] = radar_measurement(st.aos[i]);
+                H[i] = radar_H_jacobian(st.aos[i]);
+            }
+            auto t1 = Clock::now();
+            radar_predict_batch(st.px.data(), st.py.data(), st.vx.data(), st.vy.data(),
+                                0, n, batch);
+            auto t2 = Clock::now();
+            t_scalar = std::min(t_scalar, std::chrono::duration<double, std::nano>(t1 - t0).count());
+            t_batch = std::min(t_batch, std::chrono::duration<double, std::nano>(t2 - t1).count());
+        }
+        std::printf("%10zu %14.2f %14.2f %9.1fx\n", n, t_scalar / n, t_batch / n,
+                    t_scalar / t_batch);
+    }
+
+    if (!ok) {
+        std::printf("FAIL: batch kernel error exceeds bound\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,290 @@
+// 병렬 (Philox) scenario / sensor simulator 확인과 처리량
+//
+//   - Philox4x32-10 known-answer test (Random123 의 kat_vectors)
+//   - 재현성: 스레드 수 1 / 2 / 4 에서 object 상태와 detection 이 bit 단위로 같은지
+//   - 통계: 검출 확률, camera / radar 잡음 표준편차, 차선 변경 빈도가 설정값과 맞는지
+//   - steady state 에서 heap 할당이 0 인지 (전역 operator new 계수)
+//   - 처리량: 기존 HighwayScenario + SensorSimulator (mt19937, 단일 스레드) 와
+//             TrafficScenario + ParallelSensorSimulator 의 프레임당 시간 (object 수 / 스레드 수 별)
+//   - tracker 와 함께 돌릴 때 simulator 가 차지하는 비율
+// 앞의 네 가지 중 하나라도 어긋나면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_sim [max_objects]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "tracker.hpp"
+#include "highway_scenario.hpp"
+#include "parallel_sensor_simulator.hpp"
+#include "philox.hpp"
+#include "sensor_simulator.hpp"
+#include "traffic_scenario.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr double kCamStd = 1.0;
+constexpr double kRangeStd = 1.0;
+constexpr double kAngleStd = 0.002;
+constexpr double kVrStd = 0.5;
+
+bool check_philox() {
+    using msf::Philox4x32;
+    struct Kat {
+        Philox4x32::Counter ctr;
+        Philox4x32::Key key;
+        Philox4x32::Counter expected;
+    };
+    const Kat kats[] = {
+        {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+    for (const auto& k : kats) {
+        if (Philox4x32::generate(k.ctr, k.key) != k.expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// FNV-1a
+struct Hash {
+    std::uint64_t h{1469598103934665603ull};
+    void add(const void* p, std::size_t n) {
+        const auto* b = static_cast<const unsigned char*>(p);
+        for (std::size_t i = 0; i < n; ++i) {
+            h = (h ^ b[i]) * 1099511628211ull;
+        }
+    }
+    void add(double v) { add(&v, sizeof(v)); }
+};
+
+msf::TrafficParams traffic_params(int num_objects, int num_threads) {
+    msf::TrafficParams p;
+    p.num_objects = num_objects;
+    p.num_threads = num_threads;
+    return p;
+}
+
+std::uint64_t run_hash(int num_objects, int frames, int num_threads) {
+    using namespace msf;
+    TrafficScenario scenario(traffic_params(num_objects, num_threads));
+    ParallelSensorSimulator sensor(kCamStd, kRangeStd, kAngleStd, kVrStd, 0.9, 0.5, 7,
+                                   num_threads);
+    sensor.set_clutter_region(scenario.x_min(), scenario.x_max(),
+                              scenario.y_min(), scenario.y_max());
+    DetectionBatch batch;
+    Hash h;
+    for (int f = 0; f < frames; ++f) {
+        scenario.step();
+        sensor.generate(scenario.objects(), scenario.time(), batch);
+        for (const auto& o : scenario.objects()) {
+            h.add(o.x);
+            h.add(o.y);
+            h.add(o.vx);
+            h.add(o.vy);
+        }
+        for (std::size_t j = 0; j < batch.size(); ++j) {
+            const int sensor_type = static_cast<int>(batch.sensor(j));
+            h.add(&sensor_type, sizeof(sensor_type));
+            for (int k = 0; k < batch.dim(j); ++k) {
+                h.add(batch.z(j, k));
+            }
+        }
+    }
+    return h.h;
+}
+
+struct StatsResult {
+    double detect_rate{0.0};
+    double cam_std{0.0};
+    double range_std{0.0};
+    double lane_change_rate{0.0};   // [1/s/object]
+};
+
+StatsResult measure_stats(int num_objects, int frames) {
+    using namespace msf;
+    StatsResult r;
+
+    // 검출 확률 1 이면 출력이 object 순서로 [camera, radar] 쌍이라 truth 와 바로 비교 가능
+    TrafficScenario scenario(traffic_params(num_objects, 2));
+    ParallelSensorSimulator exact(kCamStd, kRangeStd, kAngleStd, kVrStd, 1.0, 0.0, 3, 2);
+    ParallelSensorSimulator lossy(kCamStd, kRangeStd, kAngleStd, kVrStd, 0.9, 0.0, 3, 2);
+    DetectionBatch batch;
+    double cam_sq = 0.0, range_sq = 0.0;
+    std::size_t n_cam = 0, n_range = 0, detected = 0, possible = 0;
+    for (int f = 0; f < frames; ++f) {
+        scenario.step();
+        const auto& objects = scenario.objects();
+        exact.generate(objects, scenario.time(), batch);
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            const double dx = batch.z(2 * i, 0) - objects[i].x;
+            const double dy = batch.z(2 * i, 1) - objects[i].y;
+            cam_sq += dx * dx + dy * dy;
+            n_cam += 2;
+            const double dr = batch.z(2 * i + 1, 0) - std::hypot(objects[i].x, objects[i].y);
+            range_sq += dr * dr;
+            ++n_range;
+        }
+        lossy.generate(objects, scenario.time(), batch);
+        detected += batch.size();
+        possible += 2 * objects.size();
+    }
+    r.detect_rate = static_cast<double>(detected) / possible;
+    r.cam_std = std::sqrt(cam_sq / n_cam);
+    r.range_std = std::sqrt(range_sq / n_range);
+    r.lane_change_rate = static_cast<double>(scenario.lane_changes()) /
+                         (num_objects * scenario.time());
+    return r;
+}
+
+// 프레임당 (scenario step + detection 생성) 시간 [ms]
+double time_legacy(int num_objects, int frames) {
+    using namespace msf;
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor(kCamStd, kRangeStd, kAngleStd, kVrStd, 0.9, 0.5);
+    DetectionBatch batch;
+    sensor.generate(scenario.objects(), scenario.time(), batch);
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; ++f) {
+        scenario.step();
+        sensor.generate(scenario.objects(), scenario.time(), batch);
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / frames;
+}
+
+struct ParallelTiming {
+    double ms{0.0};
+    std::uint64_t allocs{0};
+};
+
+ParallelTiming time_parallel(int num_objects, int frames, int num_threads) {
+    using namespace msf;
+    TrafficScenario scenario(traffic_params(num_objects, num_threads));
+    ParallelSensorSimulator sensor(kCamStd, kRangeStd, kAngleStd, kVrStd, 0.9, 0.5, 7,
+                                   num_threads);
+    sensor.set_clutter_region(scenario.x_min(), scenario.x_max(),
+                              scenario.y_min(), scenario.y_max());
+    DetectionBatch batch;
+    // 첫 프레임에서 버퍼 크기가 잡히고, 검출 수 변동을 감안해 여유를 둔다
+    batch.reserve(static_cast<std::size_t>(num_objects * 2.6));
+    scenario.step();
+    sensor.generate(scenario.objects(), scenario.time(), batch);
+
+    ParallelTiming t;
+    g_allocs.store(0);
+    g_counting.store(true);
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; ++f) {
+        scenario.step();
+        sensor.generate(scenario.objects(), scenario.time(), batch);
+    }
+    auto t1 = Clock::now();
+    g_counting.store(false);
+    t.ms = std::chrono::duration<double, std::milli>(t1 - t0).count() / frames;
+    t.allocs = g_allocs.load();
+    return t;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int max_objects = 1000000;
+    if (argc >= 2) max_objects = std::stoi(argv[1]);
+
+    bool ok = true;
+
+    const bool kat = check_philox();
+    std::printf("philox known-answer test: %s\n", kat ? "ok" : "MISMATCH");
+    ok &= kat;
+
+    const std::uint64_t h1 = run_hash(20000, 20, 1);
+    const std::uint64_t h2 = run_hash(20000, 20, 2);
+    const std::uint64_t h4 = run_hash(20000, 20, 4);
+    const bool same = h1 == h2 && h1 == h4;
+    std::printf("reproducible across 1/2/4 threads: %s (%016llx)\n", same ? "yes" : "NO",
+                static_cast<unsigned long long>(h1));
+    ok &= same;
+
+    const StatsResult st = measure_stats(20000, 100);
+    // 차선 변경 중에는 새 변경을 시작하지 않으므로 실제 빈도는 rate / (1 + rate * 변경 시간)
+    const msf::TrafficParams defaults;
+    const double lc_expected = defaults.lane_change_rate /
+                               (1.0 + defaults.lane_change_rate * defaults.lane_change_time);
+    std::printf("detect rate %.4f (0.9)  cam std %.4f (%.1f)  range std %.4f (%.1f)  "
+                "lane changes %.4f/s (%.4f)\n",
+                st.detect_rate, st.cam_std, kCamStd, st.range_std, kRangeStd,
+                st.lane_change_rate, lc_expected);
+    const bool stats_ok = std::abs(st.detect_rate - 0.9) < 0.005 &&
+                          std::abs(st.cam_std / kCamStd - 1.0) < 0.02 &&
+                          std::abs(st.range_std / kRangeStd - 1.0) < 0.02 &&
+                          std::abs(st.lane_change_rate / lc_expected - 1.0) < 0.1;
+    ok &= stats_ok;
+
+    std::printf("\n%10s %14s %14s %14s %14s %12s\n", "objects", "legacy [ms]",
+                "1 thread [ms]", "2 threads [ms]", "4 threads [ms]", "allocs");
+    for (int n : {10000, 100000, 1000000}) {
+        if (n > max_objects) break;
+        const int frames = std::max(3, 2000000 / n);
+        const double legacy = time_legacy(n, frames);
+        ParallelTiming t[3];
+        const int threads[3] = {1, 2, 4};
+        std::uint64_t allocs = 0;
+        for (int k = 0; k < 3; ++k) {
+            t[k] = time_parallel(n, frames, threads[k]);
+            allocs += t[k].allocs;
+        }
+        std::printf("%10d %14.3f %14.3f %14.3f %14.3f %12llu\n", n, legacy, t[0].ms, t[1].ms,
+                    t[2].ms, static_cast<unsigned long long>(allocs));
+        ok &= allocs == 0;
+    }
+
+    // tracker 와 함께: simulator 시간 비율
+    {
+        using namespace msf;
+        const int n = std::min(max_objects, 5000);
+        TrafficScenario scenario(traffic_params(n, 1));
+        ParallelSensorSimulator sensor(kCamStd, kRangeStd, kAngleStd, kVrStd, 0.9, 0.1, 7, 1);
+        sensor.set_clutter_region(scenario.x_min(), scenario.x_max(),
+                                  scenario.y_min(), scenario.y_max());
+        TrackerParams params;
+        params.radar_angle_noise_std = kAngleStd;
+        params.max_association_maha_dist = 16.0;
+        MultiSensorTracker tracker(params);
+        DetectionBatch batch;
+        double sim_ms = 0.0, track_ms = 0.0;
+        const int frames = 30;
+        for (int f = 0; f < frames; ++f) {
+            auto t0 = Clock::now();
+            scenario.step();
+            sensor.generate(scenario.objects(), scenario.time(), batch);
+            auto t1 = Clock::now();
+            tracker.predict(scenario.time());
+            tracker.update(batch);
+            auto t2 = Clock::now();
+            sim_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            track_ms += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        }
+        std::printf("\nwith tracker (%d objects): simulator %.3f ms/frame, tracker %.3f ms/frame "
+                    "(%.1f%% in simulator)\n",
+                    n, sim_ms / frames, track_ms / frames, 100.0 * sim_ms / (sim_ms + track_ms));
+    }
+
+    if (!ok) {
+        std::printf("FAIL: simulator check failed\n");
+        return 1;
+    }
+    return 0;
+}
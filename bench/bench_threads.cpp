@@ -0,0 +1,145 @@
+// TrackerParams::num_threads 스케일링 벤치마크
+//
+// 같은 시나리오를 스레드 수 1..N 으로 돌려 프레임당 predict+update 시간을 재고,
+// 결과 track 상태가 단일 스레드 실행과 bit 단위로 같은지 확인한다.
+// 이어서 association / 필터 설정별로 1 vs 2, 3, 4 스레드 결과를 비교한다
+// (3 은 SIMD 폭으로 나누어떨어지지 않는 분할 경계를 만든다). 다르면 1 로 종료.
+//
+// 사용법: bench_threads [num_objects] [max_threads] [frames]
+//   max_threads 는 코어 수와 무관하게 최소 4 (1 코어 머신에서도 2, 4 스레드 결과를 비교한다)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tracker.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+struct RunResult {
+    double frame_ms{0.0};
+    std::vector<msf::TrackState> tracks;
+};
+
+RunResult run(int num_objects, int num_threads, int frames, bool dense,
+              void (*configure)(msf::TrackerParams&) = nullptr) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    HighwayScenario scenario(num_objects, 0.1);
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 0.9, 0.1);
+
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    params.use_spatial_gating = !dense;
+    params.num_threads = num_threads;
+    if (configure) configure(params);
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch detections;
+    RunResult result;
+    const int warmup = 3;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, detections);
+
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(detections);
+        auto t1 = Clock::now();
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        }
+    }
+    result.frame_ms /= frames;
+    result.tracks = tracker.get_tracks();
+    return result;
+}
+
+bool bit_identical(const std::vector<msf::TrackState>& a, const std::vector<msf::TrackState>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].id != b[i].id ||
+            std::memcmp(a[i].x.data(), b[i].x.data(), sizeof(double) * 4) != 0 ||
+            std::memcmp(a[i].P.data(), b[i].P.data(), sizeof(double) * 16) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Config {
+    const char* name;
+    void (*configure)(msf::TrackerParams&);
+};
+
+const Config kConfigs[] = {
+    {"greedy", [](msf::TrackerParams&) {}},
+    {"optimal", [](msf::TrackerParams& p) { p.association_method = msf::AssociationMethod::Optimal; }},
+    {"jpda", [](msf::TrackerParams& p) { p.association_method = msf::AssociationMethod::JPDA; }},
+    {"mht", [](msf::TrackerParams& p) { p.association_method = msf::AssociationMethod::MHT; }},
+    {"imm", [](msf::TrackerParams& p) { p.motion_model = msf::MotionModel::IMM; }},
+    {"ukf", [](msf::TrackerParams& p) { p.radar_filter = msf::RadarFilter::UKF; }},
+    {"soa", [](msf::TrackerParams& p) { p.track_storage = msf::TrackStorage::SoA; }},
+    {"soa-seq-info", [](msf::TrackerParams& p) {
+         p.track_storage = msf::TrackStorage::SoA;
+         p.fusion_mode = msf::FusionMode::Sequential;
+         p.detection_update = msf::DetectionUpdate::Information;
+     }},
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int num_objects = 2000;
+    int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+    int frames = 10;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) max_threads = std::stoi(argv[2]);
+    if (argc >= 4) frames = std::stoi(argv[3]);
+    // 결정성 비교는 코어 수와 상관없이 항상 2, 4 스레드까지 돌린다
+    max_threads = std::max(max_threads, 4);
+
+    bool all_identical = true;
+    for (int dense = 0; dense < 2; ++dense) {
+        // dense 경로는 O(N*M) 이므로 object 수를 줄여서 측정
+        const int n = dense ? std::min(num_objects, 500) : num_objects;
+        std::printf("%s gating, objects=%d\n", dense ? "dense" : "grid", n);
+        std::printf("%8s %12s %9s %10s\n", "threads", "ms/frame", "speedup", "identical");
+
+        RunResult base = run(n, 1, frames, dense != 0);
+        std::printf("%8d %12.3f %8.2fx %10s\n", 1, base.frame_ms, 1.0, "-");
+
+        for (int t = 2; t <= max_threads; t *= 2) {
+            RunResult r = run(n, t, frames, dense != 0);
+            const bool same = bit_identical(base.tracks, r.tracks);
+            all_identical = all_identical && same;
+            std::printf("%8d %12.3f %8.2fx %10s\n",
+                        t, r.frame_ms, base.frame_ms / r.frame_ms, same ? "yes" : "NO");
+        }
+    }
+
+    const int n_cfg = std::min(num_objects, 500);
+    const int cfg_frames = 13;
+    std::printf("\nconfigurations, objects=%d, frames=%d\n", n_cfg, cfg_frames);
+    std::printf("%14s %10s\n", "config", "identical");
+    for (const Config& cfg : kConfigs) {
+        const RunResult base = run(n_cfg, 1, cfg_frames, false, cfg.configure);
+        bool same = true;
+        for (int t = 2; t <= 4; ++t) {
+            same = bit_identical(base.tracks, run(n_cfg, t, cfg_frames, false, cfg.configure).tracks) && same;
+        }
+        all_identical = all_identical && same;
+        std::printf("%14s %10s\n", cfg.name, same ? "yes" : "NO");
+    }
+
+    return all_identical ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+// track-to-track fusion: 센서별 tracker 의 object list 를 중앙 tracker 에 update_tracks() 로 융합
+//
+// 센서마다 독립된 잡음의 detection 으로 자체 MultiSensorTracker 를 돌리고 (센서 내부 tracking),
+// confirmed track 만 SensorTrack 으로 중앙 tracker 에 넘긴다.
+//   - 정확도: 중앙 track (covariance intersection / information) 과 센서 하나의 track 위치 오차 비교
+//   - 처리량: 센서 수 x object 수 에 따른 update_tracks() 시간 (프레임 예산 100 ms 대비 비율)
+// CI 융합 오차가 가장 좋은 단일 센서보다 크거나, 기본 구성 (4 센서) 의 update_tracks() 가
+// 프레임 예산의 5% 를 넘으면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_track_fusion [num_objects] [frames] [num_sensors]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr double kFrameBudgetMs = 100.0;   // 10 Hz
+
+struct RunResult {
+    double local_err{0.0};      // 센서 0 의 자체 track
+    double fused_err{0.0};      // 중앙 track
+    double fuse_ms{0.0};        // update_tracks() 평균
+    double fuse_max_ms{0.0};
+    double objects_in{0.0};     // 프레임당 입력 object 수
+};
+
+RunResult run(msf::TrackFusionMethod method, int num_objects, int frames, int num_sensors) {
+    using namespace msf;
+
+    HighwayScenario scenario(num_objects, 0.1);
+
+    TrackerParams local_params;
+    local_params.radar_angle_noise_std = 0.02;
+    local_params.max_association_maha_dist = 16.0;
+    local_params.fusion_mode = FusionMode::Sequential;
+
+    std::vector<SensorSimulator> sims;
+    std::vector<std::unique_ptr<MultiSensorTracker>> locals;
+    for (int s = 0; s < num_sensors; ++s) {
+        sims.emplace_back(1.0, 1.0, 0.02, 0.5, 0.9, 0.1, 100u + s);
+        locals.push_back(std::make_unique<MultiSensorTracker>(local_params));
+    }
+
+    TrackerParams central_params;
+    central_params.track_fusion_method = method;
+    MultiSensorTracker central(central_params);
+
+    DetectionBatch batch;
+    std::vector<SensorTrack> objects;
+
+    RunResult result;
+    const int warmup = 30;
+    int measured = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+
+        objects.clear();
+        for (int s = 0; s < num_sensors; ++s) {
+            sims[s].generate(scenario.objects(), t, batch);
+            locals[s]->predict(t);
+            locals[s]->update(batch);
+            for (const auto& track : locals[s]->get_tracks()) {
+                if (!track.confirmed) continue;
+                SensorTrack o;
+                o.sensor_id = s;
+                o.local_id = track.id;
+                o.x = track.x;
+                o.P = track.P;
+                o.timestamp = t;
+                objects.push_back(o);
+            }
+        }
+
+        auto t0 = Clock::now();
+        central.predict(t);
+        central.update_tracks(objects);
+        auto t1 = Clock::now();
+
+        if (step >= warmup) {
+            const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.fuse_ms += ms;
+            result.fuse_max_ms = std::max(result.fuse_max_ms, ms);
+            result.objects_in += objects.size();
+            result.local_err += frame_error(scenario.objects(), locals[0]->get_tracks());
+            result.fused_err += frame_error(scenario.objects(), central.get_tracks());
+            ++measured;
+        }
+    }
+    result.fuse_ms /= measured;
+    result.objects_in /= measured;
+    result.local_err /= measured;
+    result.fused_err /= measured;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::TrackFusionMethod;
+
+    int num_objects = 200;
+    int frames = 100;
+    int num_sensors = 4;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+    if (argc >= 4) num_sensors = std::stoi(argv[3]);
+
+    std::printf("objects=%d frames=%d sensors=%d\n", num_objects, frames, num_sensors);
+    std::printf("%-12s %13s %13s %11s %11s %11s %10s\n", "method", "local err[m]",
+                "fused err[m]", "inputs", "fuse [ms]", "max [ms]", "budget");
+
+    RunResult ci;
+    for (TrackFusionMethod method : {TrackFusionMethod::CovarianceIntersection,
+                                     TrackFusionMethod::Information}) {
+        const RunResult r = run(method, num_objects, frames, num_sensors);
+        std::printf("%-12s %13.3f %13.3f %11.0f %11.3f %11.3f %9.2f%%\n",
+                    method == TrackFusionMethod::Information ? "information" : "ci",
+                    r.local_err, r.fused_err, r.objects_in, r.fuse_ms, r.fuse_max_ms,
+                    100.0 * r.fuse_ms / kFrameBudgetMs);
+        if (method == TrackFusionMethod::CovarianceIntersection) {
+            ci = r;
+        }
+    }
+
+    // 센서 수에 따른 확장성 (CI)
+    std::printf("\n%8s %11s %11s %10s\n", "sensors", "inputs", "fuse [ms]", "budget");
+    for (int s : {1, 2, 4, 8}) {
+        const RunResult r = run(TrackFusionMethod::CovarianceIntersection, num_objects, 40, s);
+        std::printf("%8d %11.0f %11.3f %9.2f%%\n", s, r.objects_in, r.fuse_ms,
+                    100.0 * r.fuse_ms / kFrameBudgetMs);
+    }
+
+    if (ci.fused_err > ci.local_err || ci.fuse_ms > 0.05 * kFrameBudgetMs) {
+        std::printf("FAIL: fused tracks are worse than a single sensor or fusion is too slow\n");
+        return 1;
+    }
+    return 0;
+}
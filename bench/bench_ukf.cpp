@@ -0,0 +1,158 @@
+// radar 측정 업데이트: EKF vs UKF 정확도 / 지연 비교
+//
+// 두 가지 장면에서 같은 detection 열을 EKF, UKF tracker 에 넣는다.
+//   highway : HighwayScenario (센서 앞 20 ~ 수백 m, 같은 방향 주행)
+//   passing : 센서 옆 1.5 ~ 6 m 를 스쳐 지나가는 맞은편 차량 (근거리에서 h(x) 의 비선형성이 큼)
+// 각각 camera + radar 융합 / radar 만 두 가지로 돌린다.
+// 지표는 각 ground truth object 와 가장 가까운 confirmed track 의 위치 / 속도 오차 평균
+// (cap 에서 자름) 과 프레임당 predict + update 시간.
+// UKF 의 위치 오차가 EKF 보다 10% 넘게 크거나 프레임 시간이 2 배를 넘으면 0 이 아닌 값으로 종료한다.
+//
+// 사용법: bench_ukf [num_objects] [frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "tracker.hpp"
+#include "track_error.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+enum class Scene { Highway, Passing };
+
+struct RunResult {
+    double pos_err{0.0};
+    double vel_err{0.0};
+    double frame_ms{0.0};
+};
+
+// 센서 (원점) 옆 차선을 반대 방향으로 지나가는 차량. 지나간 뒤에는 앞쪽에서 다시 진입
+class PassingScenario {
+public:
+    PassingScenario(int num_objects, double dt) : dt_(dt) {
+        for (int i = 0; i < num_objects; ++i) {
+            msf::ObjectState o;
+            o.id = i;
+            o.x = 15.0 + 60.0 * i / std::max(1, num_objects);
+            o.y = (i % 2 ? 1.0 : -1.0) * (1.5 + 1.5 * (i % 4));
+            o.vx = -(8.0 + (i % 5) * 2.0);
+            o.vy = 0.0;
+            objects_.push_back(o);
+        }
+    }
+
+    void step() {
+        time_ += dt_;
+        for (auto& o : objects_) {
+            o.x += o.vx * dt_;
+            if (o.x < -15.0) {
+                o.x += 90.0;
+            }
+        }
+    }
+
+    const std::vector<msf::ObjectState>& objects() const { return objects_; }
+    double time() const { return time_; }
+
+private:
+    double dt_;
+    double time_{0.0};
+    std::vector<msf::ObjectState> objects_;
+};
+
+template <typename Scenario>
+RunResult run(Scenario scenario, msf::RadarFilter filter, bool radar_only, int frames) {
+    using namespace msf;
+    using Clock = std::chrono::steady_clock;
+
+    SensorSimulator sensor_sim(1.0, 0.5, 0.03, 0.3, 0.95, 0.0);
+
+    TrackerParams params;
+    params.radar_r_noise_std = 0.5;
+    params.radar_angle_noise_std = 0.03;
+    params.radar_vr_noise_std = 0.3;
+    params.max_association_maha_dist = 16.0;
+    params.radar_filter = filter;
+    MultiSensorTracker tracker(params);
+
+    DetectionBatch all, used;
+
+    RunResult result;
+    const int warmup = 20;
+    int measured = 0;
+    for (int step = 0; step < warmup + frames; ++step) {
+        scenario.step();
+        const double t = scenario.time();
+        sensor_sim.generate(scenario.objects(), t, all);
+
+        const DetectionBatch* batch = &all;
+        if (radar_only) {
+            used.clear();
+            for (size_t j = 0; j < all.size(); ++j) {
+                if (all.sensor(j) == SensorType::Radar) used.push_back(all.at(j));
+            }
+            batch = &used;
+        }
+
+        auto t0 = Clock::now();
+        tracker.predict(t);
+        tracker.update(*batch);
+        auto t1 = Clock::now();
+
+        if (step >= warmup) {
+            result.frame_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            accumulate_error(scenario.objects(), tracker.get_tracks(),
+                             result.pos_err, result.vel_err);
+            ++measured;
+        }
+    }
+    result.frame_ms /= measured;
+    result.pos_err /= measured;
+    result.vel_err /= measured;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using msf::RadarFilter;
+
+    int num_objects = 100;
+    int frames = 300;
+    if (argc >= 2) num_objects = std::stoi(argv[1]);
+    if (argc >= 3) frames = std::stoi(argv[2]);
+
+    std::printf("objects=%d frames=%d\n", num_objects, frames);
+    std::printf("%-8s %-12s %-4s %14s %14s %10s\n",
+                "scene", "sensors", "mode", "pos err [m]", "vel err [m/s]", "ms/frame");
+
+    bool ok = true;
+    for (Scene scene : {Scene::Highway, Scene::Passing}) {
+        for (bool radar_only : {false, true}) {
+            RunResult r[2];
+            for (RadarFilter filter : {RadarFilter::EKF, RadarFilter::UKF}) {
+                const int k = filter == RadarFilter::UKF;
+                r[k] = scene == Scene::Highway
+                           ? run(msf::HighwayScenario(num_objects, 0.1), filter, radar_only, frames)
+                           : run(PassingScenario(num_objects, 0.1), filter, radar_only, frames);
+                std::printf("%-8s %-12s %-4s %14.3f %14.3f %10.3f\n",
+                            scene == Scene::Highway ? "highway" : "passing",
+                            radar_only ? "radar" : "camera+radar",
+                            k ? "ukf" : "ekf", r[k].pos_err, r[k].vel_err, r[k].frame_ms);
+            }
+            ok = ok && r[1].pos_err <= 1.1 * r[0].pos_err && r[1].frame_ms <= 2.0 * r[0].frame_ms;
+        }
+    }
+
+    if (!ok) {
+        std::printf("FAIL: UKF is less accurate or much slower than EKF\n");
+        return 1;
+    }
+    return 0;
+}
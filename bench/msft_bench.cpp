@@ -0,0 +1,299 @@
+// Google Benchmark 기반 msft 마이크로벤치마크 + 프레임 단위 end-to-end 벤치마크
+//
+// JSON 출력: msft_bench --benchmark_out=result.json --benchmark_out_format=json
+// baseline 비교: tools/compare_bench.py baseline.json result.json
+// (CMake target perf_regression 이 두 단계를 함께 실행, perf_baseline 은 baseline 을 다시 기록)
+//
+// JSON context 의 msft_build_type 에 libmsft 의 빌드 configuration (MSFT_BUILD_TYPE) 을 남긴다.
+// compare_bench.py 는 최적화되지 않은 빌드의 결과를 비교하지 않는다.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "data_association.hpp"
+#include "radar_batch.hpp"
+#include "sensor_models.hpp"
+#include "tracker.hpp"
+#include "highway_scenario.hpp"
+#include "sensor_simulator.hpp"
+
+namespace {
+
+using namespace msf;
+
+TrackerParams bench_params() {
+    TrackerParams params;
+    params.radar_angle_noise_std = 0.02;
+    params.max_association_maha_dist = 16.0;
+    return params;
+}
+
+// 시나리오를 warmup 프레임만큼 돌려 track 이 자리잡은 tracker 준비
+struct WarmScene {
+    HighwayScenario scenario;
+    SensorSimulator sensor_sim;
+    MultiSensorTracker tracker;
+    DetectionBatch detections;
+
+    WarmScene(int num_objects, double clutter_rate, double detection_prob,
+              const TrackerParams& params, int warmup = 10)
+        : scenario(num_objects, 0.1),
+          sensor_sim(1.0, 1.0, 0.02, 0.5, detection_prob, clutter_rate),
+          tracker(params) {
+        for (int i = 0; i < warmup; ++i) {
+            step();
+        }
+    }
+
+    void step() {
+        scenario.step();
+        sensor_sim.generate(scenario.objects(), scenario.time(), detections);
+        tracker.predict(scenario.time());
+        tracker.update(detections);
+    }
+};
+
+std::vector<Vec4> random_states(int n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> x_dist(5.0, 200.0);
+    std::uniform_real_distribution<double> y_dist(-10.0, 10.0);
+    std::uniform_real_distribution<double> v_dist(-30.0, 30.0);
+    std::vector<Vec4> xs(n);
+    for (auto& x : xs) {
+        x << x_dist(rng), y_dist(rng), v_dist(rng), v_dist(rng);
+    }
+    return xs;
+}
+
+// ---------------------------------------------------------------------------
+// predict: args = {track 수 (≈ object 수), TrackStorage}
+
+void BM_TrackerPredict(benchmark::State& state) {
+    TrackerParams params = bench_params();
+    params.track_storage = static_cast<TrackStorage>(state.range(1));
+    WarmScene scene(static_cast<int>(state.range(0)), 0.0, 1.0, params);
+
+    double t = scene.scenario.time();
+    for (auto _ : state) {
+        t += 0.1;
+        scene.tracker.predict(t);
+    }
+    state.SetItemsProcessed(state.iterations() * scene.tracker.get_tracks().size());
+}
+BENCHMARK(BM_TrackerPredict)
+    ->ArgsProduct({{100, 1000, 5000},
+                   {static_cast<int>(TrackStorage::AoS), static_cast<int>(TrackStorage::SoA)}});
+
+// ---------------------------------------------------------------------------
+// dense cost matrix: use_spatial_gating = false 인 tracker 의 radar 전용 update
+// (track 마다 MeasurementCache 를 만들고 n tracks × n radar detection 전부 pair_cost).
+// 프레임 비용의 대부분이 비용 행렬 채우기이므로 tracker 의 비용 계산 경로가 느려지면 여기에 드러난다
+
+void BM_CostMatrixRadar(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    TrackerParams params = bench_params();
+    params.use_spatial_gating = false;
+    WarmScene scene(n, 0.0, 1.0, params);
+
+    DetectionBatch radar;
+    for (auto _ : state) {
+        state.PauseTiming();
+        scene.scenario.step();
+        scene.sensor_sim.generate(scene.scenario.objects(), scene.scenario.time(),
+                                  scene.detections);
+        radar.clear();
+        for (std::size_t j = 0; j < scene.detections.size(); ++j) {
+            if (scene.detections.sensor(j) == SensorType::Radar) {
+                radar.push_back(scene.detections.at(j));
+            }
+        }
+        scene.tracker.predict(scene.scenario.time());
+        state.ResumeTiming();
+        scene.tracker.update(radar);
+    }
+    const std::size_t n_tracks = scene.tracker.get_tracks().size();
+    state.SetItemsProcessed(state.iterations() * n_tracks * radar.size());
+    state.counters["tracks"] = static_cast<double>(n_tracks);
+    state.counters["detections"] = static_cast<double>(radar.size());
+}
+BENCHMARK(BM_CostMatrixRadar)->Arg(100)->Arg(500);
+
+// ---------------------------------------------------------------------------
+// radar Jacobian
+
+void BM_RadarJacobian(benchmark::State& state) {
+    const std::vector<Vec4> xs = random_states(1024, 3);
+    for (auto _ : state) {
+        for (const auto& x : xs) {
+            auto H = radar_H_jacobian(x);
+            benchmark::DoNotOptimize(H.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * xs.size());
+}
+BENCHMARK(BM_RadarJacobian);
+
+// SoA batch kernel: h(x) + H 를 한 번에 (BM_RadarJacobian 과 같은 1024 개 상태)
+void BM_RadarPredictBatch(benchmark::State& state) {
+    const std::vector<Vec4> xs = random_states(1024, 3);
+    AlignedDoubles px(xs.size()), py(xs.size()), vx(xs.size()), vy(xs.size());
+    for (size_t i = 0; i < xs.size(); ++i) {
+        px[i] = xs[i](0);
+        py[i] = xs[i](1);
+        vx[i] = xs[i](2);
+        vy[i] = xs[i](3);
+    }
+    RadarPredictionSoA out;
+    out.resize(xs.size());
+    for (auto _ : state) {
+        radar_predict_batch(px.data(), py.data(), vx.data(), vy.data(), 0, xs.size(), out);
+        benchmark::DoNotOptimize(out.phi.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * xs.size());
+    state.SetLabel(radar_batch_backend());
+}
+BENCHMARK(BM_RadarPredictBatch);
+
+// ---------------------------------------------------------------------------
+// association: n tracks, 2n detection (혼잡한 3 차선, camera 형태의 2D 비용)
+
+struct AssocProblem {
+    int n_tracks{0};
+    int n_dets{0};
+    Eigen::MatrixXd dense;
+    std::vector<GateCandidate> sparse;
+};
+
+AssocProblem make_assoc_problem(int n_tracks, double gate) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> lane_dist(-1, 1);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::uniform_real_distribution<double> uni01(0.0, 1.0);
+    const double road_length = n_tracks * 8.0 / 3.0;
+    std::uniform_real_distribution<double> x_dist(0.0, road_length);
+    std::uniform_real_distribution<double> y_dist(-6.0, 6.0);
+
+    AssocProblem p;
+    p.n_tracks = n_tracks;
+    p.n_dets = 2 * n_tracks;
+    std::vector<double> tx(n_tracks), ty(n_tracks), dx, dy;
+    for (int i = 0; i < n_tracks; ++i) {
+        tx[i] = x_dist(rng);
+        ty[i] = 3.5 * lane_dist(rng);
+        if (uni01(rng) < 0.9) {
+            dx.push_back(tx[i] + noise(rng));
+            dy.push_back(ty[i] + noise(rng));
+        }
+    }
+    while (static_cast<int>(dx.size()) < p.n_dets) {
+        dx.push_back(x_dist(rng));
+        dy.push_back(y_dist(rng));
+    }
+
+    p.dense.setConstant(n_tracks, p.n_dets, std::numeric_limits<double>::infinity());
+    for (int i = 0; i < n_tracks; ++i) {
+        for (int j = 0; j < p.n_dets; ++j) {
+            const double d2 = (tx[i] - dx[j]) * (tx[i] - dx[j]) + (ty[i] - dy[j]) * (ty[i] - dy[j]);
+            if (d2 <= gate) {
+                p.dense(i, j) = d2;
+                p.sparse.push_back({i, j, d2});
+            }
+        }
+    }
+    return p;
+}
+
+void BM_AssociateGreedyDense(benchmark::State& state) {
+    const AssocProblem p = make_assoc_problem(static_cast<int>(state.range(0)), 16.0);
+    for (auto _ : state) {
+        AssociationResult r = associate_greedy(p.dense, 16.0);
+        benchmark::DoNotOptimize(r.track_assignment.data());
+    }
+}
+BENCHMARK(BM_AssociateGreedyDense)->Arg(100)->Arg(1000);
+
+void BM_AssociateGreedySparse(benchmark::State& state) {
+    const AssocProblem p = make_assoc_problem(static_cast<int>(state.range(0)), 16.0);
+    for (auto _ : state) {
+        AssociationResult r = associate_greedy(p.sparse, p.n_tracks, p.n_dets, 16.0);
+        benchmark::DoNotOptimize(r.track_assignment.data());
+    }
+}
+BENCHMARK(BM_AssociateGreedySparse)->Arg(100)->Arg(1000)->Arg(5000);
+
+void BM_AssociateOptimalSparse(benchmark::State& state) {
+    const AssocProblem p = make_assoc_problem(static_cast<int>(state.range(0)), 16.0);
+    for (auto _ : state) {
+        AssociationResult r = associate_optimal(p.sparse, p.n_tracks, p.n_dets, 16.0);
+        benchmark::DoNotOptimize(r.track_assignment.data());
+    }
+}
+BENCHMARK(BM_AssociateOptimalSparse)->Arg(100)->Arg(1000)->Arg(5000);
+
+// ---------------------------------------------------------------------------
+// track 생성: 빈 tracker 에 n 개 detection → 전부 새 track
+
+void BM_TrackBirth(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    HighwayScenario scenario(n, 0.1);
+    scenario.step();
+    SensorSimulator sensor_sim(1.0, 1.0, 0.02, 0.5, 1.0, 0.0);
+    DetectionBatch detections;
+    sensor_sim.generate(scenario.objects(), scenario.time(), detections);
+    const TrackerParams params = bench_params();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        MultiSensorTracker tracker(params);
+        state.ResumeTiming();
+        tracker.update(detections);
+        benchmark::DoNotOptimize(tracker.get_tracks().data());
+    }
+    state.SetItemsProcessed(state.iterations() * detections.size());
+}
+BENCHMARK(BM_TrackBirth)->Arg(100)->Arg(1000);
+
+// ---------------------------------------------------------------------------
+// end-to-end 프레임 (predict + update): args = {object 수, clutter [%], detection 확률 [%]}
+
+void BM_Frame(benchmark::State& state) {
+    const int num_objects = static_cast<int>(state.range(0));
+    const double clutter = state.range(1) / 100.0;
+    const double pd = state.range(2) / 100.0;
+    WarmScene scene(num_objects, clutter, pd, bench_params());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        scene.scenario.step();
+        scene.sensor_sim.generate(scene.scenario.objects(), scene.scenario.time(),
+                                  scene.detections);
+        state.ResumeTiming();
+        scene.tracker.predict(scene.scenario.time());
+        scene.tracker.update(scene.detections);
+    }
+    state.counters["tracks"] = static_cast<double>(scene.tracker.get_tracks().size());
+    state.counters["detections"] = static_cast<double>(scene.detections.size());
+}
+BENCHMARK(BM_Frame)
+    ->ArgNames({"objects", "clutter_pct", "pd_pct"})
+    ->ArgsProduct({{100, 1000}, {10, 50}, {90}})
+    ->Args({1000, 10, 60})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+int main(int argc, char** argv) {
+    benchmark::AddCustomContext("msft_build_type", MSFT_BUILD_TYPE);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
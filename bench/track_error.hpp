@@ -0,0 +1,62 @@
+#pragma once
+
+// bench 공용 추적 오차 (truth object 마다 가장 가까운 confirmed track 까지의 거리)
+//
+// object 를 놓친 경우 (cap 안에 track 이 없음) 는 cap 으로 센다.
+// 여러 bench 의 main 이 있는 .cpp 에서 include 한다.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "types.hpp"
+#include "highway_scenario.hpp"
+
+namespace {
+
+// 프레임 하나의 평균 위치 오차 [m] (object 당 최대 cap_m)
+inline double frame_error(const std::vector<msf::ObjectState>& objects,
+                          const std::vector<msf::TrackState>& tracks,
+                          double cap_m = 10.0) {
+    double sum = 0.0;
+    for (const auto& o : objects) {
+        double best = cap_m;
+        for (const auto& t : tracks) {
+            if (!t.confirmed) continue;
+            best = std::min(best, std::hypot(t.x(0) - o.x, t.x(1) - o.y));
+        }
+        sum += best;
+    }
+    return objects.empty() ? 0.0 : sum / objects.size();
+}
+
+// 프레임 하나의 평균 위치 / 속도 오차를 pos_sum / vel_sum 에 더한다.
+// 속도 오차는 위치가 가장 가까운 track 기준 (없으면 vel_cap)
+inline void accumulate_error(const std::vector<msf::ObjectState>& objects,
+                             const std::vector<msf::TrackState>& tracks,
+                             double& pos_sum, double& vel_sum,
+                             double pos_cap = 5.0, double vel_cap = 10.0) {
+    double pos = 0.0, vel = 0.0;
+    for (const auto& o : objects) {
+        double best = pos_cap;
+        const msf::TrackState* best_track = nullptr;
+        for (const auto& t : tracks) {
+            if (!t.confirmed) continue;
+            const double d = std::hypot(t.x(0) - o.x, t.x(1) - o.y);
+            if (d < best) {
+                best = d;
+                best_track = &t;
+            }
+        }
+        pos += best;
+        vel += best_track ? std::min(vel_cap, std::hypot(best_track->x(2) - o.vx,
+                                                         best_track->x(3) - o.vy))
+                          : vel_cap;
+    }
+    if (!objects.empty()) {
+        pos_sum += pos / objects.size();
+        vel_sum += vel / objects.size();
+    }
+}
+
+} // namespace
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "types.hpp"
+#include "detection_batch.hpp"
+
+namespace msf {
+
+// chunk 단위 append-only binary log
+//
+// 파일 구조 (little-endian, 모든 필드 8 byte 정렬)
+//   LogFileHeader                          32 B
+//   { LogChunkHeader, record * count } ...  chunk 반복
+//   LogIndexEntry * num_chunks             footer index
+//   LogTrailer                             24 B (파일 끝)
+// 파일 하나에는 한 종류의 고정 크기 record 만 들어간다.
+// trailer 가 없으면 (기록 중 중단) reader 가 chunk header 를 순서대로 훑어 index 를 복원한다.
+
+enum class LogRecordType : std::uint32_t {
+    Detection = 1,
+    Track = 2,
+    GroundTruth = 3
+};
+
+struct DetectionRecord {
+    double timestamp;
+    double z[3];          // Camera: x, y, 0 / Radar: r, phi, vr
+    double confidence;
+    std::uint32_t sensor; // SensorType
+    std::uint32_t dim;
+};
+
+struct TrackRecord {
+    double timestamp;
+    std::int32_t track_id;
+    std::uint32_t confirmed;
+    double x[4];          // x, y, vx, vy
+    std::int32_t missed;
+    std::int32_t age;
+};
+
+struct GroundTruthRecord {
+    double timestamp;
+    std::int32_t obj_id;
+    std::int32_t reserved;
+    double x[4];          // x, y, vx, vy
+};
+
+static_assert(sizeof(DetectionRecord) == 48, "DetectionRecord layout");
+static_assert(sizeof(TrackRecord) == 56, "TrackRecord layout");
+static_assert(sizeof(GroundTruthRecord) == 48, "GroundTruthRecord layout");
+
+template <typename Record> struct LogRecordTraits;
+template <> struct LogRecordTraits<DetectionRecord> {
+    static constexpr LogRecordType type = LogRecordType::Detection;
+};
+template <> struct LogRecordTraits<TrackRecord> {
+    static constexpr LogRecordType type = LogRecordType::Track;
+};
+template <> struct LogRecordTraits<GroundTruthRecord> {
+    static constexpr LogRecordType type = LogRecordType::GroundTruth;
+};
+
+constexpr std::uint64_t kLogMagic = 0x31474f4c5446534dULL;   // "MSFTLOG1"
+constexpr std::uint32_t kLogChunkMagic = 0x4b4e4843u;        // "CHNK"
+constexpr std::uint32_t kLogIndexMagic = 0x58444e49u;        // "INDX"
+constexpr std::uint32_t kLogVersion = 1;
+
+struct LogFileHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t record_type;
+    std::uint32_t record_size;
+    std::uint32_t reserved[3];
+};
+
+struct LogChunkHeader {
+    std::uint32_t magic;
+    std::uint32_t count;   // record 수
+    double t_min;
+    double t_max;
+    std::uint64_t reserved;
+};
+
+struct LogIndexEntry {
+    std::uint64_t offset;  // chunk header 의 파일 offset
+    std::uint32_t count;
+    std::uint32_t reserved;
+    double t_min;
+    double t_max;
+};
+
+struct LogTrailer {
+    std::uint64_t index_offset;
+    std::uint32_t num_chunks;
+    std::uint32_t magic;
+    std::uint64_t total_records;
+};
+
+static_assert(sizeof(LogFileHeader) == 32, "LogFileHeader layout");
+static_assert(sizeof(LogChunkHeader) == 32, "LogChunkHeader layout");
+static_assert(sizeof(LogIndexEntry) == 32, "LogIndexEntry layout");
+static_assert(sizeof(LogTrailer) == 24, "LogTrailer layout");
+
+// record 를 chunk 버퍼에 모았다가 chunk header 와 함께 writev 로 한 번에 기록
+class BinaryLogWriter {
+public:
+    BinaryLogWriter() = default;
+    ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    // 기존 파일은 덮어씀. 실패 시 false
+    bool open(const std::string& path, LogRecordType type, std::uint32_t record_size,
+              std::size_t records_per_chunk = 4096);
+
+    bool is_open() const { return fd_ >= 0; }
+
+    // record_size byte 를 복사. timestamp 순서는 자유 (chunk 마다 t_min / t_max 를 기록).
+    // 이전 I/O 오류가 있었으면 무시한다
+    void append(const void* record, double timestamp);
+
+    // Record 의 종류 / 크기가 open() 때와 다르면 기록하지 않고 false (log 가 깨지지 않게)
+    template <typename Record>
+    bool append(const Record& r) {
+        static_assert(std::is_trivially_copyable<Record>::value, "record must be POD");
+        if (!is_open() || LogRecordTraits<Record>::type != record_type_ ||
+            sizeof(Record) != record_size_) {
+            return false;
+        }
+        append(&r, r.timestamp);
+        return true;
+    }
+
+    // 남은 chunk, index, trailer 기록 후 닫음. I/O 오류가 있었으면 false
+    bool close();
+
+private:
+    bool write_all(const void* data, std::size_t bytes);
+    void flush_chunk();
+
+    int fd_{-1};
+    bool ok_{true};
+    std::uint64_t offset_{0};
+    LogRecordType record_type_{LogRecordType::Detection};
+    std::uint32_t record_size_{0};
+    std::size_t records_per_chunk_{0};
+
+    std::vector<char> chunk_;
+    std::uint32_t chunk_count_{0};
+    double chunk_t_min_{0.0};
+    double chunk_t_max_{0.0};
+    std::uint64_t total_records_{0};
+    std::vector<LogIndexEntry> index_;
+};
+
+// 파일 전체를 mmap 해서 chunk 별 record 를 복사 없이 노출
+class BinaryLogReader {
+public:
+    BinaryLogReader() = default;
+    ~BinaryLogReader();
+
+    BinaryLogReader(const BinaryLogReader&) = delete;
+    BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+    // 형식이 맞지 않으면 false
+    bool open(const std::string& path);
+    void close();
+
+    LogRecordType record_type() const { return static_cast<LogRecordType>(header_.record_type); }
+    std::uint32_t record_size() const { return header_.record_size; }
+
+    std::size_t num_chunks() const { return index_.size(); }
+    const LogIndexEntry& chunk_info(std::size_t c) const { return index_[c]; }
+    const void* chunk_data(std::size_t c) const {
+        return base_ + index_[c].offset + sizeof(LogChunkHeader);
+    }
+    std::uint64_t total_records() const { return total_records_; }
+
+    // 기록 중 중단돼 trailer 없이 복원된 파일이면 true
+    bool recovered() const { return recovered_; }
+
+    // t_max >= timestamp 인 첫 chunk (없으면 num_chunks()).
+    // chunk 의 t_max 가 증가 순이면 이진 탐색, 아니면 (순서가 뒤섞인 기록) 선형 탐색
+    std::size_t find_chunk(double timestamp) const;
+
+    // 타입이 맞지 않으면 nullptr
+    template <typename Record>
+    const Record* records(std::size_t c) const {
+        if (record_type() != LogRecordTraits<Record>::type || record_size() != sizeof(Record)) {
+            return nullptr;
+        }
+        return static_cast<const Record*>(chunk_data(c));
+    }
+
+private:
+    bool load_index();
+    bool scan_chunks();
+
+    int fd_{-1};
+    const char* base_{nullptr};
+    std::size_t size_{0};
+    LogFileHeader header_{};
+    std::vector<LogIndexEntry> index_;
+    std::uint64_t total_records_{0};
+    bool recovered_{false};
+    bool time_ordered_{true};
+};
+
+// Detection / TrackState 변환
+DetectionRecord to_record(const Detection& det);
+DetectionRecord to_record(const DetectionBatch& batch, std::size_t i);
+Detection from_record(const DetectionRecord& r);
+TrackRecord to_record(const TrackState& track, double timestamp);
+
+} // namespace msf
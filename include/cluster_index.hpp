@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+namespace msf {
+
+// 크기가 최대치를 넘을 때마다 재할당되지 않도록 여유를 두고 확보
+template <typename T, typename Alloc>
+void reserve_for(std::vector<T, Alloc>& v, std::size_t n) {
+    if (v.capacity() < n) {
+        v.reserve(2 * n);
+    }
+}
+
+// 이분 그래프 (예: track / detection 노드) 의 연결 요소 분해
+// association (optimal), JPDA, MHT 가 공통으로 쓴다.
+//   reset(n) → unite(a, b) 반복 → build(n_items, node_of)
+// item (간선 / tree 등) i 는 노드 node_of(i) 가 속한 cluster 로 묶이고, cluster 번호는
+// item 순서로 처음 나온 순서이므로 union 순서와 무관하게 결정적이다.
+// IntVec 은 std::vector<int> (프레임 간 재사용) 또는 std::pmr::vector<int> (frame arena)
+template <typename IntVec>
+struct ClusterIndex {
+    IntVec parent;            // union-find
+    IntVec cluster_of_root;
+    IntVec item_cluster;      // item → cluster
+    IntVec start;             // cluster c 의 item 은 items[start[c], start[c + 1]) (CSR)
+    IntVec items;             // cluster 별로, 같은 cluster 안에서는 item 순서
+    IntVec fill;
+
+    explicit ClusterIndex(const typename IntVec::allocator_type& alloc = {})
+        : parent(alloc), cluster_of_root(alloc), item_cluster(alloc),
+          start(alloc), items(alloc), fill(alloc) {}
+
+    // 프레임 중 재할당 방지용 (노드 수, item 수의 최대치 기준)
+    void reserve(std::size_t n_nodes, std::size_t n_items) {
+        reserve_for(parent, n_nodes);
+        reserve_for(cluster_of_root, n_nodes);
+        for (auto* v : {&item_cluster, &start, &items, &fill}) {
+            reserve_for(*v, n_items + 1);
+        }
+    }
+
+    void reset(int n_nodes) {
+        parent.resize(n_nodes);
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    // 경로 압축 (path halving)
+    int find(int a) {
+        while (parent[a] != a) {
+            parent[a] = parent[parent[a]];
+            a = parent[a];
+        }
+        return a;
+    }
+
+    void unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a != b) {
+            parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    // item 을 cluster 별로 모음 (counting sort). cluster 수를 돌려준다
+    template <typename NodeOf>
+    int build(int n_items, NodeOf node_of) {
+        cluster_of_root.assign(parent.size(), -1);
+        item_cluster.resize(n_items);
+        int n_clusters = 0;
+        for (int i = 0; i < n_items; ++i) {
+            const int root = find(node_of(i));
+            if (cluster_of_root[root] < 0) {
+                cluster_of_root[root] = n_clusters++;
+            }
+            item_cluster[i] = cluster_of_root[root];
+        }
+        start.assign(n_clusters + 1, 0);
+        for (int i = 0; i < n_items; ++i) {
+            ++start[item_cluster[i] + 1];
+        }
+        for (int c = 0; c < n_clusters; ++c) {
+            start[c + 1] += start[c];
+        }
+        fill.assign(start.begin(), start.end() - 1);
+        items.resize(n_items);
+        for (int i = 0; i < n_items; ++i) {
+            items[fill[item_cluster[i]]++] = i;
+        }
+        return n_clusters;
+    }
+
+    int num_clusters() const { return static_cast<int>(start.size()) - 1; }
+};
+
+// worker 가 공유 counter 에서 한 번에 가져가는 cluster 수 (대부분 track 1~2 개짜리라 작음)
+constexpr int kClusterChunk = 16;
+
+// cluster [0, n_clusters) 를 kClusterChunk 개씩 worker 에 동적 분배: fn(c0, c1, worker).
+// cluster 끼리 서로 다른 칸에만 쓰면 분배 순서와 무관하게 결과가 같다
+template <typename Fn>
+void for_each_cluster_chunk(ThreadPool& pool, int n_clusters, Fn&& fn) {
+    std::atomic<int> next{0};
+    pool.parallel_for(pool.size(), [&](std::size_t, std::size_t, int worker) {
+        for (int c0 = next.fetch_add(kClusterChunk); c0 < n_clusters;
+             c0 = next.fetch_add(kClusterChunk)) {
+            fn(c0, std::min(n_clusters, c0 + kClusterChunk), worker);
+        }
+    });
+}
+
+} // namespace msf
@@ -1,20 +1,54 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <memory_resource>
 #include <vector>
+#include "gating.hpp"
 
 namespace msf {
 
+// 아래 associate_* 함수는 마지막 인자 mr 로 내부 scratch 와 결과 vector 를 할당한다
+// (기본값은 일반 heap. tracker 는 FrameArena 를 넘겨 프레임 중 heap 할당을 없앤다)
+// 결과를 다른 AssociationResult 에 move 대입할 때는 같은 resource 여야 복사가 일어나지 않는다
 struct AssociationResult {
+    AssociationResult() = default;
+    explicit AssociationResult(std::pmr::memory_resource* mr)
+        : track_assignment(mr), unassigned_tracks(mr), unassigned_detections(mr) {}
+
     // track_assignment[i] = j → track i에 detection j 할당, 없으면 -1
-    std::vector<int> track_assignment;
-    std::vector<int> unassigned_tracks;
-    std::vector<int> unassigned_detections;
+    std::pmr::vector<int> track_assignment;
+    std::pmr::vector<int> unassigned_tracks;
+    std::pmr::vector<int> unassigned_detections;
 };
 
 // 비용 행렬(작을수록 좋은 cost)에 대해 greedy nearest-neighbor association
 // max_cost 보다 크면 매칭하지 않음
-AssociationResult associate_greedy(const Eigen::MatrixXd& cost_matrix,
-                                   double max_cost);
+AssociationResult associate_greedy(const Eigen::Ref<const Eigen::MatrixXd>& cost_matrix,
+                                   double max_cost,
+                                   std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+// gating 후보 목록(sparse cost)에 대한 greedy association
+AssociationResult associate_greedy(const std::vector<GateCandidate>& candidates,
+                                   int n_tracks,
+                                   int n_dets,
+                                   double max_cost,
+                                   std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+// 최적 association (비용 합 최소화)
+// gating 후보 그래프를 연결 요소(cluster) 로 나누고, 각 cluster 를
+// Jonker-Volgenant 계열 최단 증강 경로(shortest augmenting path) 로 독립적으로 푼다.
+// 매칭되지 않은 track 하나당 max_cost 를 비용으로 보고
+//   sum(매칭 cost) + max_cost * (미할당 track 수)
+// 를 최소화한다. max_cost 보다 큰 쌍은 매칭하지 않음
+AssociationResult associate_optimal(const std::vector<GateCandidate>& candidates,
+                                    int n_tracks,
+                                    int n_dets,
+                                    double max_cost,
+                                    std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+// dense 비용 행렬 버전 (max_cost 이하 원소만 후보로 변환해서 위 함수 사용)
+AssociationResult associate_optimal(const Eigen::Ref<const Eigen::MatrixXd>& cost_matrix,
+                                    double max_cost,
+                                    std::pmr::memory_resource* mr = std::pmr::get_default_resource());
 
 } // namespace msf
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <vector>
+#include "types.hpp"
+
+namespace msf {
+
+// 한 프레임의 detection 을 열(column) 단위로 연속 저장하는 컨테이너
+// - z 원소, Cartesian 위치(gating 용), timestamp 등을 각각 별도 배열로 보관
+// - clear() 는 capacity 를 유지하므로 프레임마다 재사용하면 steady state 에서 할당이 없다
+class DetectionBatch {
+public:
+    std::size_t size() const { return sensor_.size(); }
+    bool empty() const { return sensor_.empty(); }
+
+    void clear();
+    void reserve(std::size_t n);
+
+    void push_back(const Detection& det);
+    void push_camera(double x, double y, double timestamp, double confidence = 1.0);
+    void push_radar(double r, double phi, double vr, double timestamp, double confidence = 1.0);
+
+    // 크기를 n 으로 맞춘 뒤 (capacity 유지) 자리마다 직접 기록
+    // 서로 다른 i 는 여러 스레드에서 동시에 기록해도 된다 (병렬 simulator 용)
+    void resize(std::size_t n);
+    void set_camera(std::size_t i, double x, double y, double timestamp, double confidence = 1.0);
+    void set_radar(std::size_t i, double r, double phi, double vr, double timestamp,
+                   double confidence = 1.0);
+
+    // i 번째 detection 을 Detection 으로 재조립
+    Detection at(std::size_t i) const;
+
+    SensorType sensor(std::size_t i) const { return sensor_[i]; }
+    int dim(std::size_t i) const { return dim_[i]; }
+    double z(std::size_t i, int k) const { return z_[k][i]; }
+    Eigen::Vector2d camera_z(std::size_t i) const { return {z_[0][i], z_[1][i]}; }
+    Eigen::Vector3d radar_z(std::size_t i) const { return {z_[0][i], z_[1][i], z_[2][i]}; }
+    MeasVec meas(std::size_t i) const;
+
+    // Cartesian 위치 (Camera: x, y / Radar: r cos phi, r sin phi)
+    double pos_x(std::size_t i) const { return pos_x_[i]; }
+    double pos_y(std::size_t i) const { return pos_y_[i]; }
+
+    double timestamp(std::size_t i) const { return timestamp_[i]; }
+    double confidence(std::size_t i) const { return confidence_[i]; }
+
+    // 열 전체 접근 (association / gating kernel 용)
+    const std::vector<double>& z_column(int k) const { return z_[k]; }
+    const std::vector<double>& pos_x_column() const { return pos_x_; }
+    const std::vector<double>& pos_y_column() const { return pos_y_; }
+
+private:
+    void push(SensorType sensor, int dim, double z0, double z1, double z2,
+              double px, double py, double timestamp, double confidence);
+    void set(std::size_t i, SensorType sensor, int dim, double z0, double z1, double z2,
+             double px, double py, double timestamp, double confidence);
+
+    std::vector<SensorType> sensor_;
+    std::vector<int> dim_;
+    std::vector<double> z_[3];
+    std::vector<double> pos_x_;
+    std::vector<double> pos_y_;
+    std::vector<double> timestamp_;
+    std::vector<double> confidence_;
+};
+
+} // namespace msf
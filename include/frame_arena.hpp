@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace msf {
+
+// 프레임 단위 bump allocator (std::pmr::memory_resource)
+// tracker 가 update() 시작마다 reset() 하고, 프레임 안에서만 쓰는 임시 버퍼
+// (association scratch / 결과, dense cost 행렬 등) 를 여기서 할당한다.
+// deallocate 는 아무 일도 하지 않고 reset() 에서 한꺼번에 회수한다.
+//
+// 용량이 모자라면 heap 에서 추가 block 을 받아 그 프레임을 마치고,
+// 다음 reset() 때 이번 프레임 사용량에 맞춰 주 buffer 를 키운다.
+// 따라서 부하가 일정하면 몇 프레임 뒤부터는 heap 할당이 없다.
+// 단일 스레드 전용 (tracker 의 association 은 호출 스레드에서만 실행됨)
+class FrameArena : public std::pmr::memory_resource {
+public:
+    explicit FrameArena(std::size_t initial_bytes = 0);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // 이번 프레임 할당을 모두 버림 (overflow 가 있었으면 주 buffer 확장)
+    void reset();
+
+    std::size_t capacity() const { return capacity_; }
+    std::size_t used() const { return offset_ + overflow_bytes_; }   // 이번 프레임 사용량
+    std::size_t high_water() const { return high_water_; }
+    std::uint64_t overflow_count() const { return overflow_count_; } // 누적 heap fallback 횟수
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::unique_ptr<std::byte[]> buffer_;
+    std::size_t capacity_{0};
+    std::size_t offset_{0};
+
+    std::vector<std::unique_ptr<std::byte[]>> overflow_;
+    std::size_t overflow_bytes_{0};
+    std::size_t high_water_{0};
+    std::uint64_t overflow_count_{0};
+};
+
+} // namespace msf
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "types.hpp"
+#include "detection_batch.hpp"
+#include "spsc_queue.hpp"
+#include "tracker.hpp"
+
+namespace msf {
+
+struct PipelineParams {
+    // 센서 별 queue 용량 (detection 개수)
+    std::size_t queue_capacity{1 << 14};
+
+    // 지금까지 받은 가장 최근 timestamp 보다 latency_window 이상 오래된 detection 만 처리.
+    // 이 안에서 늦게 도착한 센서 데이터는 시간 순서대로 재정렬된다 [s]
+    double latency_window{0.05};
+
+    // 한 fusion cycle 로 묶을 timestamp 간격 (0 이면 같은 timestamp 끼리만 묶음) [s]
+    double cycle_period{0.0};
+
+    // 처리할 데이터가 없을 때 tracker 스레드 대기 시간 [us]
+    int idle_sleep_us{100};
+};
+
+// tracker 스레드가 fusion cycle 마다 publish 하는 track 상태
+struct TrackSnapshot {
+    std::uint64_t cycle{0};
+    double timestamp{0.0};
+    std::vector<TrackState> tracks;
+};
+
+struct PipelineStats {
+    std::uint64_t cycles{0};
+    std::uint64_t processed{0};       // tracker 에 들어간 detection 수
+    std::uint64_t dropped_late{0};    // window 밖으로 늦게 도착해 버린 detection 수
+    std::uint64_t dropped_full{0};    // queue 가 가득 차 push 실패한 detection 수
+};
+
+// 센서 별 SPSC queue → tracker 스레드 → snapshot 의 비동기 fusion front-end
+// - push() 는 센서 종류마다 producer 스레드 하나에서만 호출 (camera 스레드, radar 스레드)
+// - tracker 스레드가 detection 을 시간 순으로 정렬해 cycle 단위로 predict/update
+// - snapshot() 은 triple buffer 로 읽으므로 reader 와 tracker 가 서로를 기다리지 않는다
+//   (reader 스레드는 하나)
+// - window 를 넘겨 도착한 detection 은 tracker 의 OOSM 이 켜져 있으면
+//   (TrackerParams::oosm_history_size > 0) 그대로 넘기고, 아니면 버린다
+class FusionPipeline {
+public:
+    explicit FusionPipeline(const TrackerParams& tracker_params,
+                            const PipelineParams& params = PipelineParams{});
+    ~FusionPipeline();
+
+    FusionPipeline(const FusionPipeline&) = delete;
+    FusionPipeline& operator=(const FusionPipeline&) = delete;
+
+    void start();
+
+    // producer 가 모두 끝난 뒤 호출. 남은 detection 을 window 와 무관하게 처리하고 종료
+    void stop();
+
+    // queue 가 가득 차 있으면 false
+    bool push(const Detection& det);
+
+    // 가장 최근 publish 된 snapshot. 다음 snapshot() 호출 전까지 유효
+    const TrackSnapshot& snapshot();
+
+    PipelineStats stats() const;
+
+private:
+    static constexpr int kNumSensors = 2;
+
+    struct Pending {
+        Detection det;
+        std::uint64_t seq;
+    };
+
+    void run();
+    bool drain();
+    void process(bool flush);
+    void publish(double timestamp);
+
+    PipelineParams params_;
+    bool oosm_;
+    MultiSensorTracker tracker_;
+
+    std::unique_ptr<SpscQueue<Detection>> queues_[kNumSensors];
+    std::atomic<std::uint64_t> dropped_full_[kNumSensors];
+
+    // tracker 스레드 전용 상태
+    std::vector<Pending> pending_;
+    std::uint64_t next_seq_{0};
+    double newest_seen_{std::numeric_limits<double>::lowest()};
+    double last_cycle_time_{0.0};
+    bool any_cycle_{false};
+    DetectionBatch batch_;
+
+    std::atomic<std::uint64_t> cycles_{0};
+    std::atomic<std::uint64_t> processed_{0};
+    std::atomic<std::uint64_t> dropped_late_{0};
+
+    // triple buffer: back_ 은 tracker, front_ 는 reader 전용, middle_ 로 교환
+    static constexpr int kFresh = 4;
+    TrackSnapshot snapshots_[3];
+    int back_{0};
+    std::atomic<int> middle_{1};
+    int front_{2};
+
+    std::thread thread_;
+    std::atomic<bool> stop_{false};
+    bool running_{false};
+};
+
+} // namespace msf
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <vector>
+#include "types.hpp"
+
+namespace msf {
+
+// Gating 을 통과한 track-detection 후보 쌍 (sparse cost)
+struct GateCandidate {
+    int track;
+    int det;
+    double cost;   // Mahalanobis 거리 제곱
+};
+
+// detection 의 대략적인 Cartesian 위치
+// Camera: (x, y) 그대로, Radar: (r, phi) → (r cos phi, r sin phi)
+Eigen::Vector2d detection_position(const Detection& det);
+
+// 2D 점들을 균일 격자에 binning 해두고 원형 영역 질의를 빠르게 처리하는 구조
+// (CSR 형태: cell 별 시작 offset + point index 배열)
+class SpatialGrid {
+public:
+    explicit SpatialGrid(double cell_size = 10.0);
+
+    // points 로 격자 재구성. 셀 수가 점 수에 비해 너무 많아지면 cell 크기를 키움
+    // (NaN / inf 좌표의 점은 격자에 넣지 않으므로 query 결과에 나오지 않는다)
+    void build(const std::vector<Eigen::Vector2d>& points);
+
+    // (cx, cy) 중심, 반경 radius 원과 겹치는 셀의 point index 를 out 에 추가
+    // (셀 단위 coarse 질의라 실제 거리는 호출측에서 다시 확인해야 함)
+    void query(double cx, double cy, double radius, std::vector<int>& out) const;
+
+    double cell_size() const { return cell_size_; }
+
+private:
+    double base_cell_size_;
+    double cell_size_;
+    double min_x_{0.0};
+    double min_y_{0.0};
+    int nx_{0};
+    int ny_{0};
+    std::vector<int> cell_start_;   // size nx*ny + 1
+    std::vector<int> cell_points_;  // cell 순서로 정렬된 point index
+    std::vector<int> point_cell_;   // build 중 임시 버퍼
+    std::vector<int> cell_fill_;    // build 중 임시 버퍼
+};
+
+} // namespace msf
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <Eigen/Dense>
+#include "aligned_allocator.hpp"
+#include "detection_batch.hpp"
+#include "radar_batch.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// IMM 모델 공통 상태 [x, y, vx, vy, ax, ay, omega]
+// 앞 4 원소는 TrackState::x 와 같은 배치라 측정 모델 (camera, radar) 은 그대로 쓰고 나머지 열은 0.
+// 모델마다 쓰지 않는 원소는 predict 에서 0 으로 보낸다 (CV: a, omega / CA: omega / CT: a)
+namespace imm_state {
+constexpr int X = 0, Y = 1, VX = 2, VY = 3, AX = 4, AY = 5, OMEGA = 6;
+constexpr int kDim = 7;
+} // namespace imm_state
+
+using ImmVec = Eigen::Matrix<double, imm_state::kDim, 1>;
+using ImmMat = Eigen::Matrix<double, imm_state::kDim, imm_state::kDim>;
+
+enum class ImmModel : int {
+    CV = 0,   // constant velocity (process_noise_std)
+    CA = 1,   // constant acceleration (jerk 노이즈 imm_accel_noise_std)
+    CT = 2,   // coordinated turn, 회전율 omega 추정 (imm_turn_rate_noise_std)
+    kCount
+};
+constexpr int kImmModels = static_cast<int>(ImmModel::kCount);
+
+// MotionModel::IMM 에서 tracker 의 track 마다 모델별 상태 / 공분산 / 확률을 보관 (tracks_ 와 같은 순서)
+// TrackState::x, P 에는 모델 확률로 결합한 [x, y, vx, vy] 의 평균 / 공분산을 써 넣으므로
+// gating / association / OOSM history 는 CV 모드와 같은 코드를 쓴다.
+//
+// predict / update 는 track 구간 단위로 처리한다.
+// - dt 가 같은 연속 구간은 모델 행렬 (F, Q) 을 한 번만 만든다
+// - mixing 은 모델별 2 차 moment 를 한 번씩만 만들어 모든 목적 모델이 같이 쓴다
+// - radar 는 구간의 모든 (track, 모델) 상태를 SoA 로 모아 radar_predict_batch 한 번으로 h(x), H 계산
+class ImmFilterBank {
+public:
+    explicit ImmFilterBank(const TrackerParams& params);
+
+    std::size_t size() const { return mu_.size(); }
+    void reserve(std::size_t n);
+
+    // 새 track: 모든 모델을 같은 상태로 시작 (가속도 / 회전율은 0, 분산은 초기값)
+    void push_back(const Vec4& x, const Mat4& P);
+
+    // keep[i] == 0 인 항목 제거 (순서 유지)
+    void compact(const std::vector<char>& keep);
+
+    // [begin, end) track 을 timestamp 까지 mixing + 모델별 predict 하고 결합 추정을 tracks[i].x, P 에 기록
+    // dt 는 tracks[i].last_timestamp 기준 (age / last_timestamp 갱신은 호출측)
+    void predict(TrackState* tracks, std::size_t begin, std::size_t end, double timestamp);
+
+    // [begin, end) 중 assignment[i] >= 0 인 track 을 모델별 EKF update 하고
+    // 측정 likelihood 로 모델 확률을 갱신한 뒤 결합 추정을 tracks[i].x, P 에 기록
+    // (구간이 겹치지 않으면 여러 스레드에서 호출 가능)
+    void update(TrackState* tracks, std::size_t begin, std::size_t end,
+                const int* assignment, const DetectionBatch& detections,
+                const Eigen::Matrix2d& R_cam, const Eigen::Matrix3d& R_rad);
+
+    // 결합 추정 [x, y, vx, vy] 에 대한 정보형 측정 (정보 행렬 J, 정보 벡터 info:
+    // likelihood ∝ exp(-s^T J s / 2 + info^T s)) 을 모델마다 자기 상태로 update 하고
+    // 그 likelihood 로 모델 확률을 갱신한 뒤 결합 추정을 x, P 에 기록 (J 는 양의 준정부호여야 함)
+    void update_information(std::size_t i, const Mat4& J, const Vec4& info, Vec4& x, Mat4& P);
+
+    // 결합 추정을 바깥에서 (x_prior, P_prior) → (x, P) 로 보정한 결과 (OOSM replay, JPDA 혼합,
+    // track-to-track fusion) 를 같은 정보를 주는 pseudo-measurement 로 바꿔 update_information 으로 반영.
+    // x, P 는 모델을 다시 결합한 추정으로 바뀐다
+    void apply_correction(std::size_t i, const Vec4& x_prior, const Mat4& P_prior, Vec4& x, Mat4& P);
+
+    const Eigen::Vector3d& probabilities(std::size_t i) const { return mu_[i]; }
+    const ImmVec& model_state(std::size_t i, ImmModel m) const {
+        return x_[static_cast<int>(m)][i];
+    }
+
+private:
+    // dt 하나에 대한 모델 행렬 (CT 의 F 는 상태에 따라 달라서 track 마다 만든다)
+    struct ModelMatrices {
+        double dt{-1.0};
+        ImmMat F_cv, Q_cv;
+        ImmMat F_ca, Q_ca;
+        ImmMat Q_ct;
+    };
+
+    void build_matrices(double dt, ModelMatrices& m) const;
+    void mix(std::size_t i, std::array<ImmVec, kImmModels>& x0,
+             std::array<ImmMat, kImmModels>& P0);
+    void combine(std::size_t i, Vec4& x, Mat4& P) const;
+    // 모델별 측정 log-likelihood 로 mu_[i] 갱신 (모두 -inf 면 그대로)
+    void reweight(std::size_t i, const Eigen::Vector3d& log_l);
+
+    double sigma_cv_;
+    double sigma_jerk_;
+    double sigma_turn_rate_;
+    Eigen::Matrix3d trans_;   // trans_(i, j) = P(모델 j | 직전 모델 i)
+
+    std::array<std::vector<ImmVec>, kImmModels> x_;
+    std::array<std::vector<ImmMat>, kImmModels> P_;
+    std::vector<Eigen::Vector3d> mu_;
+
+    // radar batch kernel 입출력: (track i, 모델 m) → index kImmModels * i + m
+    AlignedDoubles rad_px_, rad_py_, rad_vx_, rad_vy_;
+    RadarPredictionSoA rad_pred_;
+};
+
+} // namespace msf
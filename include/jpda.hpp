@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "cluster_index.hpp"
+#include "frame_arena.hpp"
+#include "gating.hpp"
+#include "thread_pool.hpp"
+
+namespace msf {
+
+// JpdaSolver::solve() 한 번의 cluster 처리 내역
+struct JpdaStats {
+    int clusters{0};
+    int exact{0};           // 모든 joint event 열거
+    int k_best{0};          // Murty k-best 로 상위 event 만
+    int approximate{0};     // cheap JPDA
+    int max_cluster_tracks{0};
+    std::uint64_t events{0};   // 가중치를 더한 joint event 수 (exact + k-best)
+};
+
+// Joint Probabilistic Data Association 의 association 확률 계산
+// - gating 후보 그래프를 연결 요소 (cluster) 로 나누고, cluster 마다 독립적으로
+//   beta = P(detection 이 그 track 의 것), beta_miss = P(track 이 이번에 검출되지 않음) 를 구한다.
+// - joint event 가중치: prod(할당된 쌍의 likelihood) * prod(미검출 track 의 (1 - P_D))
+//   likelihood = P_D * N(y; 0, S) / (clutter 밀도) 라서 어느 track 에도 안 붙은 detection 은 1.
+// - cluster 크기에 따라
+//     event 수 <= max_events                             : 모든 event 열거 (정확)
+//     그 밖이고 track 수 <= k_best_max_tracks           : Murty k-best 로 가중치 상위 max_events 개
+//     그보다 크면                                        : cheap JPDA (Fitzgerald, 후보 수에 선형)
+//   이라 cluster 가 커져도 프레임 비용이 bounded.
+// - cluster 는 thread pool worker 가 공유 counter 로 가져가 처리하고 (worker 별 arena),
+//   결과는 스레드 수 / 처리 순서와 무관하다.
+class JpdaSolver {
+public:
+    // candidates 와 likelihood 는 같은 순서 (likelihood[k] > 0)
+    void solve(const std::vector<GateCandidate>& candidates,
+               const std::vector<double>& likelihood,
+               int n_tracks, int n_dets, double detection_prob,
+               int max_events, int k_best_max_tracks, ThreadPool& pool);
+
+    const std::vector<double>& beta() const { return beta_; }            // candidates 순서
+    const std::vector<double>& beta_miss() const { return beta_miss_; }  // track 별
+    const JpdaStats& stats() const { return stats_; }
+
+private:
+    struct ClusterView;
+    void solve_cluster(int c, FrameArena& arena);
+    // 아래 둘은 event 가중치를 beta_ / beta_miss_ 에 더하고 (합은 total) event 수를 반환
+    // (enumerate 는 total 이 nullptr 이면 가중치 없이 limit + 1 개까지만 센다)
+    std::uint64_t enumerate(const ClusterView& v, FrameArena& arena, double* total,
+                            std::uint64_t limit);
+    std::uint64_t k_best(const ClusterView& v, FrameArena& arena, double& total);
+    void approximate(const ClusterView& v, FrameArena& arena);
+    void add_event(const ClusterView& v, const int* choice, double w);
+
+    // solve() 입력 (solve 동안만 유효)
+    const GateCandidate* candidates_{nullptr};
+    const double* likelihood_{nullptr};
+    int n_tracks_{0};
+    double miss_weight_{0.0};   // 1 - P_D
+    int max_events_{0};
+    int k_best_max_tracks_{0};
+
+    std::vector<double> beta_;
+    std::vector<double> beta_miss_;
+    JpdaStats stats_;
+
+    // cluster 분해 (track 노드 [0, n_tracks), detection 노드 [n_tracks, n_tracks + n_dets)),
+    // item 은 후보 index
+    ClusterIndex<std::vector<int>> clusters_;
+    std::vector<int> local_index_;     // 노드 → cluster 안의 행 / 열 번호 (cluster 끼리 겹치지 않음)
+
+    // cluster 별 결과 (worker 가 자기 cluster 칸에만 씀)
+    std::vector<std::uint64_t> cluster_events_;
+    std::vector<char> cluster_method_;
+    std::vector<int> cluster_tracks_;
+
+    std::vector<std::unique_ptr<FrameArena>> arenas_;   // worker 별
+};
+
+} // namespace msf
@@ -4,32 +4,144 @@
 
 namespace msf {
 
+// 고정 크기 Kalman filter (모든 행렬이 고정 크기라 predict/update 에서 heap 할당 없음)
+// - 측정 업데이트는 S 의 LDLT 분해로 K 를 구함 (명시적 역행렬 사용 안 함)
+// - 공분산은 Joseph form 으로 갱신: P = (I - K H) P (I - K H)^T + K R K^T
+//
+// 멤버 함수는 내부 상태 (x_, P_) 에 대해 동작하고,
+// 같은 이름의 static 함수는 외부 상태 (예: TrackState::x, P) 에 직접 적용된다.
+template <int StateDim>
 class KalmanFilter {
 public:
-    explicit KalmanFilter(int dim_x);
+    using StateVec = Eigen::Matrix<double, StateDim, 1>;
+    using StateMat = Eigen::Matrix<double, StateDim, StateDim>;
 
-    void init(const Eigen::VectorXd& x0, const Eigen::MatrixXd& P0);
+    template <int MeasDim>
+    using MeasVec = Eigen::Matrix<double, MeasDim, 1>;
+    template <int MeasDim>
+    using MeasMat = Eigen::Matrix<double, MeasDim, MeasDim>;
+    template <int MeasDim>
+    using ObsMat = Eigen::Matrix<double, MeasDim, StateDim>;
 
-    void setF(const Eigen::MatrixXd& F) { F_ = F; }
-    void setQ(const Eigen::MatrixXd& Q) { Q_ = Q; }
+    KalmanFilter() = default;
+
+    void init(const StateVec& x0, const StateMat& P0) {
+        x_ = x0;
+        P_ = P0;
+    }
+
+    void setF(const StateMat& F) { F_ = F; }
+    void setQ(const StateMat& Q) { Q_ = Q; }
 
     // F, Q를 이미 설정해뒀다는 가정 하에 predict
-    void predict();
+    void predict() { predict(x_, P_, F_, Q_); }
+
+    // 선형 측정 업데이트 (innovation = z - H x)
+    // S 가 양의 정부호가 아니면 상태를 바꾸지 않고 false 반환
+    template <int MeasDim>
+    bool update(const MeasVec<MeasDim>& z,
+                const ObsMat<MeasDim>& H,
+                const MeasMat<MeasDim>& R) {
+        const MeasVec<MeasDim> y = z - H * x_;
+        return update_innovation<MeasDim>(x_, P_, y, H, R);
+    }
+
+    // innovation y 를 호출측에서 계산한 경우 (EKF: 비선형 h(x), 각도 정규화 등)
+    template <int MeasDim>
+    bool update_innovation(const MeasVec<MeasDim>& y,
+                           const ObsMat<MeasDim>& H,
+                           const MeasMat<MeasDim>& R) {
+        return update_innovation<MeasDim>(x_, P_, y, H, R);
+    }
+
+    const StateVec& x() const { return x_; }
+    const StateMat& P() const { return P_; }
+
+    static void predict(StateVec& x, StateMat& P,
+                        const StateMat& F, const StateMat& Q) {
+        x = F * x;
+        P = F * P * F.transpose() + Q;
+    }
+
+    template <int MeasDim>
+    static bool update_innovation(StateVec& x, StateMat& P,
+                                  const MeasVec<MeasDim>& y,
+                                  const ObsMat<MeasDim>& H,
+                                  const MeasMat<MeasDim>& R) {
+        // PHt = P H^T,  S = H P H^T + R
+        const Eigen::Matrix<double, StateDim, MeasDim> PHt = P * H.transpose();
+        const MeasMat<MeasDim> S = H * PHt + R;
 
-    // 선형 측정 업데이트
-    void update(const Eigen::VectorXd& z,
-                const Eigen::MatrixXd& H,
-                const Eigen::MatrixXd& R);
+        const Eigen::LDLT<MeasMat<MeasDim>> ldlt(S);
+        if (ldlt.info() != Eigen::Success || !ldlt.isPositive()) {
+            return false;
+        }
+        update_factored<MeasDim>(x, P, y, H, PHt, ldlt, R);
+        return true;
+    }
 
-    const Eigen::VectorXd& x() const { return x_; }
-    const Eigen::MatrixXd& P() const { return P_; }
+    // P H^T 와 S 의 LDLT 분해를 호출측에서 이미 가진 경우 (gating 에서 계산한 값 재사용)
+    // ldlt 는 양의 정부호 S 의 분해여야 한다
+    template <int MeasDim>
+    static void update_factored(StateVec& x, StateMat& P,
+                                const MeasVec<MeasDim>& y,
+                                const ObsMat<MeasDim>& H,
+                                const Eigen::Matrix<double, StateDim, MeasDim>& PHt,
+                                const Eigen::LDLT<MeasMat<MeasDim>>& ldlt,
+                                const MeasMat<MeasDim>& R) {
+        // K = P H^T S^-1  →  K^T = S^-1 (H P)   (S, P 대칭)
+        const Eigen::Matrix<double, StateDim, MeasDim> K =
+            ldlt.solve(PHt.transpose()).transpose();
+
+        x += K * y;
+
+        StateMat I_KH = StateMat::Identity();
+        I_KH.noalias() -= K * H;
+        P = I_KH * P * I_KH.transpose() + K * R * K.transpose();
+    }
+
+    // 선형화 H 대신 상태-측정 교차 공분산 Pxz 와 S 분해를 가진 경우 (UKF)
+    // K = Pxz S^-1,  x += K y,  P -= K S K^T = K Pxz^T
+    template <int MeasDim>
+    static void update_cross(StateVec& x, StateMat& P,
+                             const MeasVec<MeasDim>& y,
+                             const Eigen::Matrix<double, StateDim, MeasDim>& Pxz,
+                             const Eigen::LDLT<MeasMat<MeasDim>>& ldlt) {
+        const Eigen::Matrix<double, StateDim, MeasDim> K =
+            ldlt.solve(Pxz.transpose()).transpose();
+
+        x += K * y;
+        P.noalias() -= K * Pxz.transpose();
+        // Joseph form 이 없으므로 반올림으로 생기는 비대칭만 제거
+        P = 0.5 * (P + P.transpose()).eval();
+    }
+
+    // 정보 형태 다중 측정 업데이트: 같은 선형화 점에서 측정 k 들의
+    //   J = sum H_k^T R_k^-1 H_k,  g = sum H_k^T R_k^-1 y_k
+    // 를 호출측이 누적해 넘기면 Y = P^-1 + J 로 측정 수와 무관하게 분해 한 번에 끝난다.
+    // P^-1 을 따로 만들지 않도록 Y^-1 = (I + P J)^-1 P 로 푼다
+    // (I + P J 의 고유값은 1 이상이라 P 가 양의 정부호이면 항상 가역)
+    static void update_information(StateVec& x, StateMat& P,
+                                   const StateMat& J, const StateVec& g) {
+        StateMat A = StateMat::Identity();
+        A.noalias() += P * J;
+        const Eigen::PartialPivLU<StateMat> lu(A);
+
+        P = lu.solve(P);
+        P = 0.5 * (P + P.transpose()).eval();
+        x.noalias() += P * g;
+    }
 
 private:
-    int dim_x_;
-    Eigen::VectorXd x_;
-    Eigen::MatrixXd P_;
-    Eigen::MatrixXd F_;
-    Eigen::MatrixXd Q_;
+    StateVec x_{StateVec::Zero()};
+    StateMat P_{StateMat::Identity()};
+    StateMat F_{StateMat::Identity()};
+    StateMat Q_{StateMat::Zero()};
 };
 
+// tracker 의 constant velocity 상태 [x, y, vx, vy] 용
+extern template class KalmanFilter<4>;
+// IMM 공통 상태 [x, y, vx, vy, ax, ay, omega] 용 (imm.hpp)
+extern template class KalmanFilter<7>;
+
 } // namespace msf
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+namespace msf {
+
+// 행 수 n <= 열 수 m 인 dense 할당 문제 (row-major cost, n x m) 를
+// potential 기반 최단 증강 경로(Jonker-Volgenant / Hungarian) 로 푼다.
+// row_to_col[i] 에 행 i 에 할당된 열을 기록. O(n^2 m)
+struct LapSolver {
+    explicit LapSolver(std::pmr::memory_resource* mr)
+        : u(mr), v(mr), minv(mr), p(mr), way(mr), used(mr) {}
+
+    std::pmr::vector<double> u, v, minv;
+    std::pmr::vector<int> p, way;
+    std::pmr::vector<char> used;
+
+    void solve(const std::pmr::vector<double>& cost, int n, int m,
+               std::pmr::vector<int>& row_to_col) {
+        const double inf = std::numeric_limits<double>::infinity();
+        u.assign(n + 1, 0.0);
+        v.assign(m + 1, 0.0);
+        p.assign(m + 1, 0);
+        way.assign(m + 1, 0);
+
+        for (int i = 1; i <= n; ++i) {
+            p[0] = i;
+            int j0 = 0;
+            minv.assign(m + 1, inf);
+            used.assign(m + 1, 0);
+            do {
+                used[j0] = 1;
+                const int i0 = p[j0];
+                const double* row = &cost[static_cast<size_t>(i0 - 1) * m];
+                double delta = inf;
+                int j1 = 0;
+                for (int j = 1; j <= m; ++j) {
+                    if (used[j]) continue;
+                    const double cur = row[j - 1] - u[i0] - v[j];
+                    if (cur < minv[j]) {
+                        minv[j] = cur;
+                        way[j] = j0;
+                    }
+                    if (minv[j] < delta) {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+                for (int j = 0; j <= m; ++j) {
+                    if (used[j]) {
+                        u[p[j]] += delta;
+                        v[j] -= delta;
+                    } else {
+                        minv[j] -= delta;
+                    }
+                }
+                j0 = j1;
+            } while (p[j0] != 0);
+
+            // 증강 경로를 따라 할당 갱신
+            do {
+                const int j1 = way[j0];
+                p[j0] = p[j1];
+                j0 = j1;
+            } while (j0 != 0);
+        }
+
+        row_to_col.assign(n, -1);
+        for (int j = 1; j <= m; ++j) {
+            if (p[j] != 0) {
+                row_to_col[p[j] - 1] = j - 1;
+            }
+        }
+    }
+};
+
+} // namespace msf
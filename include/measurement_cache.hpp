@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <limits>
+#include "types.hpp"
+
+namespace msf {
+
+// track 하나의 센서별 예측 측정 (h(x), H, P H^T, S 의 LDLT 분해)
+// track 상태에만 의존하므로 프레임마다 track 당 한 번 계산해서
+// gating 의 모든 후보 쌍과 EKF update 가 같이 쓴다
+// UKF 로 채운 경우 (radar_unscented_moments) PHt 에는 교차 공분산 Pxz 가 들어가고 H 는 쓰지 않는다
+template <int MeasDim>
+struct PredictedMeasurement {
+    using Vec = Eigen::Matrix<double, MeasDim, 1>;
+    using Mat = Eigen::Matrix<double, MeasDim, MeasDim>;
+
+    Vec z_pred{Vec::Zero()};
+    Eigen::Matrix<double, MeasDim, 4> H{Eigen::Matrix<double, MeasDim, 4>::Zero()};
+    Eigen::Matrix<double, 4, MeasDim> PHt{Eigen::Matrix<double, 4, MeasDim>::Zero()};
+    Eigen::LDLT<Mat> S_ldlt;
+    bool valid{false};   // S 가 양의 정부호일 때만 true
+
+    // S = H P H^T + R 분해 (z_pred, H 는 호출측에서 채운 뒤)
+    void factorize(const Mat4& P, const Mat& R) {
+        PHt.noalias() = P * H.transpose();
+        const Mat S = H * PHt + R;
+        S_ldlt.compute(S);
+        valid = S_ldlt.info() == Eigen::Success && S_ldlt.isPositive();
+    }
+
+    // y^T S^-1 y (분해가 실패한 track 은 inf)
+    double mahalanobis_sq(const Vec& y) const {
+        if (!valid) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return y.dot(S_ldlt.solve(y));
+    }
+};
+
+struct MeasurementCache {
+    PredictedMeasurement<2> camera;
+    PredictedMeasurement<3> radar;
+
+    void compute_camera(const Vec4& x, const Mat4& P, const Eigen::Matrix2d& R);
+    void compute_radar(const Vec4& x, const Mat4& P, const Eigen::Matrix3d& R);
+};
+
+} // namespace msf
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "cluster_index.hpp"
+#include "frame_arena.hpp"
+#include "gating.hpp"
+#include "thread_pool.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// MhtEngine::update() 한 번 (scan 하나) 의 처리 내역
+struct MhtStats {
+    int trees{0};              // 살아 있는 track tree 수 (update 후)
+    int leaves{0};             // 살아 있는 track hypothesis (leaf) 수 (update 후)
+    int nodes{0};              // 사용 중인 node pool 칸 (leaf + 확정 전 내부 node)
+    int clusters{0};
+    int truncated{0};          // 탐색 node 상한에 걸린 cluster
+    int degraded{0};           // 프레임 시간 예산을 넘어 greedy 하나로 끝낸 cluster
+    int dropped{0};            // node pool 이 모자라 버린 leaf
+    std::uint64_t searched{0}; // 전역 hypothesis 탐색 node 수
+};
+
+// Track-oriented Multiple Hypothesis Tracking
+// - target 마다 hypothesis tree 하나. leaf 가 그 target 의 track hypothesis (상태 + 누적 점수) 이고
+//   scan 마다 leaf 하나가 미검출 / 게이트 안 detection 하나씩으로 갈라진다. detection 마다 새 tree 도 하나 생긴다.
+//   점수는 log likelihood ratio: 검출 log(P_D N(y; 0, S) / clutter 밀도), 미검출 log(1 - P_D).
+// - 전역 hypothesis = tree 마다 leaf 하나 (또는 없음) 를 고르되 최근 N + 1 scan 의 detection 을
+//   두 leaf 가 같이 쓰지 않는 조합. detection 을 공유하는 tree 끼리 cluster 로 나눠
+//   cluster 별로 점수 상위 k_best 개를 branch and bound 로 찾는다 (탐색 node 상한 있음).
+// - pruning (hypothesis 수 bounded):
+//     k_best 개 전역 hypothesis 어디에도 없는 leaf, 점수가 delete_score 미만이거나
+//     max_missed 를 넘게 연속 미검출인 leaf 는 버리고, tree 별 leaf 는 점수 상위 max_leaves_per_track 개까지.
+//     N-scan-back: 최적 hypothesis 의 leaf 에서 N scan 전 조상만 남기고 나머지 분기는 제거,
+//     그 조상을 새 root 로 확정해서 더 오래된 node 는 pool 로 돌려준다.
+// - node 는 생성 시 한 번 확보한 pool (mht_max_nodes 칸) 에서만 꺼내 쓰므로 메모리는 고정이고,
+//   모자라면 최적 hypothesis 밖의 점수 낮은 leaf 부터 버린다.
+//   mht_time_budget_ms > 0 이면 예산을 넘긴 뒤의 cluster 는 탐색 없이 greedy 한 번으로 끝낸다.
+// - cluster 탐색은 thread pool worker 가 공유 counter 로 나눠 가지며 (worker 별 arena)
+//   시간 예산이 걸리지 않는 한 결과는 스레드 수와 무관하다.
+//
+// 측정 모델 / 필터 계산은 호출측 (MultiSensorTracker) 이 한다:
+//   leaves() 를 예측 → gating → 후보 쌍 likelihood 와 posterior 를 계산해서 update() 에 넘긴다.
+class MhtEngine {
+public:
+    explicit MhtEngine(const TrackerParams& params);
+
+    // 살아 있는 track hypothesis (id = tree id). 호출측이 predict / gating 에 쓰고
+    // update() 가 다음 scan 의 leaf 로 다시 채운다
+    std::vector<TrackState>& leaves() { return leaves_; }
+    const std::vector<TrackState>& leaves() const { return leaves_; }
+
+    // scan 하나 반영
+    //   candidates: leaves() index 와 detection 의 게이트 통과 쌍, likelihood 는 같은 순서
+    //   posterior: candidates 순서로 그 detection 을 반영한 leaf 상태 (x, P)
+    //   births: detection 별 새 track 의 초기 상태 (x, P, last_timestamp)
+    void update(const std::vector<GateCandidate>& candidates,
+                const std::vector<double>& likelihood,
+                const std::vector<TrackState>& posterior,
+                const std::vector<TrackState>& births, ThreadPool& pool);
+
+    // cluster 별 최적 전역 hypothesis 의 track (tree id 오름차순)
+    const std::vector<TrackState>& best_tracks() const { return best_; }
+
+    const MhtStats& stats() const { return stats_; }
+    std::size_t node_capacity() const { return nodes_.size(); }
+
+private:
+    // pool 의 tree node (leaf 이면 state 가 track hypothesis)
+    struct Node {
+        TrackState state;
+        double score{0.0};
+        int parent{-1};
+        int refs{0};               // 살아 있는 자식 수 + (살아 있는 leaf 면 1)
+        int scan{0};
+        std::int64_t det{-1};      // scan 전체에서 유일한 detection 번호 (-1: 미검출)
+    };
+
+    // 이번 scan 에 만든 leaf 후보 (pool 에 넣기 전)
+    struct Child {
+        double score;
+        int tree;                  // 이번 scan 의 tree 번호
+        int leaf;                  // 갈라져 나온 leaves_ index (-1: 새 tree)
+        int cand;                  // 반영한 candidates index (-1: 미검출 또는 새 tree)
+        int det;                   // 이번 scan detection index (-1: 미검출)
+        int anchor;                // N scan 전 조상 node (-1: 아직 그만큼 깊지 않음)
+    };
+
+    // cluster c 의 상위 k_best 전역 hypothesis 를 찾아 keep_ 표시 (greedy_only 면 greedy 한 번)
+    void solve_cluster(int c, FrameArena& arena, bool greedy_only);
+    int allocate_node();
+    void release(int node);
+
+    TrackerParams params_;
+    double log_miss_{0.0};
+
+    std::vector<Node> nodes_;          // 고정 크기 pool
+    std::vector<int> free_;            // 빈 칸 (stack)
+    std::vector<int> leaf_node_;       // leaves_[i] 의 node
+    std::vector<TrackState> leaves_;
+    std::vector<TrackState> best_;
+    int next_tree_id_{0};
+    int scan_{0};
+    std::int64_t det_base_{0};         // 이번 scan 첫 detection 의 번호
+    std::int64_t next_det_{0};         // 다음 scan 의 det_base_
+    std::int64_t window_base_{0};      // 최근 N + 1 scan 중 가장 오래된 scan 의 첫 detection 번호
+    std::vector<std::int64_t> scan_base_;   // 최근 N + 1 scan 의 det_base_ (scan % (N + 1))
+    MhtStats stats_;
+
+    // scan scratch (크기가 최대치를 넘을 때만 재할당)
+    std::vector<int> cand_start_;      // leaf 별 candidates 구간 (CSR)
+    std::vector<int> cand_order_;
+    std::vector<Child> children_;
+    std::vector<int> tree_start_;      // tree 별 children_ 구간
+    std::vector<int> tree_id_;         // tree 번호 → tree id (-1: 이번 scan 에 생긴 tree, 살아남으면 부여)
+    std::vector<int> tree_anchor_;     // tree 번호 → N-scan 확정 기준 node
+    std::vector<int> path_start_;      // child 별 최근 N + 1 scan detection 목록 (CSR, window index)
+    std::vector<int> path_det_;
+    // window detection 을 공유하는 tree 끼리 cluster
+    // (tree 노드 [0, n_trees), detection 노드 뒤, item 은 tree 번호)
+    ClusterIndex<std::vector<int>> clusters_;
+    std::vector<int> fill_;
+    std::vector<int> local_det_;       // window detection → cluster 안 번호
+    std::vector<char> cluster_flags_;  // bit 0: truncated, bit 1: degraded
+    std::vector<std::uint64_t> cluster_searched_;
+    std::vector<char> keep_;           // child 별: 1 = k-best 에 있음, 2 = 최적 hypothesis
+    std::vector<int> order_;           // 살아남은 child
+    std::vector<int> next_leaf_node_;  // 새 leaf (leaf_node_ / leaves_ 와 swap)
+    std::vector<TrackState> next_leaves_;
+
+    std::vector<std::unique_ptr<FrameArena>> arenas_;   // worker 별
+};
+
+} // namespace msf
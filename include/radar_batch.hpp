@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include "aligned_allocator.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// N 개 상태에 대한 radar 예측 측정 h(x) = [r, phi, r_dot] 와 Jacobian (SoA 출력)
+// Jacobian 의 0 이 아닌 원소는 6 종류뿐이라 그것만 보관한다
+//   H = [[ ux,  uy,  0,  0],      ux, uy = (px, py) / r
+//        [ ax,  ay,  0,  0],      ax, ay = (-py, px) / r^2
+//        [ dx,  dy, ux, uy]]      dx, dy = d r_dot / d(px, py)
+// r, r^2 이 너무 작으면 radar_measurement / radar_H_jacobian 과 같이 r_dot, H 를 0 으로 둔다.
+struct RadarPredictionSoA {
+    AlignedDoubles rho, phi, rho_dot;
+    AlignedDoubles ux, uy;
+    AlignedDoubles ax, ay;
+    AlignedDoubles dx, dy;
+
+    void resize(std::size_t n);
+    void reserve(std::size_t n);
+    std::size_t size() const { return rho.size(); }
+
+    Eigen::Vector3d z(std::size_t i) const { return {rho[i], phi[i], rho_dot[i]}; }
+    Eigen::Matrix<double, 3, 4> H(std::size_t i) const;
+};
+
+// [begin, end) 구간의 상태 (px, py, vx, vy 각각 연속 배열) 에 대해 out 의 같은 index 를 채운다
+// (out 은 end 이상 크기로 resize 돼 있어야 함. 구간이 겹치지 않으면 여러 스레드에서 호출 가능)
+// - sqrt 와 나눗셈은 track 당 한 번 (1/r) 만 하고 나머지는 곱셈
+// - phi 는 다항식 atan2 근사 (최대 오차 radar_atan2_max_error() 이하)
+// - AVX-512 / AVX2+FMA 를 지원하면 실행 시 선택, 아니면 같은 식의 scalar kernel
+//   (SIMD 의 나머지 원소도 같은 FMA 순서로 계산하므로 결과는 구간을 어떻게 나누든 bit 단위로 같다)
+void radar_predict_batch(const double* px, const double* py,
+                         const double* vx, const double* vy,
+                         std::size_t begin, std::size_t end,
+                         RadarPredictionSoA& out);
+
+// h(x) 만 계산하는 같은 kernel (Jacobian 생략). 출력 배열은 [begin, end) 를 담을 수 있어야 한다.
+// UKF 의 sigma point 를 한 번에 변환할 때 사용
+void radar_measurement_batch(const double* px, const double* py,
+                             const double* vx, const double* vy,
+                             std::size_t begin, std::size_t end,
+                             double* rho, double* phi, double* rho_dot);
+
+// 위 kernel 들의 atan2 근사 최대 절대 오차 [rad]
+constexpr double radar_atan2_max_error() { return 1e-7; }
+
+// 현재 CPU 에서 선택된 kernel 이름 ("avx512", "avx2", "scalar")
+const char* radar_batch_backend();
+
+} // namespace msf
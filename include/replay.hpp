@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "types.hpp"
+#include "binary_log.hpp"
+#include "detection_batch.hpp"
+#include "tracker.hpp"
+
+namespace msf {
+
+// 기록된 detection log 를 프레임 (같은 timestamp 묶음) 단위로 읽는다
+// - *.bin: BinaryLogReader 로 mmap, chunk 경계를 넘어 순차로 읽음
+// - 그 외: run_simulation 의 detections.csv 형식을 한 줄씩 스트리밍
+// 어느 쪽이든 파일 전체를 메모리에 올리지 않는다
+class DetectionLogReader {
+public:
+    // 파일 앞부분의 magic 으로 형식을 판별. 열 수 없으면 false
+    bool open(const std::string& path);
+
+    // 다음 프레임을 out 에 채움 (out 은 clear 후 채움). 끝이면 false
+    bool next_frame(DetectionBatch& out);
+
+    // 마지막으로 읽은 프레임의 timestamp
+    double frame_time() const { return frame_time_; }
+
+    bool is_binary() const { return binary_; }
+
+private:
+    bool next_record(DetectionRecord& r);
+    bool parse_csv_line(DetectionRecord& r);
+
+    bool binary_{false};
+    BinaryLogReader bin_;
+    std::size_t chunk_{0};
+    std::uint32_t pos_{0};
+
+    std::ifstream csv_;
+    std::string line_;
+
+    bool has_pending_{false};
+    DetectionRecord pending_{};
+    double frame_time_{0.0};
+};
+
+struct ReplayParams {
+    // 재생 속도 배율 (1 = 실시간, 0 이하 = 최대 속도)
+    double speed{0.0};
+    // 처리할 최대 프레임 수 (0 이하 = 전체)
+    int max_frames{0};
+};
+
+struct ReplayStats {
+    std::size_t frames{0};
+    std::size_t detections{0};
+    double wall_s{0.0};
+    std::vector<double> frame_ms;   // 프레임별 predict + update 시간
+
+    // q in [0, 1], nearest-rank
+    double latency_percentile(double q) const;
+};
+
+// reader 의 프레임을 순서대로 tracker 에 넣는다.
+// on_frame 이 있으면 프레임마다 (timestamp, tracks) 로 호출 (시간 측정에서 제외)
+ReplayStats replay(DetectionLogReader& reader,
+                   MultiSensorTracker& tracker,
+                   const ReplayParams& params = ReplayParams{},
+                   const std::function<void(double, const std::vector<TrackState>&)>& on_frame = {});
+
+} // namespace msf
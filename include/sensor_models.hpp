@@ -12,7 +12,7 @@ Eigen::Matrix<double, 2, 4> camera_H();
 Eigen::Vector3d radar_measurement(const Vec4& x);
 Eigen::Matrix<double, 3, 4> radar_H_jacobian(const Vec4& x);
 
-// Radar 각도 차이를 [-pi, pi] 로 정규화
+// Radar 각도 차이를 [-pi, pi] 로 정규화 (branch-free)
 double normalize_angle(double angle);
 
 } // namespace msf
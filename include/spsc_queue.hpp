@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace msf {
+
+// single-producer / single-consumer lock-free ring buffer
+// - producer 스레드 하나만 try_push, consumer 스레드 하나만 try_pop 을 호출해야 한다
+// - 용량은 2 의 거듭제곱으로 올림하며 생성 시 한 번만 할당한다
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity) {
+        std::size_t n = 1;
+        while (n < capacity) n <<= 1;
+        buf_.resize(n);
+        mask_ = n - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    std::size_t capacity() const { return buf_.size(); }
+
+    // 가득 차 있으면 false (producer 전용)
+    bool try_push(const T& v) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_cache_ == buf_.size()) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head - tail_cache_ == buf_.size()) {
+                return false;
+            }
+        }
+        buf_[head & mask_] = v;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 비어 있으면 false (consumer 전용)
+    bool try_pop(T& out) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail == head_cache_) {
+                return false;
+            }
+        }
+        out = buf_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 다른 스레드가 동시에 push/pop 중이면 근사값
+    std::size_t size_approx() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    std::vector<T> buf_;
+    std::size_t mask_{0};
+
+    // producer 쪽 (head_ 기록, tail_ 캐시)
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t tail_cache_{0};
+
+    // consumer 쪽 (tail_ 기록, head_ 캐시)
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t head_cache_{0};
+};
+
+} // namespace msf
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace msf {
+
+// 고정 분할(fixed-partition) thread pool
+// parallel_for(n, fn) 은 [0, n) 을 스레드 수만큼 연속 구간으로 나눠
+// fn(begin, end, worker) 를 호출한다. 구간 분할이 n 과 스레드 수로만 결정되므로
+// worker 별 결과를 worker 순서대로 합치면 단일 스레드 실행과 같은 순서가 된다.
+// 호출 스레드도 worker 0 으로 참여한다.
+class ThreadPool {
+public:
+    // num_threads: 호출 스레드를 포함한 전체 스레드 수 (1 이면 추가 스레드 없음)
+    explicit ThreadPool(int num_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return num_threads_; }
+
+    template <typename Fn>
+    void parallel_for(std::size_t n, Fn&& fn) {
+        using F = std::remove_reference_t<Fn>;
+        run(n,
+            [](void* ctx, std::size_t begin, std::size_t end, int worker) {
+                (*static_cast<F*>(ctx))(begin, end, worker);
+            },
+            const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+private:
+    using Task = void (*)(void*, std::size_t, std::size_t, int);
+
+    void run(std::size_t n, Task task, void* ctx);
+    void worker_loop(int worker);
+    void run_partition(int worker);
+
+    int num_threads_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+
+    // 현재 작업 (mutex_ 로 보호, generation_ 이 바뀌면 새 작업)
+    Task task_{nullptr};
+    void* ctx_{nullptr};
+    std::size_t n_{0};
+    std::uint64_t generation_{0};
+    int pending_{0};
+    bool stop_{false};
+};
+
+} // namespace msf
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace msf {
+
+// track-to-track fusion: 같은 시각의 두 추정 (x, P), (xb, Pb) 을 하나로 합쳐 x, P 에 기록
+// 둘 다 측정 모델 H = I 인 Kalman update 로 계산한다 (y = xb - x, R = Pb)
+// 분해가 실패하면 x, P 를 바꾸지 않고 false
+
+// 두 추정의 오차가 독립이라고 보고 정보 (P^-1) 를 더한다
+//   P^-1 = Pa^-1 + Pb^-1
+// 센서 tracker 와 system track 이 같은 측정을 공유하면 공분산이 과소평가된다
+bool fuse_information(Vec4& x, Mat4& P, const Vec4& xb, const Mat4& Pb);
+
+// Covariance intersection: 상관을 모르더라도 일관된 (과소평가하지 않는) 결과
+//   P^-1 = w Pa^-1 + (1 - w) Pb^-1
+// = Pa / w, Pb / (1 - w) 로 키운 두 추정의 정보 융합
+bool fuse_covariance_intersection(Vec4& x, Mat4& P, const Vec4& xb, const Mat4& Pb);
+
+// CI 가중치 w (fast CI: trace 비율, 반복 최적화 없이 tr(P) 최소에 가까운 값)
+//   w = tr(Pb) / (tr(Pa) + tr(Pb)),  [0.05, 0.95] 로 제한
+double covariance_intersection_weight(const Mat4& Pa, const Mat4& Pb);
+
+// 두 추정 차이의 Mahalanobis 거리 제곱 (S = Pa + Pb, 분해 실패 시 inf)
+double track_distance_sq(const Vec4& xa, const Mat4& Pa, const Vec4& xb, const Mat4& Pb);
+
+} // namespace msf
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "types.hpp"
+
+namespace msf {
+
+// track 하나의 과거 posterior 기록 (out-of-sequence measurement 처리용)
+struct HistoryEntry {
+    double timestamp{0.0};
+    Vec4 x{Vec4::Zero()};      // timestamp 시점 posterior
+    Mat4 P{Mat4::Identity()};
+    bool has_meas{false};      // 이 시점에 적용된 측정 (replay 용)
+    SensorType sensor{SensorType::Camera};
+    MeasVec z;
+};
+
+// 고정 용량 ring buffer. timestamp 오름차순을 유지하며, 가득 차면 가장 오래된 항목을 버린다.
+// 용량은 생성 시 한 번만 할당한다.
+class TrackHistory {
+public:
+    explicit TrackHistory(std::size_t capacity = 0) : buf_(capacity) {}
+
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return buf_.size(); }
+    bool empty() const { return count_ == 0; }
+
+    // k = 0 이 가장 오래된 항목
+    HistoryEntry& at(std::size_t k) { return buf_[(head_ + k) % buf_.size()]; }
+    const HistoryEntry& at(std::size_t k) const { return buf_[(head_ + k) % buf_.size()]; }
+
+    const HistoryEntry& back() const { return at(count_ - 1); }
+
+    // 용량은 그대로 두고 비움 (삭제된 track 의 history 를 재사용할 때)
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    // timestamp 순서에 맞는 위치에 삽입 (보통은 맨 뒤)
+    void insert(const HistoryEntry& e) {
+        if (buf_.empty()) return;
+        if (count_ == buf_.size()) {
+            head_ = (head_ + 1) % buf_.size();
+            --count_;
+        }
+        std::size_t k = count_++;
+        at(k) = e;
+        while (k > 0 && at(k - 1).timestamp > at(k).timestamp) {
+            std::swap(at(k - 1), at(k));
+            --k;
+        }
+    }
+
+    // timestamp 이하인 마지막 항목 index (없으면 -1)
+    int find_at_or_before(double timestamp) const {
+        for (int k = static_cast<int>(count_) - 1; k >= 0; --k) {
+            if (at(k).timestamp <= timestamp) return k;
+        }
+        return -1;
+    }
+
+private:
+    std::vector<HistoryEntry> buf_;
+    std::size_t head_{0};
+    std::size_t count_{0};
+};
+
+} // namespace msf
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "aligned_allocator.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// Structure-of-arrays track 상태 저장소
+// 상태 [x, y, vx, vy] 4개와 대칭 공분산의 고유 원소 10개를 각각 연속된 배열로 보관한다.
+// (bookkeeping - id, age, missed 등은 tracker 의 TrackState 쪽에 남김)
+class TrackStoreSoA {
+public:
+    // 공분산 상삼각 원소 순서
+    enum Cov { P00, P01, P02, P03, P11, P12, P13, P22, P23, P33, kNumCov };
+
+    std::size_t size() const { return x_.size(); }
+    void clear();
+    void reserve(std::size_t n);
+
+    void push_back(const Vec4& x, const Mat4& P, double last_timestamp);
+
+    // i 번째 track 의 상태를 Vec4 / Mat4 로 gather / scatter
+    void load(std::size_t i, Vec4& x, Mat4& P) const;
+    void store(std::size_t i, const Vec4& x, const Mat4& P);
+
+    // keep[i] == 0 인 항목 제거 (순서 유지)
+    void compact(const std::vector<char>& keep);
+
+    // 모든 track 을 timestamp 까지 constant velocity 모델로 예측
+    // dt 가 같은 연속 구간마다 Q 를 한 번만 계산하고 batched kernel 로 처리한다
+    void predict(double timestamp, double sigma_a);
+    void predict(double timestamp, double sigma_a, std::size_t begin, std::size_t end);
+
+    double last_timestamp(std::size_t i) const { return last_ts_[i]; }
+
+    // 현재 CPU 에서 선택된 predict kernel 이름 ("avx512", "avx2", "scalar")
+    static const char* simd_backend();
+
+private:
+    AlignedDoubles x_, y_, vx_, vy_;
+    AlignedDoubles p_[kNumCov];
+    AlignedDoubles last_ts_;
+};
+
+} // namespace msf
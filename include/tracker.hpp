@@ -1,7 +1,23 @@
 #pragma once
 
+#include <limits>
+#include <memory>
 #include <vector>
 #include "types.hpp"
+#include "data_association.hpp"
+#include "detection_batch.hpp"
+#include "frame_arena.hpp"
+#include "gating.hpp"
+#include "imm.hpp"
+#include "jpda.hpp"
+#include "measurement_cache.hpp"
+#include "mht.hpp"
+#include "radar_batch.hpp"
+#include "track_history.hpp"
+#include "tracker_stats.hpp"
+#include "track_store.hpp"
+#include "thread_pool.hpp"
+#include "ukf.hpp"
 
 namespace msf {
 
@@ -10,19 +26,223 @@ public:
     explicit MultiSensorTracker(const TrackerParams& params = TrackerParams{});
 
     // prediction은 timestamp 기준 (초 단위)
+    // oosm_history_size > 0 이면 이미 지난 timestamp 의 predict 는 무시된다
     void predict(double timestamp);
 
     // 현재 프레임의 모든 센서 측정 업데이트
+    // oosm_history_size > 0 이면 마지막 predict 시각보다 오래된 detection 은
+    // track history 에서 rewind-and-replay 로 반영한다
     void update(const std::vector<Detection>& detections);
+    void update(const DetectionBatch& detections);
 
+    // 센서가 이미 추적한 object list 를 system track 에 융합 (track-to-track fusion)
+    // sensor_id 오름차순으로 센서마다 association (상태 Mahalanobis 게이트 track_fusion_gate) 후
+    // 매칭된 track 은 track_fusion_method 로 융합, 매칭되지 않은 object 는 새 track.
+    // object 시각이 마지막 predict 보다 이르면 CV 로 그 시각까지 예측해서 쓴다.
+    // (OOSM history 에는 남지 않으므로 이후 늦은 detection 의 replay 는 이 융합을 다시 적용하지 않음)
+    // AssociationMethod::MHT 이면 센서 그룹 하나가 scan 하나: 게이트 안 leaf-object 쌍은 융합한 상태가
+    // 분기, object 는 새 tree 후보로 MhtEngine 에 넘기고 (likelihood 의 clutter 밀도는
+    // track_fusion_clutter_density), track 삭제 / 확정도 detection 입력과 같이 MhtEngine 이 한다.
+    void update_tracks(const std::vector<SensorTrack>& objects);
+
+    // TrackStorage::SoA 모드에서도 x, P 는 predict/update 마다 AoS view 로 갱신됨
     const std::vector<TrackState>& get_tracks() const { return tracks_; }
 
+    // stage 별 시간 / counter (MSFT_ENABLE_STATS=0 으로 빌드하면 모두 0)
+    const TrackerStats& stats() const { return stats_; }
+    TrackerStats& stats() { return stats_; }
+
+    // MotionModel::IMM 의 track 별 모델 상태 / 확률 (get_tracks() 와 같은 순서)
+    const ImmFilterBank& imm() const { return imm_; }
+
+    // 프레임 scratch arena (용량 / 최대 사용량 / heap fallback 횟수 확인용)
+    const FrameArena& frame_arena() const { return arena_; }
+
 private:
     TrackerParams params_;
     std::vector<TrackState> tracks_;
     int next_id_{0};
 
-    void create_track_from_detection(const Detection& det);
+    // TrackStorage::SoA 모드의 상태 저장소 (tracks_ 와 같은 순서)
+    TrackStoreSoA soa_;
+
+    // MotionModel::IMM 모드의 모델별 상태 (tracks_ 와 같은 순서, tracks_[i].x / P 는 결합 추정)
+    ImmFilterBank imm_;
+    std::vector<char> keep_;
+
+    // gating 용 프레임 간 재사용 버퍼
+    SpatialGrid cam_grid_;
+    SpatialGrid radar_grid_;
+    std::vector<Eigen::Vector2d> cam_pos_;
+    std::vector<Eigen::Vector2d> radar_pos_;
+    std::vector<int> cam_idx_;    // cam_grid_ point index → detection index
+    std::vector<int> radar_idx_;  // radar_grid_ point index → detection index
+    std::vector<GateCandidate> candidates_;
+
+    // track 별 예측 측정 캐시 (gating 직전에 채우고 같은 프레임의 update 가 재사용)
+    std::vector<MeasurementCache> meas_cache_;
+
+    // radar 예측 측정 / Jacobian batch kernel 입출력 (track 상태를 SoA 로 모은 것)
+    AlignedDoubles radar_px_, radar_py_, radar_vx_, radar_vy_;
+    RadarPredictionSoA radar_pred_;
+
+    // RadarFilter::UKF: track 마다 sigma point 9 개를 이어 붙인 SoA (track i → [9i, 9i + 9))
+    UkfWeights ukf_w_;
+    AlignedDoubles sigma_px_, sigma_py_, sigma_vx_, sigma_vy_;
+    AlignedDoubles sigma_rho_, sigma_phi_, sigma_rho_dot_;
+
+    // cost 계산 / EKF update / predict 병렬화용 (num_threads == 1 이면 추가 스레드 없음)
+    std::unique_ptr<ThreadPool> pool_;
+
+    // worker 별 gating scratch
+    struct GateScratch {
+        std::vector<int> query;
+        std::vector<GateCandidate> candidates;
+        std::size_t evaluated{0};
+    };
+    std::vector<GateScratch> gate_scratch_;
+
+    TrackerStats stats_;
+
+    // update() 한 번 안에서만 쓰는 버퍼 (association scratch / 결과, dense cost 행렬)
+    // update() 시작 시 reset
+    FrameArena arena_;
+
+    // update(std::vector<Detection>) 용 재사용 batch
+    DetectionBatch batch_;
+
+    // OOSM: tracks_ 와 같은 순서의 track 별 history, 지금까지 predict 한 최신 시각
+    std::vector<TrackHistory> history_;
+    std::vector<TrackHistory> history_pool_;   // 삭제된 track 의 history (새 track 이 재사용)
+    double latest_time_{-std::numeric_limits<double>::infinity()};
+    DetectionBatch in_seq_;
+    DetectionBatch late_;
+    DetectionBatch late_group_;
+    std::vector<int> late_order_;
+    std::vector<TrackState> retro_;   // 늦은 detection 시각으로 retrodict 한 상태
+    std::vector<char> retro_valid_;
+
+    // FusionMode::Sequential 용 센서별 batch
+    DetectionBatch seq_camera_;
+    DetectionBatch seq_radar_;
+
+    // 정상 순서 detection 처리: Joint 면 update_frame 한 번, Sequential 이면 센서별로 한 번씩
+    void update_in_sequence(const DetectionBatch& detections);
+
+    // 정상 순서 detection 에 대한 association + update + track 생성
+    // count_missed 가 false 면 매칭되지 않은 track 의 missed 를 올리지 않는다 (호출측이 프레임당 한 번)
+    void update_frame(const DetectionBatch& detections, bool count_missed = true);
+    AssociationResult associate(int n_tracks, int n_dets, double max_cost);
+
+    // DetectionUpdate::Information: 짝이 없는 detection 을 게이트 안 최소 비용 track 에 붙이고
+    // (unassigned_detections 에서 제거) track 별 detection 목록을 CSR 로 만든다
+    void absorb_detections(AssociationResult& assoc, int n_tracks, int n_dets,
+                           std::pmr::vector<int>& offsets, std::pmr::vector<int>& members);
+
+    // AssociationMethod::JPDA: candidates_ 의 likelihood 로 cluster 별 association 확률 계산.
+    // track 별 후보 목록 (candidates_ index) 을 CSR 로 만들고, 결과의 track_assignment 는
+    // 확률이 가장 큰 detection (미검출이 더 크면 -1, OOSM history 용), unassigned_tracks 는 후보가 없는 track,
+    // unassigned_detections 는 어느 게이트에도 없는 detection
+    AssociationResult associate_jpda(const DetectionBatch& dets, int n_tracks, int n_dets,
+                                     std::pmr::vector<int>& offsets,
+                                     std::pmr::vector<int>& members);
+    JpdaSolver jpda_;
+
+    // JPDA / MHT: candidates_ 순서의 쌍 likelihood P_D N(y; 0, S) / clutter 밀도 (meas_cache_ 기준)
+    void compute_pair_likelihood(const DetectionBatch& dets);
+    std::vector<double> pair_likelihood_;
+
+    // AssociationMethod::MHT: mht_->leaves() 를 gating 해서 후보 쌍 likelihood / posterior 와
+    // detection 별 새 track 상태를 넘기고, 최적 hypothesis 의 track 을 tracks_ 로 가져온다
+    // (센서 pass 하나가 scan 하나, track 삭제 / 확정도 MhtEngine 이 한다)
+    void update_frame_mht(const DetectionBatch& detections);
+    // candidates_ / pair_likelihood_ / mht_post_ / mht_birth_ 로 scan 하나 진행 후 tracks_ 갱신
+    void run_mht_scan();
+    std::unique_ptr<MhtEngine> mht_;   // MHT 모드에서만 생성 (node pool 이 크다)
+    std::vector<TrackState> mht_post_;
+    std::vector<TrackState> mht_birth_;
+
+    // unassigned detection 으로 새 track 생성 (Information 모드는 게이트 안의 detection 을 하나로 묶음)
+    void birth_tracks(const DetectionBatch& dets, const std::pmr::vector<int>& unassigned);
+
+    // update_tracks(): 센서 하나의 object 들을 gating / association / 융합
+    void fuse_sensor_group(const std::vector<SensorTrack>& group);
+    // tracks (tracks_ 또는 MHT leaf) 와 object 의 게이트 안 쌍을 candidates_ 에 (cost = 상태 거리 제곱)
+    void gate_sensor_objects(const std::vector<TrackState>& tracks,
+                             const std::vector<SensorTrack>& group);
+    // MHT 모드: object 그룹을 scan 하나로 MhtEngine 에 넘김 (쌍 likelihood / 융합 posterior / birth)
+    void fuse_sensor_group_mht(const std::vector<SensorTrack>& group);
+    std::vector<int> fusion_order_;
+    std::vector<SensorTrack> fusion_group_;
+    std::vector<Eigen::Vector2d> fusion_pos_;
+    SpatialGrid fusion_grid_;
+    double predict_time_{-std::numeric_limits<double>::infinity()};
+
+    // OOSM 처리
+    void record_history(const DetectionBatch& detections,
+                        const std::pmr::vector<int>* assignment);
+    void update_late(const DetectionBatch& late);
+    void replay_with_late_measurement(int i, const DetectionBatch& dets, int j,
+                                      const Eigen::Matrix2d& R_cam,
+                                      const Eigen::Matrix3d& R_rad);
+
+    // missed 가 max_missed 를 넘은 track 제거 (soa_, history_ 도 함께 정리)
+    void prune_tracks();
+
+    void create_track_from_detection(const DetectionBatch& dets, int j);
+    void initial_state(const DetectionBatch& dets, int j, Vec4& x, Mat4& P) const;
+    void create_track(const Vec4& x, const Mat4& P, double timestamp);
+
+    // AoS 모드 track 하나 constant velocity 예측
+    void predict_track(TrackState& track, double timestamp) const;
+    void predict_state(Vec4& x, Mat4& P, double dt) const;
+
+    // 센서 종류에 맞는 EKF 측정 업데이트
+    void apply_measurement(Vec4& x, Mat4& P, SensorType sensor, const MeasVec& z,
+                           const Eigen::Matrix2d& R_cam,
+                           const Eigen::Matrix3d& R_rad) const;
+
+    // track i 에 detection det_idx 로 EKF 업데이트 + bookkeeping
+    void update_track(int i, const DetectionBatch& detections, int det_idx,
+                      const Eigen::Matrix2d& R_cam,
+                      const Eigen::Matrix3d& R_rad);
+
+    // track i 에 detection 목록 dets[0, n) 을 정보 형태로 합산해 한 번에 update + bookkeeping
+    // (IMM 은 primary 를 제외한 나머지만, primary 는 ImmFilterBank::update 가 반영)
+    void update_track_information(int i, const DetectionBatch& detections,
+                                  const int* dets, int n, int primary,
+                                  const Eigen::Matrix2d& R_cam,
+                                  const Eigen::Matrix3d& R_rad);
+
+    // JPDA: track i 의 후보 cands[0, n) (candidates_ index) 마다 posterior 를 구해
+    // association 확률 (미검출은 예측 그대로) 로 moment matching + bookkeeping
+    // (hit: 미검출보다 그럴듯한 detection 이 있음, 이때만 missed 초기화 / confirm)
+    void update_track_jpda(int i, const DetectionBatch& detections, const int* cands, int n,
+                           bool hit, const Eigen::Matrix2d& R_cam,
+                           const Eigen::Matrix3d& R_rad);
+
+    // meas_cache_ 의 분해를 써서 (x, P) 에 detection j 로 EKF / UKF update
+    void apply_cached_update(const MeasurementCache& cache, const DetectionBatch& detections,
+                             int j, const Eigen::Matrix2d& R_cam, const Eigen::Matrix3d& R_rad,
+                             Vec4& x, Mat4& P) const;
+
+    // detection 에 등장하는 센서에 대해서만 tracks 의 예측 측정 / S 분해 계산
+    void build_measurement_cache(const std::vector<TrackState>& tracks,
+                                 const DetectionBatch& detections,
+                                 const Eigen::Matrix2d& R_cam,
+                                 const Eigen::Matrix3d& R_rad);
+
+    // RadarFilter::UKF 의 radar cache: [begin, end) track 의 sigma point 를 SoA 로 모아
+    // radar_measurement_batch 한 번으로 변환한 뒤 moment 계산
+    void build_radar_unscented(const std::vector<TrackState>& tracks,
+                               std::size_t begin, std::size_t end,
+                               const Eigen::Matrix3d& R_rad);
+
+    // 격자 질의 + Mahalanobis 게이트로 candidates_ 채움 (meas_cache_ 가 tracks 기준이어야 함)
+    void gate_candidates(const std::vector<TrackState>& tracks,
+                         const DetectionBatch& detections,
+                         const Eigen::Matrix2d& R_cam,
+                         const Eigen::Matrix3d& R_rad);
 };
 
 } // namespace msf
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// MSFT_ENABLE_STATS=0 이면 아래 MSFT_STATS_* 매크로가 모두 비어서
+// tracker 안의 계측 코드가 통째로 컴파일에서 빠진다 (TrackerStats API 는 그대로 남고 값만 0)
+#ifndef MSFT_ENABLE_STATS
+#define MSFT_ENABLE_STATS 1
+#endif
+
+namespace msf {
+
+// update() / predict() 안의 계측 구간
+enum class TrackerStage : int {
+    Predict,
+    Gating,       // 격자 / dense cost 계산
+    Association,
+    Update,       // 매칭된 track EKF update
+    Birth,
+    Late,         // OOSM 늦은 detection 처리
+    Prune,
+    TrackFusion,  // update_tracks() 의 센서 object list 융합
+    Frame,        // update() 전체
+    kCount
+};
+
+const char* stage_name(TrackerStage stage);
+
+struct TrackerCounters {
+    std::uint64_t frames{0};
+    std::uint64_t detections{0};
+    std::uint64_t pairs_evaluated{0};   // Mahalanobis 거리를 계산한 track-detection 쌍
+    std::uint64_t pairs_gated{0};       // 그 중 게이트를 통과한 쌍
+    std::uint64_t ekf_updates{0};
+    std::uint64_t factorizations{0};    // 혁신 공분산 S 의 LDLT 분해 (= 역행렬 계산) 횟수
+    std::uint64_t tracks_born{0};
+    std::uint64_t tracks_deleted{0};
+    std::uint64_t late_detections{0};
+    std::uint64_t tracks_fused{0};      // system track 에 융합된 센서 object
+    std::uint64_t dets_absorbed{0};     // DetectionUpdate::Information 에서 추가로 합산된 detection
+    std::uint64_t jpda_clusters{0};     // JPDA cluster 수
+    std::uint64_t jpda_events{0};       // 열거 / k-best 로 가중치를 더한 joint event 수
+    std::uint64_t jpda_truncated{0};    // 모두 열거하지 못한 cluster (k-best 또는 cheap JPDA)
+    std::uint64_t mht_clusters{0};      // MHT 전역 hypothesis 탐색 cluster 수
+    std::uint64_t mht_hypotheses{0};    // update 후 살아 있는 MHT leaf (track hypothesis) 수
+    std::uint64_t mht_truncated{0};     // 탐색 node 상한 / 시간 예산으로 끝까지 못 본 cluster
+
+    void add(const TrackerCounters& o);
+};
+
+// 구간 별 시간 분포. log2 scale 히스토그램 (octave 당 4 bucket, 상대 오차 < 25%)
+struct StageTiming {
+    static constexpr int kBuckets = 160;
+
+    std::uint64_t count{0};
+    std::uint64_t total_ns{0};
+    std::uint64_t max_ns{0};
+    std::uint64_t last_ns{0};
+    std::array<std::uint64_t, kBuckets> histogram{};
+
+    void record(std::uint64_t ns);
+
+    double mean_us() const { return count ? total_ns * 1e-3 / count : 0.0; }
+
+    // 히스토그램 기반 근사 분위수 (bucket 상한) [us]
+    double percentile_us(double q) const;
+};
+
+class TrackerStats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    const StageTiming& stage(TrackerStage s) const { return stages_[static_cast<int>(s)]; }
+    const TrackerCounters& totals() const { return totals_; }
+    const TrackerCounters& last_frame() const { return frame_; }
+
+    void reset();
+
+    // trace 기록 시작 (max_events 를 넘으면 이후 event 는 버림)
+    void enable_trace(std::size_t max_events = 1 << 20);
+    void disable_trace() { trace_enabled_ = false; }
+
+    // Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev 에서 열 수 있음)
+    bool write_trace(const std::string& path) const;
+
+    // 사람이 읽는 요약 표
+    std::string summary() const;
+
+    // --- tracker 내부용 ---
+    void begin_frame();
+    void end_frame(std::size_t n_tracks);
+    void record(TrackerStage s, Clock::time_point begin, Clock::time_point end);
+    TrackerCounters& frame_counters() { return frame_; }
+
+private:
+    struct TraceEvent {
+        std::int64_t ts_ns;
+        std::int64_t dur_ns;
+        int stage;          // -1 이면 counter event (scene density)
+        std::uint32_t tracks;
+        std::uint32_t detections;
+    };
+
+    std::array<StageTiming, static_cast<int>(TrackerStage::kCount)> stages_{};
+    TrackerCounters totals_;
+    TrackerCounters frame_;
+
+    bool trace_enabled_{false};
+    std::size_t trace_max_events_{0};
+    std::vector<TraceEvent> trace_;
+    Clock::time_point epoch_{Clock::now()};
+};
+
+// 생성 ~ 소멸 구간을 stage 시간으로 기록
+class ScopedStageTimer {
+public:
+    ScopedStageTimer(TrackerStats& stats, TrackerStage stage)
+        : stats_(stats), stage_(stage), begin_(TrackerStats::Clock::now()) {}
+    ~ScopedStageTimer() { stats_.record(stage_, begin_, TrackerStats::Clock::now()); }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    TrackerStats& stats_;
+    TrackerStage stage_;
+    TrackerStats::Clock::time_point begin_;
+};
+
+} // namespace msf
+
+#define MSFT_STATS_CONCAT_(a, b) a##b
+#define MSFT_STATS_CONCAT(a, b) MSFT_STATS_CONCAT_(a, b)
+
+#if MSFT_ENABLE_STATS
+#define MSFT_STATS_SCOPE(stats, stage) \
+    ::msf::ScopedStageTimer MSFT_STATS_CONCAT(msft_stage_timer_, __LINE__)((stats), (stage))
+#define MSFT_STATS_COUNT(stats, field, n) ((stats).frame_counters().field += (n))
+#define MSFT_STATS_BEGIN_FRAME(stats) ((stats).begin_frame())
+#define MSFT_STATS_END_FRAME(stats, n_tracks) ((stats).end_frame(n_tracks))
+#else
+#define MSFT_STATS_SCOPE(stats, stage) ((void)0)
+#define MSFT_STATS_COUNT(stats, field, n) ((void)0)
+#define MSFT_STATS_BEGIN_FRAME(stats) ((void)0)
+#define MSFT_STATS_END_FRAME(stats, n_tracks) ((void)0)
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <Eigen/Dense>
 
 namespace msf {
@@ -9,12 +10,53 @@ enum class SensorType {
     Radar
 };
 
+// Data association 방식
+enum class AssociationMethod {
+    Greedy,   // 비용 오름차순 greedy nearest-neighbor
+    Optimal,  // cluster 별 최적 할당 (Jonker-Volgenant)
+    JPDA,     // cluster 별 joint event 확률로 게이트 안 detection 들의 가중 평균 update
+    MHT       // track-oriented MHT: N scan 동안 association 분기를 유지하고 최적 전역 hypothesis 를 출력
+};
+
+// 한 프레임에 여러 센서 detection 이 들어올 때 update 방식
+enum class FusionMode {
+    Joint,       // 모든 센서 detection 을 한 association 문제로 (track 당 detection 하나)
+    Sequential   // 센서별로 camera → radar 순서로 association + update (track 당 센서마다 하나)
+};
+
+// track 하나가 한 프레임 (센서 pass) 에 반영하는 detection 수
+enum class DetectionUpdate {
+    Single,       // association 결과 하나 (나머지는 새 track)
+    Information   // 게이트를 통과한 모든 detection 을 정보 형태로 합산 (extended object)
+};
+
+// Track 상태 저장 방식
+enum class TrackStorage {
+    AoS,  // std::vector<TrackState> 에서 track 별로 predict
+    SoA   // TrackStoreSoA 에서 batched (SIMD) predict
+};
+
+// Track 운동 모델
+enum class MotionModel {
+    CV,   // constant velocity 하나 (process_noise_std)
+    IMM   // CV / constant acceleration / coordinated turn 을 섞는 Interacting Multiple Model
+};
+
+// Radar (비선형 측정) 업데이트 방식
+enum class RadarFilter {
+    EKF,  // 예측 상태에서 Jacobian 으로 선형화
+    UKF   // sigma point 2n+1 개로 h(x) 의 평균 / 공분산을 근사
+};
+
 using Vec4 = Eigen::Matrix<double, 4, 1>;
 using Mat4 = Eigen::Matrix<double, 4, 4>;
 
+// 측정 벡터: 최대 3 원소 inline 저장 (heap 할당 없음)
+using MeasVec = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1>;
+
 struct Detection {
     SensorType sensor{SensorType::Camera};
-    Eigen::VectorXd z;     // Camera: size 2, Radar: size 3
+    MeasVec z;             // Camera: size 2, Radar: size 3
     double timestamp{0.0};
     double confidence{1.0};
 };
@@ -29,10 +71,33 @@ struct TrackState {
     double last_timestamp{0.0};
 };
 
+// 센서가 자체적으로 추적해서 내보내는 object (track-to-track fusion 입력)
+struct SensorTrack {
+    int sensor_id{0};      // 입력 센서 (센서마다 따로 association)
+    int local_id{-1};      // 센서 내부 track id (tracker 는 쓰지 않음)
+    Vec4 x{Vec4::Zero()};  // [x, y, vx, vy]
+    Mat4 P{Mat4::Identity()};
+    double timestamp{0.0};
+};
+
+// track-to-track fusion 방식
+enum class TrackFusionMethod {
+    CovarianceIntersection,  // 상관을 모르는 두 추정을 보수적으로 합침
+    Information              // 독립이라고 보고 정보 행렬을 더함
+};
+
 struct TrackerParams {
     // Process noise std (가속도 노이즈 등) - 대략적인 값
     double process_noise_std{1.0};
 
+    MotionModel motion_model{MotionModel::CV};
+    // IMM: 매 predict 에서 다른 모델로 바뀔 확률 (나머지 두 모델에 반씩)
+    double imm_switch_prob{0.05};
+    // IMM CA 모델의 jerk 노이즈 std [m/s^3], CT 모델의 회전율 random walk std [rad/s/sqrt(s)]
+    // (CV, CT 모델의 가속도 노이즈는 process_noise_std)
+    double imm_accel_noise_std{3.0};
+    double imm_turn_rate_noise_std{0.3};
+
     // Camera 측정 노이즈 (x,y)
     double cam_pos_noise_std{1.0};
 
@@ -41,9 +106,87 @@ struct TrackerParams {
     double radar_angle_noise_std{0.05};
     double radar_vr_noise_std{0.5};
 
+    RadarFilter radar_filter{RadarFilter::EKF};
+    // UKF sigma point scaling (Merwe): alpha = 1, kappa = 0 이면 중심 가중치 0, 나머지 1/8
+    double ukf_alpha{1.0};
+    double ukf_beta{2.0};
+    double ukf_kappa{0.0};
+
     // Mahalanobis 거리 게이트 (제곱값 기준으로 사용)
     double max_association_maha_dist{9.21}; // chi-square ~ 95% (2~3차원에 맞춰 대략)
 
+    // Spatial grid 기반 coarse gating 사용 여부
+    // (false 면 모든 track-detection 쌍에 대해 dense 비용 행렬을 계산)
+    bool use_spatial_gating{true};
+    double gating_cell_size{10.0};  // gating 격자 셀 크기 [m]
+
+    AssociationMethod association_method{AssociationMethod::Greedy};
+
+    // JPDA / MHT 의 track-detection 쌍 likelihood = P_D N(y; 0, S) / (clutter 밀도)
+    // 밀도는 각 센서 측정 공간의 단위 부피당 clutter 수
+    double detection_prob{0.9};
+    double camera_clutter_density{1e-4};   // [1 / m^2]
+    double radar_clutter_density{1e-6};    // [1 / (m rad m/s)]
+
+    // AssociationMethod::JPDA: 어느 track 게이트에도 없는 detection 만 새 track.
+    // cluster 의 joint event 수가 jpda_max_events 이하면 모두 열거, 넘으면 track 수가
+    // jpda_k_best_max_tracks 이하일 때 Murty k-best 로 상위 jpda_max_events 개, 그보다 크면 cheap JPDA.
+    // (늦은 detection / update_tracks() 의 association 은 Optimal 로, detection_update 는 무시)
+    int jpda_max_events{100};
+    int jpda_k_best_max_tracks{12};
+
+    // AssociationMethod::MHT (MhtEngine): leaf 는 score (log likelihood ratio) 로 관리.
+    // 새 tree 는 mht_birth_score 에서 시작, mht_delete_score 미만 / max_missed 초과 leaf 는 버린다.
+    // N-scan-back 깊이, cluster 별 유지할 전역 hypothesis 수, tree 별 leaf 상한, node pool 크기,
+    // cluster 당 탐색 node 상한이 hypothesis 수 / 메모리 / 시간을 bound 한다.
+    // mht_time_budget_ms > 0 이면 그 시간을 넘긴 뒤의 cluster 는 greedy 한 번으로 끝낸다.
+    // scan 마다 target 당 detection 하나를 가정하므로 fusion_mode 와 무관하게 센서 pass (camera → radar)
+    // 하나가 scan 하나이고, N 과 max_missed 도 pass 단위로 센다.
+    // update_tracks() 도 센서 그룹 하나가 scan 하나 (track_fusion_gate / track_fusion_clutter_density 사용)
+    // (CV 모델 AoS 경로만, OOSM / detection_update / dense gating 은 반영 안 함)
+    int mht_n_scan{3};
+    int mht_k_best{8};
+    double mht_hypothesis_gap{5.0};   // 최적 전역 hypothesis 보다 점수가 이만큼 넘게 낮은 hypothesis 는 버림
+    int mht_max_leaves_per_track{16};
+    int mht_max_nodes{1 << 15};
+    int mht_max_search_nodes{5000};
+    double mht_time_budget_ms{0.0};
+    double mht_birth_score{-1.0};
+    double mht_delete_score{-5.0};
+
+    FusionMode fusion_mode{FusionMode::Joint};
+
+    // DetectionUpdate::Information: association 으로 짝을 못 찾은 detection 중 게이트 안의
+    // track 이 있으면 비용이 가장 작은 track 에 흡수해서 H^T R^-1 H, H^T R^-1 y 를 더하고
+    // track 당 4x4 분해 한 번으로 update. 새 track 도 게이트 안의 detection 끼리 묶어 하나로 만든다.
+    // (OOSM history 에는 association 결과 하나만 남는다)
+    DetectionUpdate detection_update{DetectionUpdate::Single};
+
+    // update_tracks() (센서 object list 입력) 의 융합 방식과 게이트
+    // 게이트는 4 차원 상태 차이의 Mahalanobis 거리 제곱 (chi-square 4 자유도 99% ~ 13.28)
+    TrackFusionMethod track_fusion_method{TrackFusionMethod::CovarianceIntersection};
+    double track_fusion_gate{13.28};
+    // AssociationMethod::MHT 의 object 쌍 likelihood 에 쓰는 상태 공간 clutter 밀도 [1 / (m^2 (m/s)^2)]
+    double track_fusion_clutter_density{1e-6};
+
+    TrackStorage track_storage{TrackStorage::AoS};
+
+    // gating cost 계산 / EKF update / predict 에 쓸 스레드 수 (호출 스레드 포함)
+    // 결과는 스레드 수와 무관하게 단일 스레드와 bit 단위로 동일
+    int num_threads{1};
+
+    // out-of-sequence measurement 처리용 track 별 history 길이 (0 이면 비활성)
+    // 활성 시 마지막 predict 시각보다 오래된 detection 을 rewind-and-replay 로 반영
+    // (FusionMode::Sequential 은 센서 pass 마다 항목을 하나씩 남기므로 프레임당 최대 2 개)
+    int oosm_history_size{0};
+
+    // track 저장소 (tracks_, SoA, history, gating cache) 를 미리 확보할 track 수
+    // 실제 track 수가 이 안에 있으면 track 생성 / 삭제에 heap 할당이 없다 (0 이면 필요할 때 증가)
+    int track_capacity{0};
+
+    // 프레임 단위 scratch arena 초기 크기 [byte] (모자라면 다음 프레임부터 자동으로 커짐)
+    std::size_t frame_arena_bytes{256 * 1024};
+
     int max_missed{5};
     int min_hits_to_confirm{3};
 };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include "measurement_cache.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// [x, y, vx, vy] 상태의 unscented transform (radar 측정 업데이트 용)
+// sigma point: X_0 = x,  X_k = x + gamma L_k,  X_{k+n} = x - gamma L_k  (P = L L^T, k = 1..n)
+constexpr int kUkfStateDim = 4;
+constexpr int kUkfSigmaPoints = 2 * kUkfStateDim + 1;
+
+// Merwe scaled unscented transform 가중치
+//   lambda = alpha^2 (n + kappa) - n,  gamma = sqrt(n + lambda)
+//   wm0 = lambda / (n + lambda),  wc0 = wm0 + 1 - alpha^2 + beta,  wi = 1 / (2 (n + lambda))
+struct UkfWeights {
+    double gamma{2.0};
+    double wm0{0.0};
+    double wc0{2.0};
+    double wi{0.125};
+
+    static UkfWeights make(double alpha, double beta, double kappa);
+};
+
+// sigma point 9 개를 SoA 배열 px[0..8], py[..], vx[..], vy[..] 에 기록
+// P 의 Cholesky 분해가 실패하면 9 개 모두 x 로 채우고 false
+bool generate_sigma_points(const Vec4& x, const Mat4& P, const UkfWeights& w,
+                           double* px, double* py, double* vx, double* vy);
+
+// sigma point (px.. vy) 와 그 radar 측정 (rho, phi, rho_dot) 으로 예측 측정 out 을 채운다
+//   z_pred = sum wm Z_k  (각도는 Z_0 기준 차이의 가중 평균)
+//   S      = sum wc (Z_k - z_pred)(Z_k - z_pred)^T + R   → S_ldlt
+//   PHt    = sum wc (X_k - x)(Z_k - z_pred)^T           (교차 공분산 Pxz, H 는 쓰지 않음)
+void radar_unscented_moments(const double* px, const double* py,
+                             const double* vx, const double* vy,
+                             const double* rho, const double* phi, const double* rho_dot,
+                             const UkfWeights& w, const Eigen::Matrix3d& R,
+                             PredictedMeasurement<3>& out);
+
+// track 하나에 대한 sigma point 생성 + radar batch kernel + moment (stack 배열만 사용)
+// sigma point 생성이 실패하면 out.valid = false
+void radar_unscented_predict(const Vec4& x, const Mat4& P, const UkfWeights& w,
+                             const Eigen::Matrix3d& R, PredictedMeasurement<3>& out);
+
+} // namespace msf
@@ -0,0 +1,138 @@
+#include "monte_carlo.hpp"
+#include "parallel_sensor_simulator.hpp"
+#include "tracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory_resource>
+
+namespace msf {
+
+MonteCarloRunner::MonteCarloRunner(int num_threads)
+    : pool_(std::make_unique<ThreadPool>(num_threads)) {
+    for (int w = 0; w < pool_->size(); ++w) {
+        scratch_.push_back(std::make_unique<WorkerScratch>());
+    }
+}
+
+std::vector<ConfigSummary> MonteCarloRunner::run(const MonteCarloScenario& scenario,
+                                                 const std::vector<TrackerParams>& configs,
+                                                 int num_seeds, std::uint32_t base_seed) {
+    const int n_configs = static_cast<int>(configs.size());
+    const int n_runs = n_configs * std::max(0, num_seeds);
+    runs_.assign(n_runs, RunMetrics{});
+
+    // worker 마다 하나의 구간을 받아 공유 counter 로 run 을 가져간다 (동적 분배)
+    std::atomic<int> next{0};
+    pool_->parallel_for(pool_->size(), [&](std::size_t, std::size_t, int worker) {
+        for (int k = next.fetch_add(1); k < n_runs; k = next.fetch_add(1)) {
+            const int c = k / num_seeds;
+            const std::uint32_t seed = base_seed + static_cast<std::uint32_t>(k % num_seeds);
+            runs_[k] = run_one(scenario, configs[c], seed, *scratch_[worker]);
+            runs_[k].config = c;
+            runs_[k].seed = seed;
+        }
+    });
+
+    std::vector<ConfigSummary> summary(n_configs);
+    for (int c = 0; c < n_configs; ++c) {
+        ConfigSummary& s = summary[c];
+        s.config = c;
+        s.runs = num_seeds;
+        if (num_seeds <= 0) continue;
+
+        // 지표 필드를 같은 방식으로 다루기 위한 member pointer 목록
+        static constexpr double RunMetrics::*kFields[] = {
+            &RunMetrics::pos_err, &RunMetrics::miss_rate, &RunMetrics::false_tracks,
+            &RunMetrics::gospa, &RunMetrics::id_switches, &RunMetrics::confirm_latency,
+            &RunMetrics::births, &RunMetrics::frame_ms, &RunMetrics::frame_p99_ms,
+        };
+        s.mean.config = s.stddev.config = c;
+        for (auto field : kFields) {
+            double sum = 0.0, sum_sq = 0.0;
+            for (int r = 0; r < num_seeds; ++r) {
+                const double v = runs_[c * num_seeds + r].*field;
+                sum += v;
+                sum_sq += v * v;
+            }
+            const double mean = sum / num_seeds;
+            s.mean.*field = mean;
+            s.stddev.*field = num_seeds > 1
+                ? std::sqrt(std::max(0.0, (sum_sq - num_seeds * mean * mean) / (num_seeds - 1)))
+                : 0.0;
+        }
+    }
+    return summary;
+}
+
+RunMetrics MonteCarloRunner::run_one(const MonteCarloScenario& scenario,
+                                     const TrackerParams& params, std::uint32_t seed,
+                                     WorkerScratch& scratch) const {
+    using Clock = std::chrono::steady_clock;
+
+    TrafficParams traffic = scenario.traffic;
+    traffic.seed = seed;
+    traffic.num_threads = 1;
+    TrafficScenario world(traffic);
+
+    ParallelSensorSimulator sensor(scenario.cam_std, scenario.radar_r_std,
+                                   scenario.radar_angle_std, scenario.radar_vr_std,
+                                   scenario.detection_prob, scenario.clutter_rate,
+                                   seed * 2654435761u + 1u, 1);
+    sensor.set_clutter_region(world.x_min(), world.x_max(), world.y_min(), world.y_max());
+
+    TrackerParams tracker_params = params;
+    tracker_params.num_threads = 1;
+    MultiSensorTracker tracker(tracker_params);
+
+    scratch.arena.reset();
+    const int measured_steps = std::max(0, scenario.num_steps - scenario.warmup_steps);
+    std::pmr::vector<double> frame_ms(&scratch.arena);
+    frame_ms.reserve(measured_steps);
+
+    TrackMetrics& metrics = scratch.metrics;
+    metrics.reset(TrackMetricsParams{scenario.match_radius, 2.0});
+
+    DetectionBatch batch;
+    RunMetrics m;
+    for (int step = 0; step < scenario.num_steps; ++step) {
+        world.step();
+        sensor.generate(world.objects(), world.time(), batch);
+
+        if (step == scenario.warmup_steps) {
+            tracker.stats().reset();
+        }
+        const auto t0 = Clock::now();
+        tracker.predict(world.time());
+        tracker.update(batch);
+        const auto t1 = Clock::now();
+        if (step < scenario.warmup_steps) continue;
+
+        frame_ms.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        metrics.add_frame(world.time(), world.objects(), tracker.get_tracks());
+    }
+
+    if (measured_steps > 0) {
+        const MetricsSummary s = metrics.summary();
+        m.pos_err = s.pos_rmse;
+        m.miss_rate = s.miss_rate;
+        m.false_tracks = s.false_tracks;
+        m.gospa = s.gospa;
+        m.id_switches = static_cast<double>(s.id_switches) / measured_steps;
+        m.confirm_latency = s.confirm_latency;
+        m.births = static_cast<double>(tracker.stats().totals().tracks_born) / measured_steps;
+
+        double sum = 0.0;
+        for (double v : frame_ms) sum += v;
+        m.frame_ms = sum / frame_ms.size();
+        const std::size_t k99 = std::min(frame_ms.size() - 1,
+                                         static_cast<std::size_t>(0.99 * frame_ms.size()));
+        std::nth_element(frame_ms.begin(), frame_ms.begin() + k99, frame_ms.end());
+        m.frame_p99_ms = frame_ms[k99];
+    }
+    return m;
+}
+
+} // namespace msf
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "frame_arena.hpp"
+#include "thread_pool.hpp"
+#include "track_metrics.hpp"
+#include "traffic_scenario.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+// Monte Carlo run 하나의 scenario / 센서 설정 (TrafficScenario + ParallelSensorSimulator)
+// traffic.seed 와 traffic.num_threads 는 runner 가 run 마다 덮어쓴다
+struct MonteCarloScenario {
+    TrafficParams traffic;
+    int num_steps{200};
+    int warmup_steps{20};       // 지표에서 제외하는 앞 프레임
+
+    double cam_std{1.0};
+    double radar_r_std{1.0};
+    double radar_angle_std{0.005};
+    double radar_vr_std{0.5};
+    double detection_prob{0.9};
+    double clutter_rate{0.1};
+
+    double match_radius{3.0};   // TrackMetrics cutoff: 이 거리 밖의 truth-track 쌍은 매칭하지 않음 [m]
+};
+
+// run 하나의 지표 (warmup 이후 프레임 평균)
+struct RunMetrics {
+    int config{0};
+    std::uint32_t seed{0};
+    double pos_err{0.0};        // 매칭된 truth-track 쌍 위치 RMSE [m]
+    double miss_rate{0.0};      // confirmed track 에 매칭되지 않은 truth 비율
+    double false_tracks{0.0};   // truth 에 매칭되지 않은 confirmed track 수 / 프레임
+    double gospa{0.0};          // 프레임 평균 GOSPA (c = match_radius, p = 2)
+    double id_switches{0.0};    // track id 가 바뀐 횟수 / 프레임
+    double confirm_latency{0.0};  // truth 가 처음 confirmed track 에 매칭될 때까지 평균 시간 [s]
+    double births{0.0};         // 새 track 수 / 프레임
+    double frame_ms{0.0};       // predict + update 평균
+    double frame_p99_ms{0.0};
+};
+
+// config 하나의 seed 들에 대한 평균 / 표준편차
+struct ConfigSummary {
+    int config{0};
+    int runs{0};
+    RunMetrics mean;
+    RunMetrics stddev;
+};
+
+// TrackerParams 후보 × seed 개의 독립 run (scenario + simulator + tracker) 을 thread pool 에서 실행
+// - run 은 worker 가 공유 counter 로 하나씩 가져가므로 run 마다 시간이 달라도 부하가 고르다
+// - tracker 는 run 당 단일 스레드 (병렬성은 run 단위), 각 worker 는 자기 arena 와 TrackMetrics 를 재사용
+// - 지표는 메모리에서 모으고 파일은 쓰지 않는다 (요약표 출력은 호출측)
+// 같은 (config, seed) 는 스레드 수와 무관하게 같은 정확도 지표를 낸다 (시간 지표 제외).
+// config 끼리 같은 seed 열을 써서 (common random numbers) 차이의 분산이 작다.
+class MonteCarloRunner {
+public:
+    explicit MonteCarloRunner(int num_threads);
+
+    int num_threads() const { return pool_->size(); }
+
+    // run 순서: config 0 의 seed 0 .. num_seeds-1, config 1 ... (seed 값은 base_seed + s)
+    std::vector<ConfigSummary> run(const MonteCarloScenario& scenario,
+                                   const std::vector<TrackerParams>& configs,
+                                   int num_seeds, std::uint32_t base_seed = 1);
+
+    // 마지막 run() 의 run 별 지표
+    const std::vector<RunMetrics>& runs() const { return runs_; }
+
+private:
+    struct WorkerScratch {
+        FrameArena arena{64 * 1024};   // run 동안의 프레임 시간 샘플 (run 마다 reset)
+        TrackMetrics metrics;          // run 마다 reset, 매칭 scratch 는 재사용
+    };
+
+    RunMetrics run_one(const MonteCarloScenario& scenario, const TrackerParams& params,
+                       std::uint32_t seed, WorkerScratch& scratch) const;
+
+    std::unique_ptr<ThreadPool> pool_;
+    std::vector<std::unique_ptr<WorkerScratch>> scratch_;
+    std::vector<RunMetrics> runs_;
+};
+
+} // namespace msf
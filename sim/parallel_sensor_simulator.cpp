@@ -0,0 +1,106 @@
+#include "parallel_sensor_simulator.hpp"
+#include "philox.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace msf {
+
+namespace {
+
+// PhiloxStream 의 stream 번호 (TrafficScenario 와 겹치지 않게 8 부터)
+constexpr std::uint32_t kDetectStream = 8;
+constexpr std::uint32_t kNoiseStream = 9;
+constexpr std::uint32_t kClutterStream = 10;
+
+} // anonymous namespace
+
+ParallelSensorSimulator::ParallelSensorSimulator(double cam_std,
+                                                 double radar_r_std,
+                                                 double radar_angle_std,
+                                                 double radar_vr_std,
+                                                 double detection_prob,
+                                                 double clutter_rate,
+                                                 std::uint32_t seed,
+                                                 int num_threads)
+    : cam_std_(cam_std),
+      radar_r_std_(radar_r_std),
+      radar_angle_std_(radar_angle_std),
+      radar_vr_std_(radar_vr_std),
+      detection_prob_(detection_prob),
+      clutter_rate_(clutter_rate),
+      seed_(seed),
+      pool_(std::make_unique<ThreadPool>(num_threads)),
+      worker_offset_(pool_->size() + 1, 0) {}
+
+void ParallelSensorSimulator::set_clutter_region(double x_min, double x_max,
+                                                 double y_min, double y_max) {
+    clutter_x_min_ = x_min;
+    clutter_x_max_ = x_max;
+    clutter_y_min_ = y_min;
+    clutter_y_max_ = y_max;
+}
+
+void ParallelSensorSimulator::generate(const std::vector<ObjectState>& objects,
+                                       double timestamp,
+                                       DetectionBatch& out) {
+    ++frame_;
+    const std::size_t n = objects.size();
+    flags_.resize(n);
+
+    // pass 1: object 별 검출 여부와 worker 구간별 detection 수
+    std::fill(worker_offset_.begin(), worker_offset_.end(), 0);
+    pool_->parallel_for(n, [&](std::size_t begin, std::size_t end, int worker) {
+        std::size_t count = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            PhiloxStream rng(seed_, static_cast<std::uint32_t>(objects[i].id), frame_,
+                             kDetectStream);
+            const bool cam = rng.uniform() < detection_prob_;
+            const bool radar = rng.uniform() < detection_prob_;
+            flags_[i] = static_cast<std::uint8_t>(cam | (radar << 1));
+            count += cam + radar;
+        }
+        worker_offset_[worker + 1] = count;
+    });
+    for (std::size_t w = 1; w < worker_offset_.size(); ++w) {
+        worker_offset_[w] += worker_offset_[w - 1];
+    }
+    const std::size_t n_real = worker_offset_.back();
+    const std::size_t n_clutter = static_cast<std::size_t>(n * clutter_rate_);
+    out.resize(n_real + n_clutter);
+
+    // pass 2: 같은 구간 분할로 각 worker 가 자기 출력 위치부터 기록
+    pool_->parallel_for(n, [&](std::size_t begin, std::size_t end, int worker) {
+        std::size_t pos = worker_offset_[worker];
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::uint8_t f = flags_[i];
+            if (f == 0) continue;
+            const ObjectState& obj = objects[i];
+            PhiloxStream rng(seed_, static_cast<std::uint32_t>(obj.id), frame_, kNoiseStream);
+            if (f & 1) {
+                out.set_camera(pos++, obj.x + cam_std_ * rng.normal(),
+                               obj.y + cam_std_ * rng.normal(), timestamp);
+            }
+            if (f & 2) {
+                const double r = std::sqrt(obj.x * obj.x + obj.y * obj.y);
+                const double phi = std::atan2(obj.y, obj.x);
+                const double vr = (obj.x * obj.vx + obj.y * obj.vy) / (r + 1e-6);
+                out.set_radar(pos++, r + radar_r_std_ * rng.normal(),
+                              phi + radar_angle_std_ * rng.normal(),
+                              vr + radar_vr_std_ * rng.normal(), timestamp);
+            }
+        }
+    });
+
+    // clutter (가짜 detection, 카메라 잡음이라고 가정)
+    pool_->parallel_for(n_clutter, [&](std::size_t begin, std::size_t end, int) {
+        for (std::size_t k = begin; k < end; ++k) {
+            PhiloxStream rng(seed_, static_cast<std::uint32_t>(k), frame_, kClutterStream);
+            const double x = rng.uniform(clutter_x_min_, clutter_x_max_);
+            const double y = rng.uniform(clutter_y_min_, clutter_y_max_);
+            out.set_camera(n_real + k, x, y, timestamp, 0.2);
+        }
+    });
+}
+
+} // namespace msf
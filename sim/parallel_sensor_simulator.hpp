@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "detection_batch.hpp"
+#include "highway_scenario.hpp"
+#include "thread_pool.hpp"
+
+namespace msf {
+
+// SensorSimulator 와 같은 센서 모델 (camera 위치, 원점 radar, clutter) 을 병렬로 생성
+// 난수는 (seed, object id, frame) 을 키로 하는 Philox 라서 결과가 스레드 수와 무관하게 같다.
+// 출력 순서: object 순서대로 [camera][radar] (검출된 것만), 그 뒤에 clutter.
+// out 은 resize 후 자리에 직접 기록하므로 크기가 비슷한 프레임을 반복하면 할당이 없다.
+class ParallelSensorSimulator {
+public:
+    ParallelSensorSimulator(double cam_std,
+                            double radar_r_std,
+                            double radar_angle_std,
+                            double radar_vr_std,
+                            double detection_prob = 0.9,
+                            double clutter_rate   = 0.05,
+                            std::uint32_t seed    = 1234,
+                            int num_threads       = 1);
+
+    // clutter 를 뿌릴 영역 (기본값은 SensorSimulator 와 같은 x [0, 120], y [-10, 10])
+    void set_clutter_region(double x_min, double x_max, double y_min, double y_max);
+
+    // 호출할 때마다 frame 번호가 하나씩 올라가 다음 난수 열을 쓴다
+    void generate(const std::vector<ObjectState>& objects,
+                  double timestamp,
+                  DetectionBatch& out);
+
+private:
+    double cam_std_;
+    double radar_r_std_;
+    double radar_angle_std_;
+    double radar_vr_std_;
+    double detection_prob_;
+    double clutter_rate_;
+    std::uint32_t seed_;
+    std::uint32_t frame_{0};
+
+    double clutter_x_min_{0.0};
+    double clutter_x_max_{120.0};
+    double clutter_y_min_{-10.0};
+    double clutter_y_max_{10.0};
+
+    std::unique_ptr<ThreadPool> pool_;
+
+    // object 별 검출 여부 (bit 0: camera, bit 1: radar) 와 worker 구간별 출력 시작 위치
+    // (parallel_for 의 구간 분할은 n 과 스레드 수로만 정해지므로 두 pass 가 같은 구간을 받는다)
+    std::vector<std::uint8_t> flags_;
+    std::vector<std::size_t> worker_offset_;
+};
+
+} // namespace msf
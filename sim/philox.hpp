@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace msf {
+
+// counter 기반 난수 생성기 Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+// 상태가 없고 (counter, key) 만으로 128 bit 가 정해지므로, 난수를 object id / step 으로 키를 잡으면
+// 어느 스레드가 어떤 순서로 object 를 방문해도 같은 값이 나온다.
+struct Philox4x32 {
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter c, Key k) {
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                k[0] += kWeyl0;
+                k[1] += kWeyl1;
+            }
+            const std::uint64_t p0 = static_cast<std::uint64_t>(kMul0) * c[0];
+            const std::uint64_t p1 = static_cast<std::uint64_t>(kMul1) * c[2];
+            c = {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0],
+                 static_cast<std::uint32_t>(p1),
+                 static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1],
+                 static_cast<std::uint32_t>(p0)};
+        }
+        return c;
+    }
+
+    static constexpr std::uint32_t kMul0 = 0xD2511F53u;
+    static constexpr std::uint32_t kMul1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t kWeyl0 = 0x9E3779B9u;
+    static constexpr std::uint32_t kWeyl1 = 0xBB67AE85u;
+};
+
+// Philox 한 갈래를 균등 / 정규 난수 열로 쓰는 작은 stream
+// key = (seed, id), counter = (step, stream, block, 0). block 만 올려 가며 128 bit 씩 꺼낸다.
+// 같은 (seed, id, step, stream) 이면 항상 같은 열이 나온다.
+class PhiloxStream {
+public:
+    PhiloxStream(std::uint32_t seed, std::uint32_t id, std::uint32_t step, std::uint32_t stream)
+        : key_{seed, id}, counter_{step, stream, 0u, 0u} {}
+
+    std::uint32_t next_u32() {
+        if (used_ == 4) {
+            block_ = Philox4x32::generate(counter_, key_);
+            ++counter_[2];
+            used_ = 0;
+        }
+        return block_[used_++];
+    }
+
+    // (0, 1) 균등 (양 끝 제외, log 에 바로 넣을 수 있음)
+    double uniform() { return (next_u32() + 0.5) * (1.0 / 4294967296.0); }
+
+    double uniform(double lo, double hi) { return lo + (hi - lo) * uniform(); }
+
+    // 표준 정규 (Box-Muller, 두 번째 값은 다음 호출에 사용)
+    double normal() {
+        if (has_spare_) {
+            has_spare_ = false;
+            return spare_;
+        }
+        const double r = std::sqrt(-2.0 * std::log(uniform()));
+        const double theta = 2.0 * M_PI * uniform();
+        spare_ = r * std::sin(theta);
+        has_spare_ = true;
+        return r * std::cos(theta);
+    }
+
+private:
+    Philox4x32::Key key_;
+    Philox4x32::Counter counter_;
+    Philox4x32::Counter block_{};
+    int used_{4};
+    double spare_{0.0};
+    bool has_spare_{false};
+};
+
+} // namespace msf
@@ -10,18 +10,33 @@ SensorSimulator::SensorSimulator(double cam_std,
                                  double radar_angle_std,
                                  double radar_vr_std,
                                  double detection_prob,
-                                 double clutter_rate)
+                                 double clutter_rate,
+                                 unsigned seed)
     : cam_std_(cam_std),
       radar_r_std_(radar_r_std),
       radar_angle_std_(radar_angle_std),
       radar_vr_std_(radar_vr_std),
       detection_prob_(detection_prob),
       clutter_rate_(clutter_rate),
-      rng_(1234) {}
+      rng_(seed) {}
 
 std::vector<Detection> SensorSimulator::generate(const std::vector<ObjectState>& objects,
                                                  double timestamp) {
+    DetectionBatch batch;
+    generate(objects, timestamp, batch);
+
     std::vector<Detection> detections;
+    detections.reserve(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        detections.push_back(batch.at(i));
+    }
+    return detections;
+}
+
+void SensorSimulator::generate(const std::vector<ObjectState>& objects,
+                               double timestamp,
+                               DetectionBatch& out) {
+    out.clear();
     std::normal_distribution<double> cam_noise(0.0, cam_std_);
     std::normal_distribution<double> r_noise(0.0, radar_r_std_);
     std::normal_distribution<double> angle_noise(0.0, radar_angle_std_);
@@ -32,13 +47,9 @@ std::vector<Detection> SensorSimulator::generate(const std::vector<ObjectState>&
     for (const auto& obj : objects) {
         // Camera detection
         if (uni01(rng_) < detection_prob_) {
-            Detection det;
-            det.sensor = SensorType::Camera;
-            det.timestamp = timestamp;
-            det.z = Eigen::VectorXd(2);
-            det.z(0) = obj.x + cam_noise(rng_);
-            det.z(1) = obj.y + cam_noise(rng_);
-            detections.push_back(det);
+            double x = obj.x + cam_noise(rng_);
+            double y = obj.y + cam_noise(rng_);
+            out.push_camera(x, y, timestamp);
         }
 
         // Radar detection
@@ -47,14 +58,10 @@ std::vector<Detection> SensorSimulator::generate(const std::vector<ObjectState>&
             double phi = std::atan2(obj.y, obj.x);
             double vr = (obj.x * obj.vx + obj.y * obj.vy) / (r + 1e-6);
 
-            Detection det;
-            det.sensor = SensorType::Radar;
-            det.timestamp = timestamp;
-            det.z = Eigen::VectorXd(3);
-            det.z(0) = r + r_noise(rng_);
-            det.z(1) = phi + angle_noise(rng_);
-            det.z(2) = vr + vr_noise(rng_);
-            detections.push_back(det);
+            double r_meas = r + r_noise(rng_);
+            double phi_meas = phi + angle_noise(rng_);
+            double vr_meas = vr + vr_noise(rng_);
+            out.push_radar(r_meas, phi_meas, vr_meas, timestamp);
         }
     }
 
@@ -64,17 +71,11 @@ std::vector<Detection> SensorSimulator::generate(const std::vector<ObjectState>&
     std::uniform_real_distribution<double> clutter_y(-10.0, 10.0);
 
     for (int i = 0; i < num_clutter; ++i) {
-        Detection det;
-        det.sensor = SensorType::Camera; // 잡음은 카메라 잡음이라고 가정
-        det.timestamp = timestamp;
-        det.z = Eigen::VectorXd(2);
-        det.z(0) = clutter_x(rng_);
-        det.z(1) = clutter_y(rng_);
-        det.confidence = 0.2;
-        detections.push_back(det);
+        // 잡음은 카메라 잡음이라고 가정
+        double x = clutter_x(rng_);
+        double y = clutter_y(rng_);
+        out.push_camera(x, y, timestamp, 0.2);
     }
-
-    return detections;
 }
 
 } // namespace msf
@@ -3,6 +3,7 @@
 #include <vector>
 #include <random>
 #include "types.hpp"
+#include "detection_batch.hpp"
 #include "highway_scenario.hpp"
 
 namespace msf {
@@ -14,11 +15,17 @@ public:
                     double radar_angle_std,
                     double radar_vr_std,
                     double detection_prob = 0.9,
-                    double clutter_rate   = 0.05);
+                    double clutter_rate   = 0.05,
+                    unsigned seed         = 1234);
 
     std::vector<Detection> generate(const std::vector<ObjectState>& objects,
                                     double timestamp);
 
+    // 미리 할당된 batch 에 직접 기록 (out 은 clear 후 채움)
+    void generate(const std::vector<ObjectState>& objects,
+                  double timestamp,
+                  DetectionBatch& out);
+
 private:
     double cam_std_;
     double radar_r_std_;
@@ -0,0 +1,163 @@
+#include "track_metrics.hpp"
+#include "data_association.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace msf {
+
+TrackMetrics::TrackMetrics(const TrackMetricsParams& params)
+    : params_(params), cutoff_p_(std::pow(params.cutoff, params.order)) {}
+
+void TrackMetrics::reset(const TrackMetricsParams& params) {
+    params_ = params;
+    cutoff_p_ = std::pow(params.cutoff, params.order);
+    reset();
+}
+
+void TrackMetrics::reset() {
+    frame_ = FrameMetrics{};
+    frames_ = truths_ = tracks_ = matched_ = id_switches_ = 0;
+    gospa_sum_ = ospa_sum_ = pos_sq_sum_ = vel_sq_sum_ = 0.0;
+    latency_sum_ = latency_max_ = 0.0;
+    truths_seen_ = truths_confirmed_ = 0;
+    truth_state_.clear();
+}
+
+const FrameMetrics& TrackMetrics::add_frame(double timestamp,
+                                            const std::vector<ObjectState>& truth,
+                                            const std::vector<TrackState>& tracks) {
+    const double c = params_.cutoff;
+    const double p = params_.order;
+    const int n_truth = static_cast<int>(truth.size());
+
+    truth_pos_.clear();
+    for (const auto& o : truth) {
+        truth_pos_.emplace_back(o.x, o.y);
+    }
+    truth_grid_.build(truth_pos_);
+
+    track_index_.clear();
+    for (int i = 0; i < static_cast<int>(tracks.size()); ++i) {
+        if (tracks[i].confirmed) {
+            track_index_.push_back(i);
+        }
+    }
+    const int n_tracks = static_cast<int>(track_index_.size());
+
+    // cutoff 안의 쌍만 후보 (cost = d^p)
+    candidates_.clear();
+    for (int k = 0; k < n_tracks; ++k) {
+        const TrackState& t = tracks[track_index_[k]];
+        query_.clear();
+        truth_grid_.query(t.x(0), t.x(1), c, query_);
+        for (int j : query_) {
+            const double d2 = (truth_pos_[j] - t.x.head<2>()).squaredNorm();
+            if (d2 < c * c) {
+                candidates_.push_back({k, j, p == 2.0 ? d2 : std::pow(d2, 0.5 * p)});
+            }
+        }
+    }
+
+    // 미할당 track 비용 c^p 로 두면 sum(d^p) + c^p * (미할당 track) 최소화
+    // = sum(d^p - c^p) 최소화 = GOSPA (alpha = 2) 최소화
+    arena_.reset();
+    const AssociationResult assoc =
+        associate_optimal(candidates_, n_tracks, n_truth, cutoff_p_, &arena_);
+
+    FrameMetrics f;
+    f.timestamp = timestamp;
+    f.truths = n_truth;
+    f.tracks = n_tracks;
+
+    for (const auto& o : truth) {
+        if (o.id < 0) continue;
+        if (o.id >= static_cast<int>(truth_state_.size())) {
+            truth_state_.resize(o.id + 1);
+        }
+        TruthState& s = truth_state_[o.id];
+        if (!s.seen) {
+            s.seen = true;
+            s.first_seen = timestamp;
+            ++truths_seen_;
+        }
+    }
+
+    double loc = 0.0;
+    for (int k = 0; k < n_tracks; ++k) {
+        const int j = assoc.track_assignment[k];
+        if (j < 0) continue;
+        const TrackState& t = tracks[track_index_[k]];
+        const ObjectState& o = truth[j];
+        const double d2 = (truth_pos_[j] - t.x.head<2>()).squaredNorm();
+        const double dv2 = (Eigen::Vector2d(o.vx, o.vy) - t.x.tail<2>()).squaredNorm();
+        loc += p == 2.0 ? d2 : std::pow(d2, 0.5 * p);
+        pos_sq_sum_ += d2;
+        vel_sq_sum_ += dv2;
+        ++f.matched;
+
+        if (o.id < 0) continue;
+        TruthState& s = truth_state_[o.id];
+        if (s.last_track >= 0 && s.last_track != t.id) {
+            ++f.id_switches;
+        }
+        s.last_track = t.id;
+        if (!s.confirmed) {
+            s.confirmed = true;
+            const double latency = timestamp - s.first_seen;
+            latency_sum_ += latency;
+            latency_max_ = std::max(latency_max_, latency);
+            ++truths_confirmed_;
+        }
+    }
+
+    f.gospa_loc = loc;
+    f.gospa_missed = 0.5 * cutoff_p_ * (n_truth - f.matched);
+    f.gospa_false = 0.5 * cutoff_p_ * (n_tracks - f.matched);
+    f.gospa = std::pow(f.gospa_loc + f.gospa_missed + f.gospa_false, 1.0 / p);
+
+    // OSPA: 작은 쪽의 미매칭 원소는 c 로 잘린 거리로 짝지어지므로 같은 할당이 최적
+    const int n = std::max(n_truth, n_tracks);
+    f.ospa = n > 0 ? std::pow((loc + cutoff_p_ * (n - f.matched)) / n, 1.0 / p) : 0.0;
+
+    ++frames_;
+    truths_ += n_truth;
+    tracks_ += n_tracks;
+    matched_ += f.matched;
+    id_switches_ += f.id_switches;
+    gospa_sum_ += f.gospa;
+    ospa_sum_ += f.ospa;
+
+    frame_ = f;
+    return frame_;
+}
+
+MetricsSummary TrackMetrics::summary() const {
+    MetricsSummary s;
+    s.frames = frames_;
+    s.id_switches = id_switches_;
+    s.truths_seen = truths_seen_;
+    s.truths_confirmed = truths_confirmed_;
+    s.confirm_latency_max = latency_max_;
+    if (frames_ == 0) return s;
+
+    s.gospa = gospa_sum_ / frames_;
+    s.ospa = ospa_sum_ / frames_;
+    s.false_tracks = static_cast<double>(tracks_ - matched_) / frames_;
+    if (matched_ > 0) {
+        s.pos_rmse = std::sqrt(pos_sq_sum_ / matched_);
+        s.vel_rmse = std::sqrt(vel_sq_sum_ / matched_);
+    }
+    if (truths_ > 0) {
+        s.miss_rate = 1.0 - static_cast<double>(matched_) / truths_;
+    }
+    if (tracks_ > 0) {
+        s.false_track_rate = static_cast<double>(tracks_ - matched_) / tracks_;
+    }
+    if (truths_confirmed_ > 0) {
+        s.confirm_latency = latency_sum_ / truths_confirmed_;
+    }
+    return s;
+}
+
+} // namespace msf
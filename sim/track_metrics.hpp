@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Eigen/Dense>
+#include "frame_arena.hpp"
+#include "gating.hpp"
+#include "highway_scenario.hpp"
+#include "types.hpp"
+
+namespace msf {
+
+struct TrackMetricsParams {
+    double cutoff{3.0};   // GOSPA / OSPA cutoff c [m], 이보다 먼 truth-track 쌍은 매칭하지 않음
+    double order{2.0};    // GOSPA / OSPA order p (alpha 는 2 고정)
+};
+
+// 한 프레임의 지표
+struct FrameMetrics {
+    double timestamp{0.0};
+    int truths{0};
+    int tracks{0};          // confirmed track 수
+    int matched{0};
+    int id_switches{0};
+
+    double gospa{0.0};
+    double gospa_loc{0.0};     // GOSPA^p 중 매칭 쌍 거리 부분
+    double gospa_missed{0.0};  // c^p / 2 * 놓친 truth 수
+    double gospa_false{0.0};   // c^p / 2 * false track 수
+    double ospa{0.0};
+};
+
+// 지금까지 넣은 프레임 전체 요약
+struct MetricsSummary {
+    std::uint64_t frames{0};
+    double gospa{0.0};           // 프레임 평균
+    double ospa{0.0};            // 프레임 평균 (truth, track 모두 없는 프레임은 0)
+    double pos_rmse{0.0};        // 매칭 쌍 위치 RMSE [m]
+    double vel_rmse{0.0};        // 매칭 쌍 속도 RMSE [m/s]
+    double miss_rate{0.0};       // 매칭되지 않은 truth 비율
+    double false_tracks{0.0};    // 매칭되지 않은 confirmed track 수 / 프레임
+    double false_track_rate{0.0};  // 매칭되지 않은 confirmed track 비율
+    std::uint64_t id_switches{0};  // truth 가 이전과 다른 track id 에 매칭된 횟수
+
+    // truth 가 처음 나타난 뒤 confirmed track 에 처음 매칭될 때까지 시간 [s]
+    double confirm_latency{0.0};      // 평균
+    double confirm_latency_max{0.0};
+    int truths_seen{0};
+    int truths_confirmed{0};
+};
+
+// 프레임마다 ground truth 와 tracker 출력을 받아 tracking 품질 지표를 누적하는 streaming 계산기
+// - 매 프레임 truth ↔ confirmed track 을 GOSPA (alpha = 2) 최적 할당으로 매칭한다.
+//   cost d^p, max_cost c^p 의 associate_optimal 이 곧 GOSPA 최소화이고 OSPA 도 같은 할당에서 나온다.
+//   후보는 cutoff 반경 격자 질의로만 만든다.
+// - 누적값은 합계만 들고 있어서 메모리는 run 길이와 무관하다.
+//   (truth id 별 상태 하나씩: 마지막 매칭 track id, 처음 나타난 시각, confirm 여부)
+// - 매칭용 scratch 는 재사용하므로 크기가 안정되면 프레임당 heap 할당이 없다.
+class TrackMetrics {
+public:
+    explicit TrackMetrics(const TrackMetricsParams& params = TrackMetricsParams{});
+
+    // 한 프레임 추가 (tracks 중 confirmed 만 추정으로 본다)
+    const FrameMetrics& add_frame(double timestamp, const std::vector<ObjectState>& truth,
+                                  const std::vector<TrackState>& tracks);
+
+    const FrameMetrics& last_frame() const { return frame_; }
+    MetricsSummary summary() const;
+
+    // 누적값과 truth 상태 초기화 (scratch 용량은 유지)
+    void reset();
+    // 새 cutoff / order 로 바꾸고 reset
+    void reset(const TrackMetricsParams& params);
+
+    const TrackMetricsParams& params() const { return params_; }
+
+private:
+    struct TruthState {
+        int last_track{-1};         // 마지막으로 매칭된 track id
+        double first_seen{0.0};
+        bool seen{false};
+        bool confirmed{false};
+    };
+
+    TrackMetricsParams params_;
+    double cutoff_p_{0.0};   // c^p
+
+    FrameMetrics frame_;
+
+    // 누적값
+    std::uint64_t frames_{0};
+    std::uint64_t truths_{0};
+    std::uint64_t tracks_{0};
+    std::uint64_t matched_{0};
+    std::uint64_t id_switches_{0};
+    double gospa_sum_{0.0};
+    double ospa_sum_{0.0};
+    double pos_sq_sum_{0.0};
+    double vel_sq_sum_{0.0};
+    double latency_sum_{0.0};
+    double latency_max_{0.0};
+    int truths_seen_{0};
+    int truths_confirmed_{0};
+    std::vector<TruthState> truth_state_;   // truth id 로 index
+
+    // 프레임 scratch
+    FrameArena arena_{16 * 1024};
+    SpatialGrid truth_grid_;
+    std::vector<Eigen::Vector2d> truth_pos_;
+    std::vector<int> track_index_;   // confirmed track → tracks index
+    std::vector<int> query_;
+    std::vector<GateCandidate> candidates_;
+};
+
+} // namespace msf
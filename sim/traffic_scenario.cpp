@@ -0,0 +1,128 @@
+#include "traffic_scenario.hpp"
+#include "philox.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace msf {
+
+namespace {
+
+// PhiloxStream 의 stream 번호 (같은 object / step 에서 용도별로 다른 열)
+constexpr std::uint32_t kInitStream = 0;
+constexpr std::uint32_t kStepStream = 1;
+
+} // anonymous namespace
+
+TrafficScenario::TrafficScenario(const TrafficParams& params)
+    : params_(params),
+      pool_(std::make_unique<ThreadPool>(params.num_threads)),
+      worker_lane_changes_(pool_->size(), 0) {
+    const int n = std::max(0, params_.num_objects);
+    const int lanes = std::max(1, params_.num_lanes);
+    params_.num_lanes = lanes;
+    const int slots = std::max(1, static_cast<int>(params_.road_length / params_.vehicle_gap));
+    const int per_road = lanes * slots;
+    const int roads = std::max(1, (n + per_road - 1) / per_road);
+    y_min_ = lane_y(0, 0) - params_.lane_width;
+    y_max_ = lane_y(roads - 1, lanes - 1) + params_.lane_width;
+
+    vehicles_.resize(n);
+    objects_.resize(n);
+    pool_->parallel_for(n, [&](std::size_t begin, std::size_t end, int) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const int k = static_cast<int>(i) % per_road;
+            const int slot = k / lanes;
+            PhiloxStream rng(params_.seed, static_cast<std::uint32_t>(i), 0, kInitStream);
+
+            Vehicle& v = vehicles_[i];
+            v.road = static_cast<int>(i) / per_road;
+            v.lane = k % lanes;
+            v.speed = rng.uniform(params_.speed_min, params_.speed_max);
+
+            ObjectState& o = objects_[i];
+            o.id = static_cast<int>(i);
+            o.x = params_.road_start_x + (slot + 0.5) * params_.vehicle_gap +
+                  rng.uniform(-0.25, 0.25) * params_.vehicle_gap;
+            o.y = lane_y(v.road, v.lane);
+            o.vx = v.speed;
+            o.vy = 0.0;
+        }
+    });
+}
+
+double TrafficScenario::lane_y(int road, int lane) const {
+    return road * params_.road_spacing +
+           (lane - 0.5 * (params_.num_lanes - 1)) * params_.lane_width;
+}
+
+void TrafficScenario::step() {
+    ++step_;
+    time_ += params_.dt;
+
+    const double dt = params_.dt;
+    const double p_accel = params_.accel_change_rate * dt;
+    const double p_lane = params_.lane_change_rate * dt;
+    const double lc_time = params_.lane_change_time;
+
+    std::fill(worker_lane_changes_.begin(), worker_lane_changes_.end(), 0);
+    pool_->parallel_for(vehicles_.size(), [&](std::size_t begin, std::size_t end, int worker) {
+        std::uint64_t started = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            Vehicle& v = vehicles_[i];
+            ObjectState& o = objects_[i];
+            // object 마다 step 당 난수 4 개 (한 block) 를 항상 같은 순서로 쓴다
+            PhiloxStream rng(params_.seed, static_cast<std::uint32_t>(o.id), step_, kStepStream);
+            const double u_accel = rng.uniform();
+            const double u_accel_value = rng.uniform();
+            const double u_lane = rng.uniform();
+            const double u_dir = rng.uniform();
+
+            // 가속 profile
+            if (u_accel < p_accel) {
+                v.accel = -params_.max_decel +
+                          (params_.max_accel + params_.max_decel) * u_accel_value;
+            }
+            v.speed = std::clamp(v.speed + v.accel * dt, params_.speed_min, params_.speed_max);
+
+            // 차선 변경 시작 (끝 차선이면 안쪽으로)
+            if (v.lane_progress < 0.0 && u_lane < p_lane && params_.num_lanes > 1) {
+                int target = v.lane + (u_dir < 0.5 ? -1 : 1);
+                if (target < 0 || target >= params_.num_lanes) {
+                    target = 2 * v.lane - target;
+                }
+                v.y_from = lane_y(v.road, v.lane);
+                v.y_to = lane_y(v.road, target);
+                v.lane = target;
+                v.lane_progress = 0.0;
+                ++started;
+            }
+
+            // 차선 변경 중에는 y 를 (1 - cos) profile 로 이동
+            double vy = 0.0;
+            if (v.lane_progress >= 0.0) {
+                v.lane_progress = std::min(1.0, v.lane_progress + dt / lc_time);
+                const double dy = v.y_to - v.y_from;
+                o.y = v.y_from + 0.5 * dy * (1.0 - std::cos(M_PI * v.lane_progress));
+                vy = 0.5 * dy * M_PI / lc_time * std::sin(M_PI * v.lane_progress);
+                if (v.lane_progress >= 1.0) {
+                    v.lane_progress = -1.0;
+                }
+            }
+
+            o.x += v.speed * dt;
+            if (o.x >= x_max()) {
+                o.x -= params_.road_length;
+            }
+            o.vx = v.speed;
+            o.vy = vy;
+        }
+        worker_lane_changes_[worker] = started;
+    });
+
+    for (std::uint64_t c : worker_lane_changes_) {
+        lane_changes_ += c;
+    }
+}
+
+} // namespace msf
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "highway_scenario.hpp"
+#include "thread_pool.hpp"
+
+namespace msf {
+
+struct TrafficParams {
+    int num_objects{1000};
+    double dt{0.1};
+
+    // 도로 하나: num_lanes 차선, 길이 road_length 의 ring (끝을 지나면 처음으로)
+    // 한 도로에 num_lanes * (road_length / vehicle_gap) 대씩 채우고 남으면 y 로 road_spacing 만큼
+    // 떨어진 다음 도로에 놓는다 (object 수가 늘어도 차량 밀도는 그대로)
+    int num_lanes{4};
+    double lane_width{3.5};
+    double road_length{2000.0};
+    double road_spacing{30.0};
+    double road_start_x{20.0};
+    double vehicle_gap{25.0};   // 같은 차선 초기 차간 거리 [m]
+
+    double speed_min{15.0};
+    double speed_max{35.0};
+
+    // 가속 profile: 평균 1 / accel_change_rate 초마다 [-max_decel, max_accel] 에서 새 가속도
+    double max_accel{2.0};
+    double max_decel{4.0};
+    double accel_change_rate{0.2};
+
+    // 차선 변경: 차선 유지 중 평균 1 / lane_change_rate 초마다 옆 차선으로 lane_change_time 동안 이동
+    double lane_change_rate{0.05};
+    double lane_change_time{4.0};
+
+    std::uint32_t seed{1};
+    int num_threads{1};
+};
+
+// 대규모 부하 시험용 차량 scenario
+// 난수는 (seed, object id, step) 을 키로 하는 Philox 라서 step() 은 object 단위로 병렬이고
+// 결과는 스레드 수 / 방문 순서와 무관하게 bit 단위로 같다.
+// objects() 는 HighwayScenario 와 같은 형식이라 SensorSimulator / ParallelSensorSimulator 에 그대로 쓴다.
+class TrafficScenario {
+public:
+    explicit TrafficScenario(const TrafficParams& params);
+
+    void step();
+
+    const std::vector<ObjectState>& objects() const { return objects_; }
+    double time() const { return time_; }
+
+    // 차량이 있을 수 있는 영역 (clutter 영역 등에 사용)
+    double x_min() const { return params_.road_start_x; }
+    double x_max() const { return params_.road_start_x + params_.road_length; }
+    double y_min() const { return y_min_; }
+    double y_max() const { return y_max_; }
+
+    // 지금까지 시작한 차선 변경 수
+    std::uint64_t lane_changes() const { return lane_changes_; }
+
+private:
+    struct Vehicle {
+        double speed{0.0};
+        double accel{0.0};
+        double y_from{0.0};        // 차선 변경 시작 / 끝 y
+        double y_to{0.0};
+        double lane_progress{-1.0};   // 차선 변경 진행률 [0, 1), 음수면 차선 유지
+        int lane{0};
+        int road{0};
+    };
+
+    double lane_y(int road, int lane) const;
+
+    TrafficParams params_;
+    std::unique_ptr<ThreadPool> pool_;
+    std::uint32_t step_{0};
+    double time_{0.0};
+    double y_min_{0.0};
+    double y_max_{0.0};
+    std::vector<Vehicle> vehicles_;
+    std::vector<ObjectState> objects_;
+    std::vector<std::uint64_t> worker_lane_changes_;
+    std::uint64_t lane_changes_{0};
+};
+
+} // namespace msf
@@ -0,0 +1,361 @@
+#include "binary_log.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace msf {
+
+// ---------------------------------------------------------------------------
+// BinaryLogWriter
+
+BinaryLogWriter::~BinaryLogWriter() {
+    close();
+}
+
+bool BinaryLogWriter::open(const std::string& path, LogRecordType type,
+                           std::uint32_t record_size, std::size_t records_per_chunk) {
+    close();
+
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    ok_ = true;
+    offset_ = 0;
+    record_type_ = type;
+    record_size_ = record_size;
+    records_per_chunk_ = std::max<std::size_t>(1, records_per_chunk);
+    chunk_.resize(records_per_chunk_ * record_size_);
+    chunk_count_ = 0;
+    total_records_ = 0;
+    index_.clear();
+
+    LogFileHeader header{};
+    header.magic = kLogMagic;
+    header.version = kLogVersion;
+    header.record_type = static_cast<std::uint32_t>(type);
+    header.record_size = record_size;
+    return write_all(&header, sizeof(header));
+}
+
+bool BinaryLogWriter::write_all(const void* data, std::size_t bytes) {
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        const ssize_t n = ::write(fd_, p, bytes);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ok_ = false;
+            return false;
+        }
+        p += n;
+        bytes -= static_cast<std::size_t>(n);
+        offset_ += static_cast<std::uint64_t>(n);
+    }
+    return true;
+}
+
+void BinaryLogWriter::append(const void* record, double timestamp) {
+    // I/O 오류 이후에는 더 기록하지 않는다 (close() 가 false 를 돌려줌)
+    if (fd_ < 0 || !ok_) {
+        return;
+    }
+    if (chunk_count_ == 0) {
+        chunk_t_min_ = chunk_t_max_ = timestamp;
+    } else {
+        chunk_t_min_ = std::min(chunk_t_min_, timestamp);
+        chunk_t_max_ = std::max(chunk_t_max_, timestamp);
+    }
+    std::memcpy(chunk_.data() + static_cast<std::size_t>(chunk_count_) * record_size_,
+                record, record_size_);
+    if (++chunk_count_ == records_per_chunk_) {
+        flush_chunk();
+    }
+}
+
+void BinaryLogWriter::flush_chunk() {
+    if (chunk_count_ == 0) {
+        return;
+    }
+
+    LogChunkHeader header{};
+    header.magic = kLogChunkMagic;
+    header.count = chunk_count_;
+    header.t_min = chunk_t_min_;
+    header.t_max = chunk_t_max_;
+
+    LogIndexEntry entry{};
+    entry.offset = offset_;
+    entry.count = chunk_count_;
+    entry.t_min = chunk_t_min_;
+    entry.t_max = chunk_t_max_;
+
+    // chunk header + record 를 한 번의 시스템 호출로 기록 (부분 기록이면 나머지는 write)
+    const std::size_t data_bytes = static_cast<std::size_t>(chunk_count_) * record_size_;
+    iovec iov[2];
+    iov[0].iov_base = &header;
+    iov[0].iov_len = sizeof(header);
+    iov[1].iov_base = chunk_.data();
+    iov[1].iov_len = data_bytes;
+
+    ssize_t n;
+    do {
+        n = ::writev(fd_, iov, 2);
+    } while (n < 0 && errno == EINTR);
+
+    chunk_count_ = 0;
+    if (n < 0) {
+        ok_ = false;
+        return;
+    }
+    offset_ += static_cast<std::uint64_t>(n);
+    const std::size_t written = static_cast<std::size_t>(n);
+    if (written < sizeof(header)) {
+        if (write_all(reinterpret_cast<const char*>(&header) + written, sizeof(header) - written)) {
+            write_all(chunk_.data(), data_bytes);
+        }
+    } else if (written < sizeof(header) + data_bytes) {
+        const std::size_t done = written - sizeof(header);
+        write_all(chunk_.data() + done, data_bytes - done);
+    }
+
+    // 끝까지 기록된 chunk 만 index 에 올린다
+    if (ok_) {
+        index_.push_back(entry);
+        total_records_ += entry.count;
+    }
+}
+
+bool BinaryLogWriter::close() {
+    if (fd_ < 0) {
+        return ok_;
+    }
+
+    if (ok_) {
+        flush_chunk();
+    }
+    chunk_count_ = 0;
+    // 오류가 있었으면 index / trailer 를 쓰지 않는다.
+    // 읽을 때 trailer 가 없으므로 끝까지 기록된 chunk 까지만 scan 으로 복원된다
+    if (!ok_) {
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    LogTrailer trailer{};
+    trailer.index_offset = offset_;
+    trailer.num_chunks = static_cast<std::uint32_t>(index_.size());
+    trailer.magic = kLogIndexMagic;
+    trailer.total_records = total_records_;
+    if (!index_.empty()) {
+        write_all(index_.data(), index_.size() * sizeof(LogIndexEntry));
+    }
+    write_all(&trailer, sizeof(trailer));
+
+    if (::close(fd_) != 0) {
+        ok_ = false;
+    }
+    fd_ = -1;
+    return ok_;
+}
+
+// ---------------------------------------------------------------------------
+// BinaryLogReader
+
+BinaryLogReader::~BinaryLogReader() {
+    close();
+}
+
+void BinaryLogReader::close() {
+    if (base_) {
+        ::munmap(const_cast<char*>(base_), size_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    size_ = 0;
+    index_.clear();
+    total_records_ = 0;
+    recovered_ = false;
+    time_ordered_ = true;
+}
+
+bool BinaryLogReader::open(const std::string& path) {
+    close();
+
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd_, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(LogFileHeader)) {
+        close();
+        return false;
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+
+    void* p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) {
+        base_ = nullptr;
+        close();
+        return false;
+    }
+    base_ = static_cast<const char*>(p);
+    // 재생은 앞에서부터 순차로 읽는 경우가 대부분
+    ::madvise(p, size_, MADV_SEQUENTIAL);
+
+    std::memcpy(&header_, base_, sizeof(header_));
+    if (header_.magic != kLogMagic || header_.version != kLogVersion ||
+        header_.record_size == 0 || header_.record_size % 8 != 0) {
+        close();
+        return false;
+    }
+
+    if (!load_index()) {
+        recovered_ = true;
+        if (!scan_chunks()) {
+            close();
+            return false;
+        }
+    }
+    time_ordered_ = std::is_sorted(index_.begin(), index_.end(),
+                                   [](const LogIndexEntry& a, const LogIndexEntry& b) {
+                                       return a.t_max < b.t_max;
+                                   });
+    return true;
+}
+
+bool BinaryLogReader::load_index() {
+    if (size_ < sizeof(LogFileHeader) + sizeof(LogTrailer)) {
+        return false;
+    }
+    LogTrailer trailer;
+    std::memcpy(&trailer, base_ + size_ - sizeof(trailer), sizeof(trailer));
+    if (trailer.magic != kLogIndexMagic) {
+        return false;
+    }
+    const std::uint64_t index_bytes = std::uint64_t{trailer.num_chunks} * sizeof(LogIndexEntry);
+    if (trailer.index_offset + index_bytes + sizeof(trailer) != size_) {
+        return false;
+    }
+
+    index_.resize(trailer.num_chunks);
+    if (!index_.empty()) {
+        std::memcpy(index_.data(), base_ + trailer.index_offset, index_bytes);
+    }
+    for (const auto& e : index_) {
+        if (e.offset + sizeof(LogChunkHeader) + std::uint64_t{e.count} * header_.record_size >
+            trailer.index_offset) {
+            index_.clear();
+            return false;
+        }
+    }
+    total_records_ = trailer.total_records;
+    return true;
+}
+
+bool BinaryLogReader::scan_chunks() {
+    // 완전히 기록된 chunk 까지만 복원
+    index_.clear();
+    total_records_ = 0;
+    std::uint64_t off = sizeof(LogFileHeader);
+    while (off + sizeof(LogChunkHeader) <= size_) {
+        LogChunkHeader h;
+        std::memcpy(&h, base_ + off, sizeof(h));
+        const std::uint64_t end = off + sizeof(h) + std::uint64_t{h.count} * header_.record_size;
+        if (h.magic != kLogChunkMagic || end > size_) {
+            break;
+        }
+        LogIndexEntry e{};
+        e.offset = off;
+        e.count = h.count;
+        e.t_min = h.t_min;
+        e.t_max = h.t_max;
+        index_.push_back(e);
+        total_records_ += h.count;
+        off = end;
+    }
+    return true;
+}
+
+std::size_t BinaryLogReader::find_chunk(double timestamp) const {
+    // writer 는 timestamp 순서를 강제하지 않는다 (OOSM / 재생 detection).
+    // t_max 가 증가 순이 아니면 앞에서부터 찾는다
+    if (!time_ordered_) {
+        for (std::size_t c = 0; c < index_.size(); ++c) {
+            if (index_[c].t_max >= timestamp) {
+                return c;
+            }
+        }
+        return index_.size();
+    }
+    auto it = std::lower_bound(index_.begin(), index_.end(), timestamp,
+                               [](const LogIndexEntry& e, double t) { return e.t_max < t; });
+    return static_cast<std::size_t>(it - index_.begin());
+}
+
+// ---------------------------------------------------------------------------
+// 변환
+
+DetectionRecord to_record(const Detection& det) {
+    DetectionRecord r{};
+    r.timestamp = det.timestamp;
+    const int dim = static_cast<int>(std::min<Eigen::Index>(det.z.size(), 3));
+    for (int k = 0; k < dim; ++k) {
+        r.z[k] = det.z(k);
+    }
+    r.confidence = det.confidence;
+    r.sensor = static_cast<std::uint32_t>(det.sensor);
+    r.dim = static_cast<std::uint32_t>(dim);
+    return r;
+}
+
+DetectionRecord to_record(const DetectionBatch& batch, std::size_t i) {
+    DetectionRecord r{};
+    r.timestamp = batch.timestamp(i);
+    for (int k = 0; k < batch.dim(i); ++k) {
+        r.z[k] = batch.z(i, k);
+    }
+    r.confidence = batch.confidence(i);
+    r.sensor = static_cast<std::uint32_t>(batch.sensor(i));
+    r.dim = static_cast<std::uint32_t>(batch.dim(i));
+    return r;
+}
+
+Detection from_record(const DetectionRecord& r) {
+    Detection det;
+    det.sensor = static_cast<SensorType>(r.sensor);
+    const int dim = static_cast<int>(std::min<std::uint32_t>(r.dim, 3));
+    det.z.resize(dim);
+    for (int k = 0; k < dim; ++k) {
+        det.z(k) = r.z[k];
+    }
+    det.timestamp = r.timestamp;
+    det.confidence = r.confidence;
+    return det;
+}
+
+TrackRecord to_record(const TrackState& track, double timestamp) {
+    TrackRecord r{};
+    r.timestamp = timestamp;
+    r.track_id = track.id;
+    r.confirmed = track.confirmed ? 1u : 0u;
+    for (int k = 0; k < 4; ++k) {
+        r.x[k] = track.x(k);
+    }
+    r.missed = track.missed;
+    r.age = track.age;
+    return r;
+}
+
+} // namespace msf
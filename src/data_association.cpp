@@ -1,13 +1,17 @@
 #include "data_association.hpp"
+#include "cluster_index.hpp"
+#include "lap_solver.hpp"
 #include <limits>
 #include <tuple>
 #include <algorithm>
+#include <cmath>
 
 namespace msf {
 
-AssociationResult associate_greedy(const Eigen::MatrixXd& cost_matrix,
-                                   double max_cost) {
-    AssociationResult result;
+AssociationResult associate_greedy(const Eigen::Ref<const Eigen::MatrixXd>& cost_matrix,
+                                   double max_cost,
+                                   std::pmr::memory_resource* mr) {
+    AssociationResult result(mr);
 
     const int n_tracks = static_cast<int>(cost_matrix.rows());
     const int n_dets   = static_cast<int>(cost_matrix.cols());
@@ -30,8 +34,10 @@ AssociationResult associate_greedy(const Eigen::MatrixXd& cost_matrix,
         double cost;
     };
 
-    std::vector<Pair> pairs;
-    pairs.reserve(n_tracks * n_dets);
+    // 게이트 통과 쌍 수만큼만 확보 (n_tracks * n_dets 를 통째로 잡지 않음)
+    const auto n_pairs = (cost_matrix.array() <= max_cost).count();
+    std::pmr::vector<Pair> pairs(mr);
+    pairs.reserve(n_pairs);
 
     for (int i = 0; i < n_tracks; ++i) {
         for (int j = 0; j < n_dets; ++j) {
@@ -47,17 +53,19 @@ AssociationResult associate_greedy(const Eigen::MatrixXd& cost_matrix,
                   return a.cost < b.cost;
               });
 
-    std::vector<bool> track_used(n_tracks, false);
-    std::vector<bool> det_used(n_dets, false);
+    std::pmr::vector<char> track_used(n_tracks, 0, mr);
+    std::pmr::vector<char> det_used(n_dets, 0, mr);
 
     for (const auto& p : pairs) {
         if (!track_used[p.track] && !det_used[p.det]) {
             result.track_assignment[p.track] = p.det;
-            track_used[p.track] = true;
-            det_used[p.det] = true;
+            track_used[p.track] = 1;
+            det_used[p.det] = 1;
         }
     }
 
+    result.unassigned_tracks.reserve(n_tracks);
+    result.unassigned_detections.reserve(n_dets);
     for (int i = 0; i < n_tracks; ++i) {
         if (!track_used[i]) {
             result.unassigned_tracks.push_back(i);
@@ -72,4 +80,204 @@ AssociationResult associate_greedy(const Eigen::MatrixXd& cost_matrix,
     return result;
 }
 
+AssociationResult associate_greedy(const std::vector<GateCandidate>& candidates,
+                                   int n_tracks,
+                                   int n_dets,
+                                   double max_cost,
+                                   std::pmr::memory_resource* mr) {
+    AssociationResult result(mr);
+    result.track_assignment.assign(n_tracks, -1);
+
+    std::pmr::vector<GateCandidate> pairs(mr);
+    pairs.reserve(candidates.size());
+    for (const auto& c : candidates) {
+        if (std::isfinite(c.cost) && c.cost <= max_cost) {
+            pairs.push_back(c);
+        }
+    }
+
+    // 같은 cost 일 때 dense 버전과 같은 순서가 되도록 (track, det) 로 tie-break
+    std::sort(pairs.begin(), pairs.end(),
+              [](const GateCandidate& a, const GateCandidate& b) {
+                  if (a.cost != b.cost) return a.cost < b.cost;
+                  if (a.track != b.track) return a.track < b.track;
+                  return a.det < b.det;
+              });
+
+    std::pmr::vector<char> track_used(n_tracks, 0, mr);
+    std::pmr::vector<char> det_used(n_dets, 0, mr);
+
+    for (const auto& p : pairs) {
+        if (!track_used[p.track] && !det_used[p.det]) {
+            result.track_assignment[p.track] = p.det;
+            track_used[p.track] = 1;
+            det_used[p.det] = 1;
+        }
+    }
+
+    result.unassigned_tracks.reserve(n_tracks);
+    result.unassigned_detections.reserve(n_dets);
+    for (int i = 0; i < n_tracks; ++i) {
+        if (!track_used[i]) {
+            result.unassigned_tracks.push_back(i);
+        }
+    }
+    for (int j = 0; j < n_dets; ++j) {
+        if (!det_used[j]) {
+            result.unassigned_detections.push_back(j);
+        }
+    }
+
+    return result;
+}
+
+namespace {
+
+// associate_optimal 본체 (candidates 가 std::vector / pmr::vector 어느 쪽이든 받도록 포인터 범위)
+AssociationResult associate_optimal_impl(const GateCandidate* candidates,
+                                         std::size_t n_candidates,
+                                         int n_tracks,
+                                         int n_dets,
+                                         double max_cost,
+                                         std::pmr::memory_resource* mr) {
+    AssociationResult result(mr);
+    result.track_assignment.assign(n_tracks, -1);
+
+    std::pmr::vector<GateCandidate> edges(mr);
+    edges.reserve(n_candidates);
+    for (std::size_t k = 0; k < n_candidates; ++k) {
+        const auto& c = candidates[k];
+        if (std::isfinite(c.cost) && c.cost <= max_cost) {
+            edges.push_back(c);
+        }
+    }
+
+    // track 노드 [0, n_tracks), detection 노드 [n_tracks, n_tracks + n_dets)
+    // 간선을 cluster 별로 모음 (counting sort)
+    const int n_nodes = n_tracks + n_dets;
+    ClusterIndex<std::pmr::vector<int>> clusters(mr);
+    clusters.reset(n_nodes);
+    for (const auto& e : edges) {
+        clusters.unite(e.track, n_tracks + e.det);
+    }
+    const int n_clusters = clusters.build(static_cast<int>(edges.size()),
+                                          [&](int k) { return edges[k].track; });
+    const std::pmr::vector<int>& cluster_start = clusters.start;
+    const std::pmr::vector<int>& cluster_edges = clusters.items;
+
+    // cluster 별 local index (전역 → cluster 내부 행/열 번호)
+    std::pmr::vector<int> local_index(n_nodes, -1, mr);
+    std::pmr::vector<int> rows(mr), cols(mr), row_to_col(mr);
+    std::pmr::vector<double> cost(mr);
+    LapSolver solver(mr);
+
+    for (int c = 0; c < n_clusters; ++c) {
+        const int e_begin = cluster_start[c];
+        const int e_end = cluster_start[c + 1];
+
+        // 간선 1개짜리 cluster 는 바로 할당 (cost <= max_cost 이므로 항상 이득)
+        if (e_end - e_begin == 1) {
+            const auto& e = edges[cluster_edges[e_begin]];
+            result.track_assignment[e.track] = e.det;
+            continue;
+        }
+
+        rows.clear();
+        cols.clear();
+        for (int k = e_begin; k < e_end; ++k) {
+            const auto& e = edges[cluster_edges[k]];
+            if (local_index[e.track] < 0) {
+                local_index[e.track] = static_cast<int>(rows.size());
+                rows.push_back(e.track);
+            }
+            if (local_index[n_tracks + e.det] < 0) {
+                local_index[n_tracks + e.det] = static_cast<int>(cols.size());
+                cols.push_back(e.det);
+            }
+        }
+
+        // n_r x (n_c + n_r) 행렬: 오른쪽 n_r 열은 "미할당" dummy (비용 max_cost)
+        // dummy 가 항상 있으므로 gating 밖 원소(big)는 최적해에 선택되지 않는다
+        const int n_r = static_cast<int>(rows.size());
+        const int n_c = static_cast<int>(cols.size());
+        const int m = n_c + n_r;
+        const double big = (max_cost + 1.0) * (n_r + 1);
+
+        cost.assign(static_cast<size_t>(n_r) * m, big);
+        for (int i = 0; i < n_r; ++i) {
+            std::fill(cost.begin() + static_cast<size_t>(i) * m + n_c,
+                      cost.begin() + static_cast<size_t>(i + 1) * m, max_cost);
+        }
+        for (int k = e_begin; k < e_end; ++k) {
+            const auto& e = edges[cluster_edges[k]];
+            const int i = local_index[e.track];
+            const int j = local_index[n_tracks + e.det];
+            cost[static_cast<size_t>(i) * m + j] = e.cost;
+        }
+
+        solver.solve(cost, n_r, m, row_to_col);
+
+        for (int i = 0; i < n_r; ++i) {
+            const int j = row_to_col[i];
+            if (j >= 0 && j < n_c) {
+                result.track_assignment[rows[i]] = cols[j];
+            }
+        }
+
+        for (int t : rows) local_index[t] = -1;
+        for (int d : cols) local_index[n_tracks + d] = -1;
+    }
+
+    std::pmr::vector<char> det_used(n_dets, 0, mr);
+    result.unassigned_tracks.reserve(n_tracks);
+    result.unassigned_detections.reserve(n_dets);
+    for (int i = 0; i < n_tracks; ++i) {
+        const int j = result.track_assignment[i];
+        if (j >= 0) {
+            det_used[j] = 1;
+        } else {
+            result.unassigned_tracks.push_back(i);
+        }
+    }
+    for (int j = 0; j < n_dets; ++j) {
+        if (!det_used[j]) {
+            result.unassigned_detections.push_back(j);
+        }
+    }
+
+    return result;
+}
+
+} // anonymous namespace
+
+AssociationResult associate_optimal(const std::vector<GateCandidate>& candidates,
+                                    int n_tracks,
+                                    int n_dets,
+                                    double max_cost,
+                                    std::pmr::memory_resource* mr) {
+    return associate_optimal_impl(candidates.data(), candidates.size(),
+                                  n_tracks, n_dets, max_cost, mr);
+}
+
+AssociationResult associate_optimal(const Eigen::Ref<const Eigen::MatrixXd>& cost_matrix,
+                                    double max_cost,
+                                    std::pmr::memory_resource* mr) {
+    const int n_tracks = static_cast<int>(cost_matrix.rows());
+    const int n_dets   = static_cast<int>(cost_matrix.cols());
+
+    std::pmr::vector<GateCandidate> candidates(mr);
+    candidates.reserve((cost_matrix.array() <= max_cost).count());
+    for (int i = 0; i < n_tracks; ++i) {
+        for (int j = 0; j < n_dets; ++j) {
+            const double c = cost_matrix(i, j);
+            if (std::isfinite(c) && c <= max_cost) {
+                candidates.push_back({i, j, c});
+            }
+        }
+    }
+
+    return associate_optimal_impl(candidates.data(), candidates.size(),
+                                  n_tracks, n_dets, max_cost, mr);
+}
+
 } // namespace msf
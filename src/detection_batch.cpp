@@ -0,0 +1,112 @@
+#include "detection_batch.hpp"
+#include "gating.hpp"
+
+#include <cmath>
+
+namespace msf {
+
+void DetectionBatch::clear() {
+    sensor_.clear();
+    dim_.clear();
+    for (auto& col : z_) col.clear();
+    pos_x_.clear();
+    pos_y_.clear();
+    timestamp_.clear();
+    confidence_.clear();
+}
+
+void DetectionBatch::reserve(std::size_t n) {
+    sensor_.reserve(n);
+    dim_.reserve(n);
+    for (auto& col : z_) col.reserve(n);
+    pos_x_.reserve(n);
+    pos_y_.reserve(n);
+    timestamp_.reserve(n);
+    confidence_.reserve(n);
+}
+
+void DetectionBatch::push(SensorType sensor, int dim, double z0, double z1, double z2,
+                          double px, double py, double timestamp, double confidence) {
+    sensor_.push_back(sensor);
+    dim_.push_back(dim);
+    z_[0].push_back(z0);
+    z_[1].push_back(z1);
+    z_[2].push_back(z2);
+    pos_x_.push_back(px);
+    pos_y_.push_back(py);
+    timestamp_.push_back(timestamp);
+    confidence_.push_back(confidence);
+}
+
+void DetectionBatch::resize(std::size_t n) {
+    sensor_.resize(n);
+    dim_.resize(n);
+    for (auto& col : z_) col.resize(n);
+    pos_x_.resize(n);
+    pos_y_.resize(n);
+    timestamp_.resize(n);
+    confidence_.resize(n);
+}
+
+void DetectionBatch::set(std::size_t i, SensorType sensor, int dim, double z0, double z1,
+                         double z2, double px, double py, double timestamp, double confidence) {
+    sensor_[i] = sensor;
+    dim_[i] = dim;
+    z_[0][i] = z0;
+    z_[1][i] = z1;
+    z_[2][i] = z2;
+    pos_x_[i] = px;
+    pos_y_[i] = py;
+    timestamp_[i] = timestamp;
+    confidence_[i] = confidence;
+}
+
+void DetectionBatch::push_back(const Detection& det) {
+    const int dim = static_cast<int>(det.z.size());
+    const Eigen::Vector2d p = detection_position(det);
+    push(det.sensor, dim,
+         dim > 0 ? det.z(0) : 0.0,
+         dim > 1 ? det.z(1) : 0.0,
+         dim > 2 ? det.z(2) : 0.0,
+         p.x(), p.y(), det.timestamp, det.confidence);
+}
+
+void DetectionBatch::push_camera(double x, double y, double timestamp, double confidence) {
+    push(SensorType::Camera, 2, x, y, 0.0, x, y, timestamp, confidence);
+}
+
+void DetectionBatch::push_radar(double r, double phi, double vr,
+                                double timestamp, double confidence) {
+    push(SensorType::Radar, 3, r, phi, vr,
+         r * std::cos(phi), r * std::sin(phi), timestamp, confidence);
+}
+
+void DetectionBatch::set_camera(std::size_t i, double x, double y, double timestamp,
+                                double confidence) {
+    set(i, SensorType::Camera, 2, x, y, 0.0, x, y, timestamp, confidence);
+}
+
+void DetectionBatch::set_radar(std::size_t i, double r, double phi, double vr,
+                               double timestamp, double confidence) {
+    set(i, SensorType::Radar, 3, r, phi, vr,
+        r * std::cos(phi), r * std::sin(phi), timestamp, confidence);
+}
+
+MeasVec DetectionBatch::meas(std::size_t i) const {
+    MeasVec z(dim_[i]);
+    for (int k = 0; k < dim_[i]; ++k) {
+        z(k) = z_[k][i];
+    }
+    return z;
+}
+
+Detection DetectionBatch::at(std::size_t i) const {
+    Detection det;
+    det.sensor = sensor_[i];
+    det.z = meas(i);
+    det.timestamp = timestamp_[i];
+    det.confidence = confidence_[i];
+    return det;
+}
+
+} // namespace msf
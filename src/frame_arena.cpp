@@ -0,0 +1,51 @@
+#include "frame_arena.hpp"
+
+#include <algorithm>
+
+namespace msf {
+
+FrameArena::FrameArena(std::size_t initial_bytes) {
+    if (initial_bytes > 0) {
+        buffer_ = std::make_unique<std::byte[]>(initial_bytes);
+        capacity_ = initial_bytes;
+    }
+    // overflow block 목록이 reset 때마다 새로 할당되지 않도록
+    overflow_.reserve(16);
+}
+
+void FrameArena::reset() {
+    high_water_ = std::max(high_water_, used());
+
+    if (!overflow_.empty()) {
+        // 다음 프레임이 한 block 에 들어가도록 여유를 두고 확장
+        const std::size_t need = used() + used() / 2;
+        overflow_.clear();
+        buffer_ = std::make_unique<std::byte[]>(need);
+        capacity_ = need;
+    }
+    offset_ = 0;
+    overflow_bytes_ = 0;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // 주 buffer 에서 bump
+    if (buffer_) {
+        const auto base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+        const std::uintptr_t p = (base + offset_ + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        const std::size_t end = static_cast<std::size_t>(p - base) + bytes;
+        if (end <= capacity_) {
+            offset_ = end;
+            return reinterpret_cast<void*>(p);
+        }
+    }
+
+    // 모자라면 heap block 하나를 따로 받는다 (정렬 여유 포함)
+    overflow_.push_back(std::make_unique<std::byte[]>(bytes + alignment));
+    overflow_bytes_ += bytes + alignment;
+    ++overflow_count_;
+    const auto base = reinterpret_cast<std::uintptr_t>(overflow_.back().get());
+    const std::uintptr_t p = (base + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+    return reinterpret_cast<void*>(p);
+}
+
+} // namespace msf
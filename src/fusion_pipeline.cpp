@@ -0,0 +1,156 @@
+#include "fusion_pipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace msf {
+
+FusionPipeline::FusionPipeline(const TrackerParams& tracker_params,
+                               const PipelineParams& params)
+    : params_(params),
+      oosm_(tracker_params.oosm_history_size > 0),
+      tracker_(tracker_params) {
+    for (int s = 0; s < kNumSensors; ++s) {
+        queues_[s] = std::make_unique<SpscQueue<Detection>>(params_.queue_capacity);
+        dropped_full_[s].store(0);
+    }
+    pending_.reserve(params_.queue_capacity);
+}
+
+FusionPipeline::~FusionPipeline() {
+    stop();
+}
+
+void FusionPipeline::start() {
+    if (running_) {
+        return;
+    }
+    stop_.store(false, std::memory_order_relaxed);
+    running_ = true;
+    thread_ = std::thread([this] { run(); });
+}
+
+void FusionPipeline::stop() {
+    if (!running_) {
+        return;
+    }
+    stop_.store(true, std::memory_order_release);
+    thread_.join();
+    running_ = false;
+}
+
+bool FusionPipeline::push(const Detection& det) {
+    const int s = static_cast<int>(det.sensor);
+    if (!queues_[s]->try_push(det)) {
+        dropped_full_[s].fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+const TrackSnapshot& FusionPipeline::snapshot() {
+    if (middle_.load(std::memory_order_relaxed) & kFresh) {
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & ~kFresh;
+    }
+    return snapshots_[front_];
+}
+
+PipelineStats FusionPipeline::stats() const {
+    PipelineStats s;
+    s.cycles = cycles_.load(std::memory_order_relaxed);
+    s.processed = processed_.load(std::memory_order_relaxed);
+    s.dropped_late = dropped_late_.load(std::memory_order_relaxed);
+    for (int k = 0; k < kNumSensors; ++k) {
+        s.dropped_full += dropped_full_[k].load(std::memory_order_relaxed);
+    }
+    return s;
+}
+
+void FusionPipeline::run() {
+    for (;;) {
+        // stop 플래그를 먼저 읽어야 그 이전에 push 된 detection 을 모두 drain 할 수 있다
+        const bool stopping = stop_.load(std::memory_order_acquire);
+        const bool got = drain();
+        process(stopping);
+        if (stopping) {
+            return;
+        }
+        if (!got) {
+            std::this_thread::sleep_for(std::chrono::microseconds(params_.idle_sleep_us));
+        }
+    }
+}
+
+bool FusionPipeline::drain() {
+    bool got = false;
+    Pending p;
+    for (int s = 0; s < kNumSensors; ++s) {
+        while (queues_[s]->try_pop(p.det)) {
+            p.seq = next_seq_++;
+            newest_seen_ = std::max(newest_seen_, p.det.timestamp);
+            pending_.push_back(p);
+            got = true;
+        }
+    }
+    return got;
+}
+
+void FusionPipeline::process(bool flush) {
+    if (pending_.empty()) {
+        return;
+    }
+
+    // (timestamp, sensor, 센서 내 도착 순서) 로 정렬
+    // → 센서 스레드 간 도착 타이밍과 무관하게 같은 입력이면 같은 처리 순서
+    std::sort(pending_.begin(), pending_.end(),
+              [](const Pending& a, const Pending& b) {
+                  if (a.det.timestamp != b.det.timestamp) return a.det.timestamp < b.det.timestamp;
+                  if (a.det.sensor != b.det.sensor) return a.det.sensor < b.det.sensor;
+                  return a.seq < b.seq;
+              });
+
+    const double release = newest_seen_ - params_.latency_window;
+    size_t i = 0;
+    while (i < pending_.size() && (flush || pending_[i].det.timestamp <= release)) {
+        const double t0 = pending_[i].det.timestamp;
+
+        // 이미 처리한 cycle 보다 오래된 detection
+        if (any_cycle_ && t0 < last_cycle_time_ && !oosm_) {
+            dropped_late_.fetch_add(1, std::memory_order_relaxed);
+            ++i;
+            continue;
+        }
+
+        // [t0, t0 + cycle_period] 구간을 한 cycle 로 묶음
+        batch_.clear();
+        double t_cycle = t0;
+        while (i < pending_.size() &&
+               (flush || pending_[i].det.timestamp <= release) &&
+               pending_[i].det.timestamp <= t0 + params_.cycle_period) {
+            batch_.push_back(pending_[i].det);
+            t_cycle = pending_[i].det.timestamp;
+            ++i;
+        }
+
+        tracker_.predict(t_cycle);
+        tracker_.update(batch_);
+        processed_.fetch_add(batch_.size(), std::memory_order_relaxed);
+
+        if (!any_cycle_ || t_cycle > last_cycle_time_) {
+            last_cycle_time_ = t_cycle;
+        }
+        any_cycle_ = true;
+        publish(last_cycle_time_);
+    }
+    pending_.erase(pending_.begin(), pending_.begin() + i);
+}
+
+void FusionPipeline::publish(double timestamp) {
+    TrackSnapshot& s = snapshots_[back_];
+    s.cycle = cycles_.fetch_add(1, std::memory_order_relaxed) + 1;
+    s.timestamp = timestamp;
+    s.tracks = tracker_.get_tracks();
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & ~kFresh;
+}
+
+} // namespace msf
@@ -0,0 +1,166 @@
+#include "gating.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace msf {
+
+Eigen::Vector2d detection_position(const Detection& det) {
+    Eigen::Vector2d p;
+    if (det.sensor == SensorType::Radar && det.z.size() >= 3) {
+        const double r = det.z(0);
+        const double phi = det.z(1);
+        p << r * std::cos(phi), r * std::sin(phi);
+    } else if (det.z.size() >= 2) {
+        p << det.z(0), det.z(1);
+    } else {
+        p.setZero();
+    }
+    return p;
+}
+
+namespace {
+
+// 크기 n 이 capacity 를 넘으면 50% 여유를 두고 확보
+void reserve_with_headroom(std::vector<int>& v, size_t n) {
+    if (n > v.capacity()) {
+        v.reserve(n + n / 2);
+    }
+}
+
+} // anonymous namespace
+
+SpatialGrid::SpatialGrid(double cell_size)
+    : base_cell_size_(cell_size > 0.0 ? cell_size : 1.0),
+      cell_size_(base_cell_size_) {}
+
+void SpatialGrid::build(const std::vector<Eigen::Vector2d>& points) {
+    const int n = static_cast<int>(points.size());
+    cell_size_ = base_cell_size_;
+    nx_ = 0;
+    ny_ = 0;
+    cell_start_.clear();
+    cell_points_.clear();
+
+    if (n == 0) {
+        return;
+    }
+
+    // NaN / inf 점은 범위 계산과 격자에서 빼서 어느 질의에도 나오지 않게 한다
+    // (범위가 NaN / inf 가 되면 아래의 셀 크기 조정이 끝나지 않는다)
+    int n_finite = 0;
+    double max_x = 0.0;
+    double max_y = 0.0;
+    for (const auto& p : points) {
+        if (!std::isfinite(p.x()) || !std::isfinite(p.y())) {
+            continue;
+        }
+        if (n_finite++ == 0) {
+            min_x_ = max_x = p.x();
+            min_y_ = max_y = p.y();
+        }
+        min_x_ = std::min(min_x_, p.x());
+        min_y_ = std::min(min_y_, p.y());
+        max_x = std::max(max_x, p.x());
+        max_y = std::max(max_y, p.y());
+    }
+    if (n_finite == 0) {
+        return;
+    }
+
+    // 셀 개수를 점 개수에 비례하도록 제한 (희소한 넓은 영역에서 메모리 폭주 방지)
+    // 범위 자체가 double 을 넘으면 (max - min = inf) 줄지 않으므로 정해진 횟수 뒤에는
+    // 크기 inf 인 셀 하나로 둔다 (모든 질의가 그 셀을 본다)
+    const double max_cells = 4.0 * n + 1024.0;
+    constexpr int kMaxDoublings = 64;
+    for (int k = 0;; ++k) {
+        const double cx = std::floor((max_x - min_x_) / cell_size_) + 1.0;
+        const double cy = std::floor((max_y - min_y_) / cell_size_) + 1.0;
+        if (cx * cy <= max_cells) {
+            nx_ = static_cast<int>(cx);
+            ny_ = static_cast<int>(cy);
+            break;
+        }
+        if (k == kMaxDoublings) {
+            cell_size_ = std::numeric_limits<double>::infinity();
+            nx_ = 1;
+            ny_ = 1;
+            break;
+        }
+        cell_size_ *= 2.0;
+    }
+
+    // counting sort 로 CSR 구성
+    // 점 수는 프레임마다 조금씩 변하므로 모자랄 때 여유를 두고 늘려
+    // 몇 프레임 뒤에는 재할당이 없게 한다 (assign / resize 는 필요한 만큼만 잡는다)
+    // 셀 수 상한(max_cells)은 점 수로만 정해지므로 셀 배열도 그 기준으로 확보
+    const size_t n_cells = static_cast<size_t>(nx_) * ny_;
+    reserve_with_headroom(cell_start_, static_cast<size_t>(max_cells) + 1);
+    reserve_with_headroom(cell_fill_, static_cast<size_t>(max_cells));
+    reserve_with_headroom(point_cell_, n);
+    reserve_with_headroom(cell_points_, n);
+
+    cell_start_.assign(n_cells + 1, 0);
+    point_cell_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        if (!std::isfinite(points[i].x()) || !std::isfinite(points[i].y())) {
+            point_cell_[i] = -1;
+            continue;
+        }
+        // 셀 하나로 둔 경우 몫이 inf / NaN 일 수 있으므로 int 변환 전에 마지막 셀로 자른다
+        const double fx = (points[i].x() - min_x_) / cell_size_;
+        const double fy = (points[i].y() - min_y_) / cell_size_;
+        const int ix = fx < nx_ - 1 ? static_cast<int>(fx) : nx_ - 1;
+        const int iy = fy < ny_ - 1 ? static_cast<int>(fy) : ny_ - 1;
+        const int c = iy * nx_ + ix;
+        point_cell_[i] = c;
+        cell_start_[c + 1] += 1;
+    }
+    for (size_t c = 1; c < cell_start_.size(); ++c) {
+        cell_start_[c] += cell_start_[c - 1];
+    }
+
+    cell_points_.resize(n_finite);
+    cell_fill_.assign(cell_start_.begin(), cell_start_.end() - 1);
+    for (int i = 0; i < n; ++i) {
+        if (point_cell_[i] >= 0) {
+            cell_points_[cell_fill_[point_cell_[i]]++] = i;
+        }
+    }
+}
+
+void SpatialGrid::query(double cx, double cy, double radius,
+                        std::vector<int>& out) const {
+    if (nx_ == 0 || ny_ == 0 || !std::isfinite(cx) || !std::isfinite(cy)) {
+        return;
+    }
+
+    const double x0 = (cx - radius - min_x_) / cell_size_;
+    const double x1 = (cx + radius - min_x_) / cell_size_;
+    const double y0 = (cy - radius - min_y_) / cell_size_;
+    const double y1 = (cy + radius - min_y_) / cell_size_;
+
+    // 격자 범위를 완전히 벗어나면 후보 없음
+    if (x1 < 0.0 || y1 < 0.0 || x0 >= nx_ || y0 >= ny_) {
+        return;
+    }
+
+    // int 로 바꾸기 전에 격자 범위로 자른다 (격자가 아주 넓으면 몫이 int 를 넘을 수 있음)
+    const int ix0 = static_cast<int>(std::max(0.0, std::floor(x0)));
+    const int ix1 = static_cast<int>(std::min(nx_ - 1.0, std::floor(x1)));
+    const int iy0 = static_cast<int>(std::max(0.0, std::floor(y0)));
+    const int iy1 = static_cast<int>(std::min(ny_ - 1.0, std::floor(y1)));
+
+    for (int iy = iy0; iy <= iy1; ++iy) {
+        const int row = iy * nx_;
+        for (int ix = ix0; ix <= ix1; ++ix) {
+            const int c = row + ix;
+            for (int k = cell_start_[c]; k < cell_start_[c + 1]; ++k) {
+                out.push_back(cell_points_[k]);
+            }
+        }
+    }
+}
+
+} // namespace msf
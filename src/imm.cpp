@@ -0,0 +1,411 @@
+#include "imm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "kalman_filter.hpp"
+#include "sensor_models.hpp"
+
+namespace msf {
+
+namespace {
+
+using namespace imm_state;
+using ImmFilter = KalmanFilter<kDim>;
+
+constexpr double kLog2Pi = 1.83787706640934548356;
+
+// 새 track 의 가속도 / 회전율 초기 표준편차
+constexpr double kInitAccelStd = 3.0;       // [m/s^2]
+constexpr double kInitTurnRateStd = 0.3;    // [rad/s]
+
+// 새 track 의 모델 확률 (CV, CA, CT)
+const Eigen::Vector3d kInitProb(0.8, 0.1, 0.1);
+
+// 위치 / 속도 축마다 이산 white acceleration Q (make_process_noise 와 같은 식)
+void add_white_accel(ImmMat& Q, double dt, double sigma) {
+    const double q = sigma * sigma;
+    const double dt2 = dt * dt;
+    for (int a = 0; a < 2; ++a) {
+        const int p = X + a, v = VX + a;
+        Q(p, p) += q * dt2 * dt2 / 4.0;
+        Q(p, v) += q * dt2 * dt / 2.0;
+        Q(v, p) += q * dt2 * dt / 2.0;
+        Q(v, v) += q * dt2;
+    }
+}
+
+// coordinated turn: 상태 전이와 Jacobian (omega -> 0 극한은 테일러 전개)
+void predict_ct(ImmVec& x, ImmMat& P, double dt, const ImmMat& Q) {
+    const double w = x(OMEGA);
+    const double vx = x(VX), vy = x(VY);
+    const double wt = w * dt;
+    const double s = std::sin(wt), c = std::cos(wt);
+
+    double a, b, da, db;   // a = sin(wT)/w, b = (1 - cos(wT))/w 와 omega 미분
+    if (std::fabs(w) > 1e-6) {
+        a = s / w;
+        b = (1.0 - c) / w;
+        da = (dt * c - a) / w;
+        db = (dt * s - b) / w;
+    } else {
+        a = dt;
+        b = 0.5 * wt * dt;
+        da = -wt * dt * dt / 3.0;
+        db = 0.5 * dt * dt;
+    }
+
+    ImmMat F = ImmMat::Zero();
+    F(X, X) = 1.0;
+    F(X, VX) = a;
+    F(X, VY) = -b;
+    F(X, OMEGA) = vx * da - vy * db;
+    F(Y, Y) = 1.0;
+    F(Y, VX) = b;
+    F(Y, VY) = a;
+    F(Y, OMEGA) = vx * db + vy * da;
+    F(VX, VX) = c;
+    F(VX, VY) = -s;
+    F(VX, OMEGA) = -dt * (s * vx + c * vy);
+    F(VY, VX) = s;
+    F(VY, VY) = c;
+    F(VY, OMEGA) = dt * (c * vx - s * vy);
+    F(OMEGA, OMEGA) = 1.0;
+
+    ImmVec xn = ImmVec::Zero();
+    xn(X) = x(X) + a * vx - b * vy;
+    xn(Y) = x(Y) + b * vx + a * vy;
+    xn(VX) = c * vx - s * vy;
+    xn(VY) = s * vx + c * vy;
+    xn(OMEGA) = w;
+
+    x = xn;
+    P = F * P * F.transpose() + Q;
+}
+
+// 모델 하나의 EKF update, 반환값은 측정 log-likelihood (S 분해 실패 시 -inf, 상태 변경 없음)
+template <int MeasDim>
+double update_model(ImmVec& x, ImmMat& P,
+                    const Eigen::Matrix<double, MeasDim, 1>& y,
+                    const Eigen::Matrix<double, MeasDim, 4>& H4,
+                    const Eigen::Matrix<double, MeasDim, MeasDim>& R) {
+    Eigen::Matrix<double, MeasDim, kDim> H = Eigen::Matrix<double, MeasDim, kDim>::Zero();
+    H.template leftCols<4>() = H4;
+
+    // H 의 0 이 아닌 열은 앞 4 개뿐
+    const Eigen::Matrix<double, kDim, MeasDim> PHt = P.template leftCols<4>() * H4.transpose();
+    const Eigen::Matrix<double, MeasDim, MeasDim> S = H4 * PHt.template topRows<4>() + R;
+    const Eigen::LDLT<Eigen::Matrix<double, MeasDim, MeasDim>> ldlt(S);
+    if (ldlt.info() != Eigen::Success || !ldlt.isPositive()) {
+        return -std::numeric_limits<double>::infinity();
+    }
+
+    const double d2 = y.dot(ldlt.solve(y));
+    const double log_det = ldlt.vectorD().array().log().sum();
+    ImmFilter::update_factored<MeasDim>(x, P, y, H, PHt, ldlt, R);
+    return -0.5 * (d2 + log_det + MeasDim * kLog2Pi);
+}
+
+} // anonymous namespace
+
+ImmFilterBank::ImmFilterBank(const TrackerParams& params)
+    : sigma_cv_(params.process_noise_std),
+      sigma_jerk_(params.imm_accel_noise_std),
+      sigma_turn_rate_(params.imm_turn_rate_noise_std) {
+    const double p = std::clamp(params.imm_switch_prob, 0.0, 1.0);
+    trans_.setConstant(0.5 * p);
+    trans_.diagonal().setConstant(1.0 - p);
+}
+
+void ImmFilterBank::reserve(std::size_t n) {
+    for (int m = 0; m < kImmModels; ++m) {
+        x_[m].reserve(n);
+        P_[m].reserve(n);
+    }
+    mu_.reserve(n);
+    for (auto* v : {&rad_px_, &rad_py_, &rad_vx_, &rad_vy_}) {
+        v->reserve(kImmModels * n);
+    }
+    rad_pred_.reserve(kImmModels * n);
+}
+
+void ImmFilterBank::push_back(const Vec4& x, const Mat4& P) {
+    ImmVec xe = ImmVec::Zero();
+    xe.head<4>() = x;
+    ImmMat Pe = ImmMat::Zero();
+    Pe.topLeftCorner<4, 4>() = P;
+    Pe(AX, AX) = Pe(AY, AY) = kInitAccelStd * kInitAccelStd;
+    Pe(OMEGA, OMEGA) = kInitTurnRateStd * kInitTurnRateStd;
+
+    for (int m = 0; m < kImmModels; ++m) {
+        x_[m].push_back(xe);
+        P_[m].push_back(Pe);
+    }
+    mu_.push_back(kInitProb);
+
+    const std::size_t n = kImmModels * size();
+    for (auto* v : {&rad_px_, &rad_py_, &rad_vx_, &rad_vy_}) {
+        v->resize(n);
+    }
+    rad_pred_.resize(n);
+}
+
+void ImmFilterBank::compact(const std::vector<char>& keep) {
+    const std::size_t n = size();
+    std::size_t w = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!keep[i]) continue;
+        if (w != i) {
+            for (int m = 0; m < kImmModels; ++m) {
+                x_[m][w] = x_[m][i];
+                P_[m][w] = P_[m][i];
+            }
+            mu_[w] = mu_[i];
+        }
+        ++w;
+    }
+    for (int m = 0; m < kImmModels; ++m) {
+        x_[m].resize(w);
+        P_[m].resize(w);
+    }
+    mu_.resize(w);
+    for (auto* v : {&rad_px_, &rad_py_, &rad_vx_, &rad_vy_}) {
+        v->resize(kImmModels * w);
+    }
+    rad_pred_.resize(kImmModels * w);
+}
+
+void ImmFilterBank::build_matrices(double dt, ModelMatrices& m) const {
+    m.dt = dt;
+    const double dt2 = dt * dt;
+
+    // CV: a, omega 는 0 으로
+    m.F_cv.setZero();
+    m.F_cv(X, X) = m.F_cv(Y, Y) = m.F_cv(VX, VX) = m.F_cv(VY, VY) = 1.0;
+    m.F_cv(X, VX) = m.F_cv(Y, VY) = dt;
+    m.Q_cv.setZero();
+    add_white_accel(m.Q_cv, dt, sigma_cv_);
+
+    // CA: omega 는 0 으로, 축마다 white jerk Q
+    m.F_ca = m.F_cv;
+    m.F_ca(AX, AX) = m.F_ca(AY, AY) = 1.0;
+    m.F_ca(X, AX) = m.F_ca(Y, AY) = 0.5 * dt2;
+    m.F_ca(VX, AX) = m.F_ca(VY, AY) = dt;
+    m.Q_ca.setZero();
+    const double q = sigma_jerk_ * sigma_jerk_;
+    for (int a = 0; a < 2; ++a) {
+        const int idx[3] = {X + a, VX + a, AX + a};
+        const double k[3][3] = {
+            {dt2 * dt2 * dt / 20.0, dt2 * dt2 / 8.0, dt2 * dt / 6.0},
+            {dt2 * dt2 / 8.0,       dt2 * dt / 3.0,  dt2 / 2.0},
+            {dt2 * dt / 6.0,        dt2 / 2.0,       dt},
+        };
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                m.Q_ca(idx[r], idx[c]) = q * k[r][c];
+            }
+        }
+    }
+
+    // CT: 위치 / 속도는 CV 와 같은 white acceleration, omega 는 random walk
+    m.Q_ct = m.Q_cv;
+    m.Q_ct(OMEGA, OMEGA) = sigma_turn_rate_ * sigma_turn_rate_ * dt;
+}
+
+void ImmFilterBank::mix(std::size_t i, std::array<ImmVec, kImmModels>& x0,
+                        std::array<ImmMat, kImmModels>& P0) {
+    const Eigen::Vector3d& mu = mu_[i];
+    const Eigen::Vector3d c = trans_.transpose() * mu;   // 예측 모델 확률
+
+    // P0_j = sum_i w_ij (P_i + (x_i - x0_j)(x_i - x0_j)^T)
+    //      = sum_i w_ij M_i - e_j e_j^T,   M_i = P_i + d_i d_i^T,  d_i = x_i - xbar,  e_j = x0_j - xbar
+    // M_i 를 한 번씩만 만들어 세 목적 모델이 같이 쓴다 (외적 9 번 → 3 번)
+    ImmVec xbar = ImmVec::Zero();
+    for (int m = 0; m < kImmModels; ++m) {
+        xbar.noalias() += mu(m) * x_[m][i];
+    }
+    std::array<ImmVec, kImmModels> d;
+    std::array<ImmMat, kImmModels> M;
+    for (int m = 0; m < kImmModels; ++m) {
+        d[m] = x_[m][i] - xbar;
+        M[m] = P_[m][i];
+        M[m].noalias() += d[m] * d[m].transpose();
+    }
+
+    for (int j = 0; j < kImmModels; ++j) {
+        ImmVec e = ImmVec::Zero();
+        P0[j].setZero();
+        for (int m = 0; m < kImmModels; ++m) {
+            const double w = c(j) > 0.0 ? trans_(m, j) * mu(m) / c(j) : (m == j ? 1.0 : 0.0);
+            e.noalias() += w * d[m];
+            P0[j].noalias() += w * M[m];
+        }
+        x0[j] = xbar + e;
+        P0[j].noalias() -= e * e.transpose();
+    }
+    mu_[i] = c;
+}
+
+void ImmFilterBank::combine(std::size_t i, Vec4& x, Mat4& P) const {
+    const Eigen::Vector3d& mu = mu_[i];
+    x.setZero();
+    for (int m = 0; m < kImmModels; ++m) {
+        x.noalias() += mu(m) * x_[m][i].head<4>();
+    }
+    P.setZero();
+    for (int m = 0; m < kImmModels; ++m) {
+        const Vec4 d = x_[m][i].head<4>() - x;
+        P.noalias() += mu(m) * (P_[m][i].topLeftCorner<4, 4>() + d * d.transpose());
+    }
+}
+
+void ImmFilterBank::predict(TrackState* tracks, std::size_t begin, std::size_t end,
+                            double timestamp) {
+    ModelMatrices mats;
+    std::array<ImmVec, kImmModels> x0;
+    std::array<ImmMat, kImmModels> P0;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        auto& track = tracks[i];
+        double dt = track.last_timestamp > 0.0 ? timestamp - track.last_timestamp : 0.0;
+        if (dt <= 0.0) {
+            dt = 1e-3;
+        }
+        if (dt != mats.dt) {
+            build_matrices(dt, mats);
+        }
+
+        mix(i, x0, P0);
+
+        const int cv = static_cast<int>(ImmModel::CV);
+        const int ca = static_cast<int>(ImmModel::CA);
+        const int ct = static_cast<int>(ImmModel::CT);
+        x_[cv][i] = x0[cv];
+        P_[cv][i] = P0[cv];
+        ImmFilter::predict(x_[cv][i], P_[cv][i], mats.F_cv, mats.Q_cv);
+        x_[ca][i] = x0[ca];
+        P_[ca][i] = P0[ca];
+        ImmFilter::predict(x_[ca][i], P_[ca][i], mats.F_ca, mats.Q_ca);
+        x_[ct][i] = x0[ct];
+        P_[ct][i] = P0[ct];
+        predict_ct(x_[ct][i], P_[ct][i], dt, mats.Q_ct);
+
+        combine(i, track.x, track.P);
+    }
+}
+
+void ImmFilterBank::update(TrackState* tracks, std::size_t begin, std::size_t end,
+                           const int* assignment, const DetectionBatch& detections,
+                           const Eigen::Matrix2d& R_cam, const Eigen::Matrix3d& R_rad) {
+    // 구간에 radar 매칭이 있으면 모든 (track, 모델) 의 h(x), H 를 batch kernel 한 번으로
+    bool has_radar = false;
+    for (std::size_t i = begin; i < end && !has_radar; ++i) {
+        has_radar = assignment[i] >= 0 && detections.sensor(assignment[i]) == SensorType::Radar;
+    }
+    if (has_radar) {
+        for (std::size_t i = begin; i < end; ++i) {
+            for (int m = 0; m < kImmModels; ++m) {
+                const std::size_t k = kImmModels * i + m;
+                rad_px_[k] = x_[m][i](X);
+                rad_py_[k] = x_[m][i](Y);
+                rad_vx_[k] = x_[m][i](VX);
+                rad_vy_[k] = x_[m][i](VY);
+            }
+        }
+        radar_predict_batch(rad_px_.data(), rad_py_.data(), rad_vx_.data(), rad_vy_.data(),
+                            kImmModels * begin, kImmModels * end, rad_pred_);
+    }
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const int j = assignment[i];
+        if (j < 0) continue;
+
+        Eigen::Vector3d log_l;
+        for (int m = 0; m < kImmModels; ++m) {
+            if (detections.sensor(j) == SensorType::Camera) {
+                const Eigen::Vector2d y = detections.camera_z(j) - x_[m][i].head<2>();
+                log_l(m) = update_model<2>(x_[m][i], P_[m][i], y, camera_H(), R_cam);
+            } else {
+                const std::size_t k = kImmModels * i + m;
+                Eigen::Vector3d y = detections.radar_z(j) - rad_pred_.z(k);
+                y(1) = normalize_angle(y(1));
+                log_l(m) = update_model<3>(x_[m][i], P_[m][i], y, rad_pred_.H(k), R_rad);
+            }
+        }
+
+        reweight(i, log_l);
+        combine(i, tracks[i].x, tracks[i].P);
+    }
+}
+
+void ImmFilterBank::reweight(std::size_t i, const Eigen::Vector3d& log_l) {
+    // mu_j ∝ c_j L_j (log 영역에서 최대값을 빼서 underflow 방지)
+    const double max_l = log_l.maxCoeff();
+    if (std::isfinite(max_l)) {
+        Eigen::Vector3d w = mu_[i].array() * (log_l.array() - max_l).exp();
+        const double sum = w.sum();
+        if (sum > 0.0) {
+            mu_[i] = w / sum;
+        }
+    }
+}
+
+void ImmFilterBank::update_information(std::size_t i, const Mat4& J, const Vec4& info,
+                                       Vec4& x, Mat4& P) {
+    // likelihood 의 2 차식은 결합 평균 기준으로 계산 (큰 좌표값끼리의 상쇄 방지, 모델 공통 상수는 무시)
+    Vec4 ref = Vec4::Zero();
+    for (int m = 0; m < kImmModels; ++m) {
+        ref.noalias() += mu_[i](m) * x_[m][i].head<4>();
+    }
+    const Vec4 info_ref = info - J * ref;
+
+    Eigen::Vector3d log_l;
+    for (int m = 0; m < kImmModels; ++m) {
+        ImmVec& xm = x_[m][i];
+        ImmMat& Pm = P_[m][i];
+        const Vec4 d = xm.head<4>() - ref;
+
+        // H = [I 0] 이므로 A = P H^T 는 P 의 앞 4 열, B = H P H^T 는 왼쪽 위 4x4.
+        // (P^-1 + H^T J H)^-1 를 Woodbury 로 (J 가 특이해도 된다):
+        //   x' = x + A (I + J B)^-1 (info - J x4),   P' = P - A (I + J B)^-1 J A^T
+        const Eigen::Matrix<double, kDim, 4> A = Pm.leftCols<4>();
+        const Eigen::PartialPivLU<Mat4> lu(Mat4::Identity() + J * A.topRows<4>());
+        const Vec4 w = info_ref - J * d;
+        xm.noalias() += A * lu.solve(w);
+        Pm.noalias() -= A * lu.solve(J * A.transpose());
+        Pm = (0.5 * (Pm + Pm.transpose())).eval();
+
+        // N(s; x4, B) 와 정보형 likelihood 의 적분:
+        //   log L = -log det(I + J B) / 2 + (w^T B' w + 2 info^T x4 - x4^T J x4) / 2   (B' = 갱신 후 B)
+        // J 가 양의 준정부호면 det(I + J B) >= 1
+        log_l(m) = 0.5 * (w.dot(Pm.topLeftCorner<4, 4>() * w) + 2.0 * info_ref.dot(d) -
+                          d.dot(J * d)) -
+                   0.5 * std::log(lu.determinant());
+    }
+
+    reweight(i, log_l);
+    combine(i, x, P);
+}
+
+void ImmFilterBank::apply_correction(std::size_t i, const Vec4& x_prior, const Mat4& P_prior,
+                                     Vec4& x, Mat4& P) {
+    // 보정량을 모델에 그대로 더하면 결합 공분산의 모델 간 퍼짐 항까지 빼게 되어 모델 공분산이
+    // 양의 정부호가 아니게 될 수 있다. 대신 보정이 준 정보를 pseudo-measurement 로 보고 모델마다 update:
+    //   J = P^-1 - P_prior^-1,  info = J x_prior + P^-1 (x - x_prior)
+    // 혼합 (JPDA) 이나 CI 처럼 공분산이 커지는 방향은 정보가 음수이므로 고유값을 0 으로 자른다
+    const Eigen::LDLT<Mat4> prior(P_prior);
+    const Eigen::LDLT<Mat4> post(P);
+    if (prior.info() != Eigen::Success || !prior.isPositive() ||
+        post.info() != Eigen::Success || !post.isPositive()) {
+        combine(i, x, P);
+        return;
+    }
+    const Mat4 J_raw = post.solve(Mat4::Identity()) - prior.solve(Mat4::Identity());
+    const Eigen::SelfAdjointEigenSolver<Mat4> es(0.5 * (J_raw + J_raw.transpose()));
+    const Mat4 J = es.eigenvectors() * es.eigenvalues().cwiseMax(0.0).asDiagonal() *
+                   es.eigenvectors().transpose();
+    const Vec4 info = J * x_prior + post.solve(x - x_prior);
+    update_information(i, J, info, x, P);
+}
+
+} // namespace msf
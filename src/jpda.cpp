@@ -0,0 +1,415 @@
+#include "jpda.hpp"
+#include "lap_solver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace msf {
+
+namespace {
+
+enum : char { kExact = 0, kKBest = 1, kApproximate = 2 };
+
+} // anonymous namespace
+
+// cluster 하나를 행 (track) 별 후보 목록으로 본 것 (worker arena 에 있음)
+struct JpdaSolver::ClusterView {
+    int n_rows{0};
+    int n_cols{0};
+    const int* rows{nullptr};        // 행 → 전역 track index
+    const int* row_start{nullptr};   // 행 r 의 후보는 edges[row_start[r], row_start[r + 1])
+    const int* edges{nullptr};       // 후보 index
+    const int* edge_col{nullptr};    // edges 와 같은 순서의 열 번호
+};
+
+void JpdaSolver::solve(const std::vector<GateCandidate>& candidates,
+                       const std::vector<double>& likelihood,
+                       int n_tracks, int n_dets, double detection_prob,
+                       int max_events, int k_best_max_tracks, ThreadPool& pool) {
+    const int n_cand = static_cast<int>(candidates.size());
+    candidates_ = candidates.data();
+    likelihood_ = likelihood.data();
+    n_tracks_ = n_tracks;
+    miss_weight_ = std::max(1.0 - detection_prob, 1e-9);
+    max_events_ = std::max(1, max_events);
+    k_best_max_tracks_ = k_best_max_tracks;
+
+    const int n_nodes = n_tracks + n_dets;
+    clusters_.reserve(n_nodes, n_cand);
+    reserve_for(local_index_, n_nodes);
+    reserve_for(cluster_events_, n_cand);
+    reserve_for(cluster_method_, n_cand);
+    reserve_for(cluster_tracks_, n_cand);
+    reserve_for(beta_, n_cand);
+    reserve_for(beta_miss_, n_tracks);
+
+    beta_.assign(n_cand, 0.0);
+    beta_miss_.assign(n_tracks, 1.0);
+    stats_ = JpdaStats{};
+
+    // 후보 그래프의 연결 요소 (cluster 수는 후보 수 이하)
+    clusters_.reset(n_nodes);
+    for (int k = 0; k < n_cand; ++k) {
+        clusters_.unite(candidates[k].track, n_tracks + candidates[k].det);
+    }
+    const int n_clusters =
+        clusters_.build(n_cand, [&](int k) { return candidates[k].track; });
+    local_index_.assign(n_nodes, -1);
+
+    cluster_events_.assign(n_clusters, 0);
+    cluster_method_.assign(n_clusters, kExact);
+    cluster_tracks_.assign(n_clusters, 0);
+
+    while (static_cast<int>(arenas_.size()) < pool.size()) {
+        arenas_.push_back(std::make_unique<FrameArena>(256 * 1024));
+    }
+
+    // cluster 는 서로 다른 후보 / track 칸에만 쓰므로 동적 분배해도 결과는 같다
+    for_each_cluster_chunk(pool, n_clusters, [&](int c0, int c1, int worker) {
+        FrameArena& arena = *arenas_[worker];
+        for (int c = c0; c < c1; ++c) {
+            solve_cluster(c, arena);
+        }
+    });
+
+    stats_.clusters = n_clusters;
+    for (int c = 0; c < n_clusters; ++c) {
+        stats_.events += cluster_events_[c];
+        stats_.max_cluster_tracks = std::max(stats_.max_cluster_tracks, cluster_tracks_[c]);
+        switch (cluster_method_[c]) {
+        case kExact: ++stats_.exact; break;
+        case kKBest: ++stats_.k_best; break;
+        default: ++stats_.approximate; break;
+        }
+    }
+}
+
+void JpdaSolver::solve_cluster(int c, FrameArena& arena) {
+    arena.reset();
+
+    // cluster 안의 행 (track) / 열 (detection) 번호 매기기
+    const int e_begin = clusters_.start[c];
+    const int e_end = clusters_.start[c + 1];
+    const int n_edges = e_end - e_begin;
+    std::pmr::vector<int> rows(&arena);
+    std::pmr::vector<int> edge_row(n_edges, 0, &arena);
+    std::pmr::vector<int> col_of_edge(n_edges, 0, &arena);
+    int n_cols = 0;
+    for (int e = 0; e < n_edges; ++e) {
+        const GateCandidate& cand = candidates_[clusters_.items[e_begin + e]];
+        int& r = local_index_[cand.track];
+        if (r < 0) {
+            r = static_cast<int>(rows.size());
+            rows.push_back(cand.track);
+        }
+        int& col = local_index_[n_tracks_ + cand.det];
+        if (col < 0) {
+            col = n_cols++;
+        }
+        edge_row[e] = r;
+        col_of_edge[e] = col;
+    }
+    const int n_rows = static_cast<int>(rows.size());
+
+    // 행 별 CSR (같은 행 안에서는 후보 index 순서)
+    std::pmr::vector<int> row_start(n_rows + 1, 0, &arena);
+    for (int e = 0; e < n_edges; ++e) {
+        ++row_start[edge_row[e] + 1];
+    }
+    for (int r = 0; r < n_rows; ++r) {
+        row_start[r + 1] += row_start[r];
+    }
+    std::pmr::vector<int> edges(n_edges, 0, &arena);
+    std::pmr::vector<int> edge_col(n_edges, 0, &arena);
+    {
+        std::pmr::vector<int> cursor(row_start.begin(), row_start.end() - 1, &arena);
+        for (int e = 0; e < n_edges; ++e) {
+            const int pos = cursor[edge_row[e]]++;
+            edges[pos] = clusters_.items[e_begin + e];
+            edge_col[pos] = col_of_edge[e];
+        }
+    }
+
+    ClusterView v;
+    v.n_rows = n_rows;
+    v.n_cols = n_cols;
+    v.rows = rows.data();
+    v.row_start = row_start.data();
+    v.edges = edges.data();
+    v.edge_col = edge_col.data();
+    cluster_tracks_[c] = n_rows;
+
+    // joint event 수 상한 prod(1 + 후보 수) (detection 공유 제약을 무시하므로 실제 수 이상)
+    // 상한이 넘으면 실제 event 수를 max_events + 1 까지만 세어 본다 (O(max_events * 행 수))
+    double bound = 1.0;
+    for (int r = 0; r < n_rows && bound <= max_events_; ++r) {
+        bound *= 1.0 + (row_start[r + 1] - row_start[r]);
+    }
+    const bool exact = bound <= max_events_ ||
+                       enumerate(v, arena, nullptr, max_events_) <=
+                           static_cast<std::uint64_t>(max_events_);
+
+    for (int r = 0; r < n_rows; ++r) {
+        beta_miss_[rows[r]] = 0.0;
+    }
+    if (!exact && n_rows > k_best_max_tracks_) {
+        cluster_method_[c] = kApproximate;
+        approximate(v, arena);
+        return;
+    }
+
+    // 열거 / k-best 는 event 가중치를 beta_, beta_miss_ 에 쌓고 합으로 정규화
+    double total = 0.0;
+    if (exact) {
+        cluster_method_[c] = kExact;
+        cluster_events_[c] = enumerate(v, arena, &total, 0);
+    } else {
+        cluster_method_[c] = kKBest;
+        cluster_events_[c] = k_best(v, arena, total);
+    }
+    const double inv = 1.0 / total;
+    for (int r = 0; r < n_rows; ++r) {
+        beta_miss_[rows[r]] *= inv;
+        for (int e = row_start[r]; e < row_start[r + 1]; ++e) {
+            beta_[edges[e]] *= inv;
+        }
+    }
+}
+
+void JpdaSolver::add_event(const ClusterView& v, const int* choice, double w) {
+    for (int r = 0; r < v.n_rows; ++r) {
+        if (choice[r] < 0) {
+            beta_miss_[v.rows[r]] += w;
+        } else {
+            beta_[v.edges[choice[r]]] += w;
+        }
+    }
+}
+
+std::uint64_t JpdaSolver::enumerate(const ClusterView& v, FrameArena& arena, double* total,
+                                    std::uint64_t limit) {
+    // 행 순서 깊이 우선: 행 r 은 미검출 (-1) 또는 아직 안 쓴 열의 후보 하나 (CSR 위치)
+    // 다음 선택지는 -2 (시작 전) → -1 → row_start[r] ... 순서
+    // total 이 없으면 event 수만 세고 limit 을 넘는 순간 멈춘다
+    const int n = v.n_rows;
+    std::pmr::vector<int> choice(n + 1, -2, &arena);
+    std::pmr::vector<double> weight(n + 1, 1.0, &arena);
+    std::pmr::vector<char> used_col(v.n_cols, 0, &arena);
+
+    std::uint64_t events = 0;
+    int r = 0;
+    while (r >= 0) {
+        if (r == n) {
+            ++events;
+            if (!total) {
+                if (events > limit) break;
+            } else {
+                add_event(v, choice.data(), weight[n]);
+                *total += weight[n];
+            }
+            --r;
+            continue;
+        }
+
+        if (choice[r] >= 0) {
+            used_col[v.edge_col[choice[r]]] = 0;
+        }
+        int next = choice[r] == -2 ? -1 : (choice[r] == -1 ? v.row_start[r] : choice[r] + 1);
+        while (next >= 0 && next < v.row_start[r + 1] && used_col[v.edge_col[next]]) {
+            ++next;
+        }
+        if (next >= v.row_start[r + 1]) {
+            choice[r] = -2;
+            --r;
+            continue;
+        }
+
+        choice[r] = next;
+        if (next < 0) {
+            weight[r + 1] = weight[r] * miss_weight_;
+        } else {
+            used_col[v.edge_col[next]] = 1;
+            weight[r + 1] = weight[r] * likelihood_[v.edges[next]];
+        }
+        ++r;
+        choice[r] = -2;
+    }
+    return events;
+}
+
+std::uint64_t JpdaSolver::k_best(const ClusterView& v, FrameArena& arena, double& total) {
+    // 행 r: 열 [0, n_cols) 는 detection, 열 n_cols + r 은 미검출 (다른 행의 미검출 열은 금지)
+    // 비용 -log(가중치) 의 최소 할당이 가장 그럴듯한 joint event 이고, Murty 분할로 다음 event 를 찾는다.
+    // 모든 행이 정확히 한 열에 할당되므로 비용에 상수를 더해도 순서 / 비율은 같다 (음수 비용 제거)
+    const int n = v.n_rows;
+    const int m = v.n_cols + n;
+    const double miss_cost = -std::log(miss_weight_);
+    double c_min = miss_cost, c_max = miss_cost;
+    for (int e = 0; e < v.row_start[n]; ++e) {
+        const double c = -std::log(likelihood_[v.edges[e]]);
+        c_min = std::min(c_min, c);
+        c_max = std::max(c_max, c);
+    }
+    const double big = (c_max - c_min + 1.0) * (n + 1);   // 이 값이 선택되면 불가능한 할당
+
+    std::pmr::vector<double> base(static_cast<std::size_t>(n) * m, big, &arena);
+    std::pmr::vector<int> edge_at(static_cast<std::size_t>(n) * m, -1, &arena);
+    for (int r = 0; r < n; ++r) {
+        base[static_cast<std::size_t>(r) * m + v.n_cols + r] = miss_cost - c_min;
+        for (int e = v.row_start[r]; e < v.row_start[r + 1]; ++e) {
+            const std::size_t at = static_cast<std::size_t>(r) * m + v.edge_col[e];
+            base[at] = -std::log(likelihood_[v.edges[e]]) - c_min;
+            edge_at[at] = e;
+        }
+    }
+
+    // node: 고정 (forced) / 금지 (forbidden) 칸 목록 (r * m + col) 과 그 제약 아래 최적 할당
+    struct Node {
+        double cost;
+        int sol;         // sols 안 시작 위치 (n 개)
+        int forced;      // cons 안 시작 위치
+        int n_forced;
+        int forbidden;
+        int n_forbidden;
+    };
+    std::pmr::vector<Node> nodes(&arena);
+    std::pmr::vector<int> sols(&arena);
+    std::pmr::vector<int> cons(&arena);
+    std::pmr::vector<int> open(&arena);
+    std::pmr::vector<double> work(&arena);
+    std::pmr::vector<int> row_to_col(&arena);
+    std::pmr::vector<char> row_forced(n, 0, &arena);
+    std::pmr::vector<int> choice(n, -1, &arena);
+    LapSolver solver(&arena);
+
+    const std::size_t max_nodes = 1 + static_cast<std::size_t>(max_events_) * n;
+    nodes.reserve(max_nodes);
+    open.reserve(max_nodes);
+    sols.reserve(max_nodes * n);
+    cons.reserve(max_nodes * (n + 4));
+
+    // cons[forced..] / cons[forbidden..] 를 적용한 비용 행렬로 풀어 가능하면 node 추가
+    auto push_node = [&](int forced, int n_forced, int forbidden, int n_forbidden) {
+        work.assign(base.begin(), base.end());
+        for (int k = 0; k < n_forced; ++k) {
+            const int at = cons[forced + k];
+            const int r = at / m;
+            const int col = at % m;
+            for (int q = 0; q < m; ++q) {
+                if (q != col) work[static_cast<std::size_t>(r) * m + q] = big;
+            }
+            for (int q = 0; q < n; ++q) {
+                if (q != r) work[static_cast<std::size_t>(q) * m + col] = big;
+            }
+        }
+        for (int k = 0; k < n_forbidden; ++k) {
+            work[cons[forbidden + k]] = big;
+        }
+        solver.solve(work, n, m, row_to_col);
+        double cost = 0.0;
+        for (int r = 0; r < n; ++r) {
+            cost += work[static_cast<std::size_t>(r) * m + row_to_col[r]];
+        }
+        if (cost >= big) {
+            return;
+        }
+        nodes.push_back({cost, static_cast<int>(sols.size()), forced, n_forced,
+                         forbidden, n_forbidden});
+        sols.insert(sols.end(), row_to_col.begin(), row_to_col.end());
+        open.push_back(static_cast<int>(nodes.size()) - 1);
+    };
+
+    push_node(0, 0, 0, 0);
+    std::uint64_t events = 0;
+    double best = 0.0;
+    while (!open.empty() && events < static_cast<std::uint64_t>(max_events_)) {
+        // 비용이 가장 작은 열린 node (같으면 먼저 만든 node)
+        std::size_t pick = 0;
+        for (std::size_t k = 1; k < open.size(); ++k) {
+            const Node& a = nodes[open[k]];
+            const Node& b = nodes[open[pick]];
+            if (a.cost < b.cost || (a.cost == b.cost && open[k] < open[pick])) {
+                pick = k;
+            }
+        }
+        const int id = open[pick];
+        open[pick] = open.back();
+        open.pop_back();
+        const Node node = nodes[id];
+
+        if (events == 0) {
+            best = node.cost;
+        }
+        for (int r = 0; r < n; ++r) {
+            const int col = sols[node.sol + r];
+            choice[r] = col < v.n_cols ? edge_at[static_cast<std::size_t>(r) * m + col] : -1;
+        }
+        const double w = std::exp(best - node.cost);
+        add_event(v, choice.data(), w);
+        total += w;
+        if (++events == static_cast<std::uint64_t>(max_events_)) {
+            break;
+        }
+
+        // Murty 분할: 고정되지 않은 행을 차례로, 앞의 행은 이 해의 열로 고정하고 현재 행은 그 열을 금지
+        std::fill(row_forced.begin(), row_forced.end(), 0);
+        for (int k = 0; k < node.n_forced; ++k) {
+            row_forced[cons[node.forced + k] / m] = 1;
+        }
+        int n_fixed = 0;
+        for (int r = 0; r < n; ++r) {
+            if (row_forced[r]) continue;
+            const int forced = static_cast<int>(cons.size());
+            cons.insert(cons.end(), cons.begin() + node.forced,
+                        cons.begin() + node.forced + node.n_forced);
+            int fixed = 0;
+            for (int q = 0; q < r && fixed < n_fixed; ++q) {
+                if (row_forced[q]) continue;
+                cons.push_back(q * m + sols[node.sol + q]);
+                ++fixed;
+            }
+            const int forbidden = static_cast<int>(cons.size());
+            cons.insert(cons.end(), cons.begin() + node.forbidden,
+                        cons.begin() + node.forbidden + node.n_forbidden);
+            cons.push_back(r * m + sols[node.sol + r]);
+            push_node(forced, node.n_forced + n_fixed, forbidden, node.n_forbidden + 1);
+            ++n_fixed;
+        }
+    }
+    return events;
+}
+
+void JpdaSolver::approximate(const ClusterView& v, FrameArena& arena) {
+    // cheap JPDA (Fitzgerald): beta_rj = g_rj / (S_r + T_j - g_rj + (1 - P_D))
+    //   S_r = 행 r 의 likelihood 합, T_j = 열 j 의 likelihood 합
+    // 후보가 하나의 track 에만 걸린 경우 (T_j = g_rj) 정확한 PDA 와 같다
+    const int n = v.n_rows;
+    std::pmr::vector<double> col_sum(v.n_cols, 0.0, &arena);
+    for (int e = 0; e < v.row_start[n]; ++e) {
+        col_sum[v.edge_col[e]] += likelihood_[v.edges[e]];
+    }
+    for (int r = 0; r < n; ++r) {
+        double row_sum = 0.0;
+        for (int e = v.row_start[r]; e < v.row_start[r + 1]; ++e) {
+            row_sum += likelihood_[v.edges[e]];
+        }
+        double assoc = 0.0;
+        for (int e = v.row_start[r]; e < v.row_start[r + 1]; ++e) {
+            const double g = likelihood_[v.edges[e]];
+            const double b = g / (row_sum + col_sum[v.edge_col[e]] - g + miss_weight_);
+            beta_[v.edges[e]] = b;
+            assoc += b;
+        }
+        // 근사라 합이 1 을 넘을 수 있으므로 그때는 비율만 유지
+        if (assoc > 1.0) {
+            for (int e = v.row_start[r]; e < v.row_start[r + 1]; ++e) {
+                beta_[v.edges[e]] /= assoc;
+            }
+            assoc = 1.0;
+        }
+        beta_miss_[v.rows[r]] = 1.0 - assoc;
+    }
+}
+
+} // namespace msf
@@ -0,0 +1,18 @@
+#include "measurement_cache.hpp"
+#include "sensor_models.hpp"
+
+namespace msf {
+
+void MeasurementCache::compute_camera(const Vec4& x, const Mat4& P, const Eigen::Matrix2d& R) {
+    camera.z_pred = camera_measurement(x);
+    camera.H = camera_H();
+    camera.factorize(P, R);
+}
+
+void MeasurementCache::compute_radar(const Vec4& x, const Mat4& P, const Eigen::Matrix3d& R) {
+    radar.z_pred = radar_measurement(x);
+    radar.H = radar_H_jacobian(x);
+    radar.factorize(P, R);
+}
+
+} // namespace msf
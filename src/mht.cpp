@@ -0,0 +1,504 @@
+#include "mht.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace msf {
+
+namespace {
+
+enum : char { kTruncated = 1, kDegraded = 2 };      // cluster_flags_
+enum : char { kInHypothesis = 1, kInBest = 2 };     // keep_
+
+} // anonymous namespace
+
+MhtEngine::MhtEngine(const TrackerParams& params) : params_(params) {
+    params_.mht_n_scan = std::max(1, params_.mht_n_scan);
+    params_.mht_k_best = std::max(1, params_.mht_k_best);
+    params_.mht_max_leaves_per_track = std::max(1, params_.mht_max_leaves_per_track);
+    log_miss_ = std::log(std::max(1.0 - params_.detection_prob, 1e-9));
+
+    // node pool 은 여기서 한 번만 확보 (0 번 칸부터 꺼내 쓰도록 역순으로 쌓음)
+    const int capacity = std::max(1, params_.mht_max_nodes);
+    nodes_.resize(capacity);
+    free_.reserve(capacity);
+    for (int k = capacity - 1; k >= 0; --k) {
+        free_.push_back(k);
+    }
+    scan_base_.assign(params_.mht_n_scan + 1, 0);
+}
+
+int MhtEngine::allocate_node() {
+    const int node = free_.back();
+    free_.pop_back();
+    return node;
+}
+
+void MhtEngine::release(int node) {
+    // 참조가 없어진 node 는 pool 로 돌리고 부모 참조도 하나 뺀다
+    while (node >= 0 && --nodes_[node].refs == 0) {
+        const int parent = nodes_[node].parent;
+        free_.push_back(node);
+        node = parent;
+    }
+}
+
+void MhtEngine::update(const std::vector<GateCandidate>& candidates,
+                       const std::vector<double>& likelihood,
+                       const std::vector<TrackState>& posterior,
+                       const std::vector<TrackState>& births, ThreadPool& pool) {
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+
+    const int n_scan = params_.mht_n_scan;
+    const int n_leaves = static_cast<int>(leaves_.size());
+    const int n_cand = static_cast<int>(candidates.size());
+    const int n_dets = static_cast<int>(births.size());
+
+    // detection 번호: scan 을 거쳐도 겹치지 않게 누적. window = 최근 N + 1 scan
+    ++scan_;
+    det_base_ = next_det_;
+    next_det_ = det_base_ + n_dets;
+    scan_base_[scan_ % (n_scan + 1)] = det_base_;
+    window_base_ = scan_ > n_scan ? scan_base_[(scan_ - n_scan) % (n_scan + 1)] : 0;
+    const int n_window = static_cast<int>(next_det_ - window_base_);
+    const int oldest_scan = scan_ - n_scan;
+
+    // leaf 별 후보 (CSR, 같은 leaf 안에서는 후보 index 순서)
+    reserve_for(cand_start_, n_leaves + 1);
+    reserve_for(cand_order_, n_cand);
+    reserve_for(fill_, n_leaves + n_dets + 1);
+    cand_start_.assign(n_leaves + 1, 0);
+    for (const auto& c : candidates) {
+        ++cand_start_[c.track + 1];
+    }
+    for (int i = 0; i < n_leaves; ++i) {
+        cand_start_[i + 1] += cand_start_[i];
+    }
+    fill_.assign(cand_start_.begin(), cand_start_.end() - 1);
+    cand_order_.resize(n_cand);
+    for (int k = 0; k < n_cand; ++k) {
+        cand_order_[fill_[candidates[k].track]++] = k;
+    }
+
+    // 1. leaf 분기: leaf 마다 미검출 + 게이트 안 detection 별 child, detection 마다 새 tree
+    //    tree 안의 child 는 점수 내림차순 (같으면 leaf, detection 순) 으로 정렬해서 상위 max_leaves 개만
+    const int max_children = n_leaves + n_cand + n_dets;
+    reserve_for(children_, max_children);
+    reserve_for(keep_, max_children);
+    reserve_for(path_start_, max_children + 1);
+    reserve_for(path_det_, static_cast<std::size_t>(max_children) * (n_scan + 1));
+    reserve_for(tree_start_, n_leaves + n_dets + 1);
+    reserve_for(tree_id_, n_leaves + n_dets);
+    reserve_for(tree_anchor_, n_leaves + n_dets);
+    children_.clear();
+    tree_start_.clear();
+    tree_id_.clear();
+
+    const double delete_score = params_.mht_delete_score;
+    const std::size_t max_leaves = params_.mht_max_leaves_per_track;
+    auto close_tree = [&]() {
+        const std::size_t b = tree_start_.back();
+        std::sort(children_.begin() + b, children_.end(), [](const Child& a, const Child& c) {
+            if (a.score != c.score) return a.score > c.score;
+            if (a.leaf != c.leaf) return a.leaf < c.leaf;
+            return a.det < c.det;
+        });
+        if (children_.size() - b > max_leaves) {
+            children_.resize(b + max_leaves);
+        }
+        if (children_.size() == b) {
+            // 살아남은 child 가 없는 tree 는 여기서 끝
+            tree_start_.pop_back();
+            tree_id_.pop_back();
+        }
+    };
+    for (int i = 0; i < n_leaves; ++i) {
+        if (i == 0 || leaves_[i].id != leaves_[i - 1].id) {
+            if (i > 0) close_tree();
+            tree_start_.push_back(static_cast<int>(children_.size()));
+            tree_id_.push_back(leaves_[i].id);
+        }
+        const int t = static_cast<int>(tree_id_.size()) - 1;
+        const double score = nodes_[leaf_node_[i]].score;
+        if (leaves_[i].missed < params_.max_missed && score + log_miss_ >= delete_score) {
+            children_.push_back({score + log_miss_, t, i, -1, -1, -1});
+        }
+        for (int q = cand_start_[i]; q < cand_start_[i + 1]; ++q) {
+            const int k = cand_order_[q];
+            const double s = score + std::log(likelihood[k]);
+            if (s >= delete_score) {
+                children_.push_back({s, t, i, k, candidates[k].det, -1});
+            }
+        }
+    }
+    if (n_leaves > 0) close_tree();
+    if (params_.mht_birth_score >= delete_score) {
+        for (int j = 0; j < n_dets; ++j) {
+            const int t = static_cast<int>(tree_id_.size());
+            tree_start_.push_back(static_cast<int>(children_.size()));
+            tree_id_.push_back(-1);
+            children_.push_back({params_.mht_birth_score, t, -1, -1, j, -1});
+        }
+    }
+    const int n_trees = static_cast<int>(tree_id_.size());
+    const int n_children = static_cast<int>(children_.size());
+    tree_start_.push_back(n_children);
+
+    // 2. child 별 최근 N + 1 scan 에 쓴 detection (window index) 과 N scan 전 조상
+    path_start_.resize(n_children + 1);
+    path_det_.clear();
+    for (int c = 0; c < n_children; ++c) {
+        Child& ch = children_[c];
+        path_start_[c] = static_cast<int>(path_det_.size());
+        if (ch.det >= 0) {
+            path_det_.push_back(static_cast<int>(det_base_ + ch.det - window_base_));
+        }
+        int p = ch.leaf >= 0 ? leaf_node_[ch.leaf] : -1;
+        while (p >= 0 && nodes_[p].scan >= oldest_scan) {
+            if (nodes_[p].det >= 0) {
+                path_det_.push_back(static_cast<int>(nodes_[p].det - window_base_));
+            }
+            if (nodes_[p].scan == oldest_scan) {
+                ch.anchor = p;
+                break;
+            }
+            p = nodes_[p].parent;
+        }
+    }
+    path_start_[n_children] = static_cast<int>(path_det_.size());
+
+    // 3. window detection 을 공유하는 tree 끼리 cluster (tree 노드 [0, n_trees), detection 노드 뒤)
+    const int n_nodes = n_trees + n_window;
+    clusters_.reserve(n_nodes, n_trees);
+    reserve_for(local_det_, n_window);
+    reserve_for(cluster_flags_, n_trees);
+    reserve_for(cluster_searched_, n_trees);
+
+    clusters_.reset(n_nodes);
+    for (int c = 0; c < n_children; ++c) {
+        for (int q = path_start_[c]; q < path_start_[c + 1]; ++q) {
+            clusters_.unite(children_[c].tree, n_trees + path_det_[q]);
+        }
+    }
+    const int n_clusters = clusters_.build(n_trees, [](int t) { return t; });
+    local_det_.assign(n_window, -1);
+    keep_.assign(n_children, 0);
+    cluster_flags_.assign(n_clusters, 0);
+    cluster_searched_.assign(n_clusters, 0);
+
+    // 4. cluster 별 상위 k_best 전역 hypothesis (서로 다른 child / detection 칸에만 씀)
+    while (static_cast<int>(arenas_.size()) < pool.size()) {
+        arenas_.push_back(std::make_unique<FrameArena>(256 * 1024));
+    }
+    const double budget_ms = params_.mht_time_budget_ms;
+    for_each_cluster_chunk(pool, n_clusters, [&](int c0, int c1, int worker) {
+        FrameArena& arena = *arenas_[worker];
+        const bool greedy_only =
+            budget_ms > 0.0 &&
+            std::chrono::duration<double, std::milli>(Clock::now() - start).count() > budget_ms;
+        for (int c = c0; c < c1; ++c) {
+            solve_cluster(c, arena, greedy_only);
+        }
+    });
+
+    // 5. N-scan-back: tree 마다 기준 leaf (최적 hypothesis 의 leaf, 없으면 남은 leaf 중 최고 점수)
+    //    의 N scan 전 조상과 다른 조상에서 갈라진 leaf 는 버린다
+    tree_anchor_.assign(n_trees, -1);
+    for (int t = 0; t < n_trees; ++t) {
+        int ref = -1;
+        for (int c = tree_start_[t]; c < tree_start_[t + 1]; ++c) {
+            if (keep_[c] & kInBest) {
+                ref = c;
+                break;
+            }
+            if (keep_[c] && ref < 0) {
+                ref = c;
+            }
+        }
+        if (ref >= 0) {
+            tree_anchor_[t] = children_[ref].anchor;
+        }
+    }
+    reserve_for(order_, n_children);
+    order_.clear();
+    for (int c = 0; c < n_children; ++c) {
+        const Child& ch = children_[c];
+        if (keep_[c] && (tree_anchor_[ch.tree] < 0 || ch.anchor == tree_anchor_[ch.tree])) {
+            order_.push_back(c);
+        } else {
+            keep_[c] = 0;
+        }
+    }
+
+    // 6. pool 반영: 살아남은 child 가 부모를 잡은 뒤 이전 leaf 를 놓아 버려진 분기를 회수
+    for (int c : order_) {
+        if (children_[c].leaf >= 0) {
+            ++nodes_[leaf_node_[children_[c].leaf]].refs;
+        }
+    }
+    for (int node : leaf_node_) {
+        release(node);
+    }
+    stats_ = MhtStats{};
+    if (order_.size() > free_.size()) {
+        // pool 이 모자라면 최적 hypothesis 밖의 점수 낮은 leaf 부터 버린다
+        std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+            const bool best_a = keep_[a] & kInBest;
+            const bool best_b = keep_[b] & kInBest;
+            if (best_a != best_b) return best_a;
+            if (children_[a].score != children_[b].score) {
+                return children_[a].score > children_[b].score;
+            }
+            return a < b;
+        });
+        // (버린 leaf 의 부모가 풀려 빈 칸이 늘어도 확정한 개수만 남긴다)
+        const std::size_t n_fit = free_.size();
+        for (std::size_t q = n_fit; q < order_.size(); ++q) {
+            const int c = order_[q];
+            if (children_[c].leaf >= 0) {
+                release(leaf_node_[children_[c].leaf]);
+            }
+            keep_[c] = 0;
+        }
+        stats_.dropped = static_cast<int>(order_.size() - n_fit);
+        order_.resize(n_fit);
+        std::sort(order_.begin(), order_.end());
+    }
+
+    // 새 leaf (children_ 순서라 tree 순서, 새 tree 는 기존 tree 뒤라 id 오름차순이 유지된다)
+    reserve_for(next_leaf_node_, order_.size());
+    reserve_for(next_leaves_, order_.size());
+    reserve_for(best_, n_trees);
+    next_leaf_node_.clear();
+    next_leaves_.clear();
+    best_.clear();
+    int last_tree = -1;
+    for (int c : order_) {
+        const Child& ch = children_[c];
+        if (tree_id_[ch.tree] < 0) {
+            tree_id_[ch.tree] = next_tree_id_++;
+        }
+        TrackState s;
+        if (ch.leaf < 0) {
+            s = births[ch.det];
+            s.age = 1;
+            s.missed = 0;
+            s.confirmed = false;
+        } else {
+            s = leaves_[ch.leaf];
+            if (ch.cand >= 0) {
+                s.x = posterior[ch.cand].x;
+                s.P = posterior[ch.cand].P;
+                s.missed = 0;
+                if (!s.confirmed && s.age >= params_.min_hits_to_confirm) {
+                    s.confirmed = true;
+                }
+            } else {
+                s.missed += 1;
+            }
+        }
+        s.id = tree_id_[ch.tree];
+
+        const int node = allocate_node();
+        Node& n = nodes_[node];
+        n.state = s;
+        n.score = ch.score;
+        n.parent = ch.leaf >= 0 ? leaf_node_[ch.leaf] : -1;
+        n.refs = 1;
+        n.scan = scan_;
+        n.det = ch.det >= 0 ? det_base_ + ch.det : -1;
+        next_leaf_node_.push_back(node);
+        next_leaves_.push_back(s);
+        if (keep_[c] & kInBest) {
+            best_.push_back(s);
+        }
+
+        // N scan 전 조상을 새 root 로 확정 (남은 leaf 는 모두 이 조상의 자손)
+        const int anchor = tree_anchor_[ch.tree];
+        if (anchor >= 0 && nodes_[anchor].parent >= 0) {
+            release(nodes_[anchor].parent);
+            nodes_[anchor].parent = -1;
+        }
+        if (ch.tree != last_tree) {
+            ++stats_.trees;
+            last_tree = ch.tree;
+        }
+    }
+    leaf_node_.swap(next_leaf_node_);
+    leaves_.swap(next_leaves_);
+
+    stats_.leaves = static_cast<int>(leaves_.size());
+    stats_.nodes = static_cast<int>(nodes_.size() - free_.size());
+    stats_.clusters = n_clusters;
+    for (int c = 0; c < n_clusters; ++c) {
+        stats_.truncated += (cluster_flags_[c] & kTruncated) ? 1 : 0;
+        stats_.degraded += (cluster_flags_[c] & kDegraded) ? 1 : 0;
+        stats_.searched += cluster_searched_[c];
+    }
+}
+
+void MhtEngine::solve_cluster(int c, FrameArena& arena, bool greedy_only) {
+    arena.reset();
+
+    // 최고 leaf 점수가 큰 tree 부터 (좋은 해를 먼저 찾아 bound 가 빨리 좁혀진다)
+    const int n = clusters_.start[c + 1] - clusters_.start[c];
+    const int* trees = clusters_.items.data() + clusters_.start[c];
+    std::pmr::vector<int> order(trees, trees + n, &arena);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        const double sa = children_[tree_start_[a]].score;
+        const double sb = children_[tree_start_[b]].score;
+        if (sa != sb) return sa > sb;
+        return a < b;
+    });
+
+    // window detection 의 cluster 안 번호 (cluster 끼리 겹치지 않음)
+    int n_local = 0;
+    for (int t : order) {
+        for (int q = path_start_[tree_start_[t]]; q < path_start_[tree_start_[t + 1]]; ++q) {
+            if (local_det_[path_det_[q]] < 0) {
+                local_det_[path_det_[q]] = n_local++;
+            }
+        }
+    }
+
+    // 행 r (tree order[r]) 의 선택지: 양수 점수 child (내림차순) → 없음 (0) → 나머지 child
+    // 선택지 점수가 내림차순이라 bound 를 넘지 못하는 순간 그 행의 나머지는 볼 필요가 없다
+    std::pmr::vector<int> none_at(n, 0, &arena);
+    std::pmr::vector<double> suffix(n + 1, 0.0, &arena);   // 남은 행의 점수 상한
+    for (int r = n - 1; r >= 0; --r) {
+        const int b = tree_start_[order[r]];
+        const int e = tree_start_[order[r] + 1];
+        int p = b;
+        while (p < e && children_[p].score > 0.0) ++p;
+        none_at[r] = p - b;
+        suffix[r] = suffix[r + 1] + std::max(0.0, children_[b].score);
+    }
+    auto option = [&](int r, int o, int& child) {
+        const int b = tree_start_[order[r]];
+        if (o == none_at[r]) {
+            child = -1;
+            return 0.0;
+        }
+        child = b + (o < none_at[r] ? o : o - 1);
+        return children_[child].score;
+    };
+
+    const int k_best = greedy_only ? 1 : params_.mht_k_best;
+    const double gap = params_.mht_hypothesis_gap;
+    const std::uint64_t limit =
+        greedy_only ? n : std::max<std::uint64_t>(n, params_.mht_max_search_nodes);
+    std::pmr::vector<double> sol_score(&arena);
+    std::pmr::vector<int> sol_choice(&arena);
+    sol_score.reserve(k_best + 1);
+    sol_choice.reserve(static_cast<std::size_t>(k_best + 1) * n);
+
+    std::pmr::vector<int> next(n + 1, 0, &arena);      // 행 r 의 다음 선택지
+    std::pmr::vector<int> choice(n + 1, -2, &arena);   // 행 r 의 child (-1: 없음, -2: 미정)
+    std::pmr::vector<double> prefix(n + 1, 0.0, &arena);
+    std::pmr::vector<char> used(n_local, 0, &arena);
+    auto mark = [&](int child, char v) {
+        for (int q = path_start_[child]; q < path_start_[child + 1]; ++q) {
+            used[local_det_[path_det_[q]]] = v;
+        }
+    };
+    auto conflicts = [&](int child) {
+        for (int q = path_start_[child]; q < path_start_[child + 1]; ++q) {
+            if (used[local_det_[path_det_[q]]]) return true;
+        }
+        return false;
+    };
+
+    // 깊이 우선 branch and bound, 상위 k_best 해를 점수 내림차순으로 유지 (같은 점수는 먼저 찾은 해)
+    std::uint64_t searched = 0;
+    bool truncated = false;
+    int r = 0;
+    while (r >= 0) {
+        if (r == n) {
+            const double score = prefix[n];
+            int pos = static_cast<int>(sol_score.size());
+            if ((pos < k_best || score > sol_score.back()) &&
+                (pos == 0 || score >= sol_score[0] - gap)) {
+                while (pos > 0 && sol_score[pos - 1] < score) --pos;
+                sol_score.insert(sol_score.begin() + pos, score);
+                sol_choice.insert(sol_choice.begin() + static_cast<std::size_t>(pos) * n,
+                                  choice.begin(), choice.begin() + n);
+                // 최적 해가 바뀌면 gap 밖으로 밀려난 해도 버린다
+                while (static_cast<int>(sol_score.size()) > k_best ||
+                       sol_score.back() < sol_score[0] - gap) {
+                    sol_score.pop_back();
+                    sol_choice.resize(sol_score.size() * n);
+                }
+            }
+            --r;
+            continue;
+        }
+
+        if (choice[r] >= 0) {
+            mark(choice[r], 0);
+        }
+        choice[r] = -2;
+        const bool full = static_cast<int>(sol_score.size()) == k_best;
+        while (next[r] < static_cast<int>(tree_start_[order[r] + 1] - tree_start_[order[r]]) + 1) {
+            int child;
+            const double s = option(r, next[r]++, child);
+            const double bound = prefix[r] + s + suffix[r + 1];
+            if (!sol_score.empty() &&
+                ((full && bound <= sol_score.back()) || bound < sol_score[0] - gap)) {
+                next[r] = std::numeric_limits<int>::max();
+                break;
+            }
+            if (child >= 0 && conflicts(child)) continue;
+            if (child >= 0) mark(child, 1);
+            choice[r] = child;
+            prefix[r + 1] = prefix[r] + s;
+            break;
+        }
+        if (choice[r] == -2) {
+            next[r] = 0;
+            --r;
+            continue;
+        }
+        if (++searched > limit) {
+            // 해가 하나 이상 있을 때만 여기 온다 (첫 내려가기는 n 단계로 끝남)
+            truncated = !greedy_only;
+            break;
+        }
+        ++r;
+        next[r] = 0;
+        choice[r] = -2;
+    }
+
+    for (std::size_t s = 0; s < sol_score.size(); ++s) {
+        for (int q = 0; q < n; ++q) {
+            const int child = sol_choice[s * n + q];
+            if (child >= 0) {
+                keep_[child] |= s == 0 ? (kInHypothesis | kInBest) : kInHypothesis;
+            }
+        }
+    }
+
+    // 최적 hypothesis 에서 빠진 tree (아직 점수가 음수인 새 tree 등) 는 최적 hypothesis 와
+    // detection 이 겹치지 않는 leaf 중 최고 점수 하나를 남긴다. 이게 없으면 새 tree 가
+    // 점수를 쌓기 전에 k-best 밖으로 밀려 사라지고, 겹치는 leaf 를 남기면 같은 detection 을
+    // 계속 두고 다투는 중복 tree 가 된다
+    std::fill(used.begin(), used.end(), 0);
+    for (int q = 0; q < n; ++q) {
+        if (sol_choice[q] >= 0) mark(sol_choice[q], 1);
+    }
+    for (int q = 0; q < n; ++q) {
+        if (sol_choice[q] >= 0) continue;
+        for (int child = tree_start_[order[q]]; child < tree_start_[order[q] + 1]; ++child) {
+            if (!conflicts(child)) {
+                keep_[child] |= kInHypothesis;
+                break;
+            }
+        }
+    }
+    cluster_searched_[c] = searched;
+    cluster_flags_[c] = (truncated ? kTruncated : 0) | (greedy_only ? kDegraded : 0);
+}
+
+} // namespace msf
@@ -0,0 +1,345 @@
+#include "radar_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MSFT_X86_DISPATCH 1
+#include <immintrin.h>
+#else
+#define MSFT_X86_DISPATCH 0
+#endif
+
+namespace msf {
+
+namespace {
+
+// radar_measurement / radar_H_jacobian 과 같은 특이점 기준
+constexpr double kMinRho = 1e-6;      // r 이 이보다 작으면 r_dot = 0
+constexpr double kMinRangeSq = 1e-6;  // r^2 이 이보다 작으면 H = 0
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kHalfPi = 1.57079632679489661923;
+
+// atan(a), 0 <= a <= 1 의 다항식 근사: a * sum_k c_k (a^2)^k
+// Abramowitz & Stegun 4.4.49 (|오차| <= 2e-8 rad)
+constexpr double kAtanC[9] = {
+    1.0,
+    -0.3333314528,
+    0.1999355085,
+    -0.1420889944,
+    0.1065626393,
+    -0.0752896400,
+    0.0429096138,
+    -0.0161657367,
+    0.0028662257,
+};
+
+struct RadarArgs {
+    const double* px;
+    const double* py;
+    const double* vx;
+    const double* vy;
+    double* rho;
+    double* phi;
+    double* rho_dot;
+    double* ux;
+    double* uy;
+    double* ax;
+    double* ay;
+    double* dx;
+    double* dy;
+};
+
+// kFma = true 이면 a * b + c 를 std::fma 로 한 번만 반올림 (SIMD kernel 의 fmadd 와 같은 값).
+// SIMD kernel 의 나머지 원소는 이 경로로 계산하므로 track 이 vector 본체 / 나머지 중
+// 어디에 들어가든 (= 스레드 분할과 무관하게) 결과가 bit 단위로 같다
+template<bool kFma>
+inline double mul_add(double a, double b, double c) {
+    if constexpr (kFma) {
+        return std::fma(a, b, c);
+    } else {
+        return a * b + c;
+    }
+}
+
+// 옥탄트 축소 + 다항식: a = min(|x|,|y|) / max(|x|,|y|) 로 [0, 1] 에 가져온 뒤
+// |y| > |x| 이면 pi/2 - r, x < 0 이면 pi - r, 부호는 y 를 따른다
+template<bool kFma>
+inline double atan2_poly(double y, double x) {
+    const double abs_x = std::fabs(x);
+    const double abs_y = std::fabs(y);
+    const double mx = std::max(abs_x, abs_y);
+    const double mn = std::min(abs_x, abs_y);
+    const double a = mx > 0.0 ? mn / mx : 0.0;
+    const double s = a * a;
+
+    double p = kAtanC[8];
+    for (int k = 7; k >= 0; --k) {
+        p = mul_add<kFma>(p, s, kAtanC[k]);
+    }
+    double r = p * a;
+    r = abs_y > abs_x ? kHalfPi - r : r;
+    r = x < 0.0 ? kPi - r : r;
+    return std::copysign(r, y);
+}
+
+// kJacobian = false 이면 h(x) 만 계산 (UKF sigma point 용, H 출력 포인터는 쓰지 않음).
+// 연산 순서는 SIMD kernel 과 같다 (kFma = false 는 FMA 가 없는 CPU 의 전체 경로)
+template<bool kJacobian, bool kFma>
+void radar_scalar(const RadarArgs& a, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        const double px = a.px[i], py = a.py[i];
+        const double vx = a.vx[i], vy = a.vy[i];
+
+        const double c1 = mul_add<kFma>(px, px, py * py);
+        const double rho = std::sqrt(c1);
+        const double inv_r = rho > 0.0 ? 1.0 / rho : 0.0;
+
+        a.rho[i] = rho;
+        a.phi[i] = atan2_poly<kFma>(py, px);
+        a.rho_dot[i] = rho > kMinRho ? mul_add<kFma>(px, vx, py * vy) * inv_r : 0.0;
+        if constexpr (!kJacobian) {
+            continue;
+        }
+
+        // H 는 r^2 이 작으면 전부 0 (inv 를 0 으로 두면 모든 원소가 0 이 됨)
+        const double inv_rj = c1 >= kMinRangeSq ? inv_r : 0.0;
+        const double inv_c1 = inv_rj * inv_rj;
+        const double inv_c3 = inv_c1 * inv_rj;
+        const double cross_c3 = mul_add<kFma>(vx, py, -(vy * px)) * inv_c3;
+
+        a.ux[i] = px * inv_rj;
+        a.uy[i] = py * inv_rj;
+        a.ax[i] = 0.0 - py * inv_c1;
+        a.ay[i] = px * inv_c1;
+        a.dx[i] = mul_add<kFma>(-py, cross_c3, vx * inv_rj);
+        a.dy[i] = mul_add<kFma>(px, cross_c3, vy * inv_rj);
+    }
+}
+
+#if MSFT_X86_DISPATCH
+
+__attribute__((target("avx2,fma")))
+inline __m256d atan2_avx2(__m256d y, __m256d x) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d abs_x = _mm256_andnot_pd(sign, x);
+    const __m256d abs_y = _mm256_andnot_pd(sign, y);
+    const __m256d mx = _mm256_max_pd(abs_x, abs_y);
+    const __m256d mn = _mm256_min_pd(abs_x, abs_y);
+    // x = y = 0 이면 0/0 대신 0
+    const __m256d a = _mm256_and_pd(_mm256_cmp_pd(mx, zero, _CMP_GT_OQ), _mm256_div_pd(mn, mx));
+    const __m256d s = _mm256_mul_pd(a, a);
+
+    __m256d p = _mm256_set1_pd(kAtanC[8]);
+    for (int k = 7; k >= 0; --k) {
+        p = _mm256_fmadd_pd(p, s, _mm256_set1_pd(kAtanC[k]));
+    }
+    __m256d r = _mm256_mul_pd(p, a);
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_set1_pd(kHalfPi), r),
+                         _mm256_cmp_pd(abs_y, abs_x, _CMP_GT_OQ));
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_set1_pd(kPi), r),
+                         _mm256_cmp_pd(x, zero, _CMP_LT_OQ));
+    return _mm256_or_pd(r, _mm256_and_pd(sign, y));
+}
+
+template<bool kJacobian>
+__attribute__((target("avx2,fma")))
+void radar_avx2(const RadarArgs& a, std::size_t begin, std::size_t end) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d min_rho = _mm256_set1_pd(kMinRho);
+    const __m256d min_range_sq = _mm256_set1_pd(kMinRangeSq);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m256d px = _mm256_loadu_pd(a.px + i);
+        const __m256d py = _mm256_loadu_pd(a.py + i);
+        const __m256d vx = _mm256_loadu_pd(a.vx + i);
+        const __m256d vy = _mm256_loadu_pd(a.vy + i);
+
+        const __m256d c1 = _mm256_fmadd_pd(px, px, _mm256_mul_pd(py, py));
+        const __m256d rho = _mm256_sqrt_pd(c1);
+        const __m256d inv_r = _mm256_div_pd(one, rho);
+
+        _mm256_storeu_pd(a.rho + i, rho);
+        _mm256_storeu_pd(a.phi + i, atan2_avx2(py, px));
+        const __m256d dot = _mm256_fmadd_pd(px, vx, _mm256_mul_pd(py, vy));
+        _mm256_storeu_pd(a.rho_dot + i,
+                         _mm256_and_pd(_mm256_cmp_pd(rho, min_rho, _CMP_GT_OQ),
+                                       _mm256_mul_pd(dot, inv_r)));
+        if constexpr (!kJacobian) {
+            continue;
+        }
+
+        const __m256d inv_rj =
+            _mm256_and_pd(_mm256_cmp_pd(c1, min_range_sq, _CMP_GE_OQ), inv_r);
+        const __m256d inv_c1 = _mm256_mul_pd(inv_rj, inv_rj);
+        const __m256d inv_c3 = _mm256_mul_pd(inv_c1, inv_rj);
+        const __m256d cross = _mm256_fmsub_pd(vx, py, _mm256_mul_pd(vy, px));
+        const __m256d cross_c3 = _mm256_mul_pd(cross, inv_c3);
+
+        _mm256_storeu_pd(a.ux + i, _mm256_mul_pd(px, inv_rj));
+        _mm256_storeu_pd(a.uy + i, _mm256_mul_pd(py, inv_rj));
+        _mm256_storeu_pd(a.ax + i, _mm256_sub_pd(_mm256_setzero_pd(), _mm256_mul_pd(py, inv_c1)));
+        _mm256_storeu_pd(a.ay + i, _mm256_mul_pd(px, inv_c1));
+        _mm256_storeu_pd(a.dx + i, _mm256_fnmadd_pd(py, cross_c3, _mm256_mul_pd(vx, inv_rj)));
+        _mm256_storeu_pd(a.dy + i, _mm256_fmadd_pd(px, cross_c3, _mm256_mul_pd(vy, inv_rj)));
+    }
+
+    radar_scalar<kJacobian, true>(a, i, end);
+}
+
+// GCC 12 는 avx512 intrinsic 내부의 _mm512_undefined_pd() 에 대해 잘못된 경고를 낸다
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f")))
+inline __m512d atan2_avx512(__m512d y, __m512d x) {
+    const __m512i sign = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL));
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d abs_x = _mm512_abs_pd(x);
+    const __m512d abs_y = _mm512_abs_pd(y);
+    const __m512d mx = _mm512_max_pd(abs_x, abs_y);
+    const __m512d mn = _mm512_min_pd(abs_x, abs_y);
+    // x = y = 0 이면 0/0 대신 0
+    const __m512d a = _mm512_maskz_div_pd(_mm512_cmp_pd_mask(mx, zero, _CMP_GT_OQ), mn, mx);
+    const __m512d s = _mm512_mul_pd(a, a);
+
+    __m512d p = _mm512_set1_pd(kAtanC[8]);
+    for (int k = 7; k >= 0; --k) {
+        p = _mm512_fmadd_pd(p, s, _mm512_set1_pd(kAtanC[k]));
+    }
+    __m512d r = _mm512_mul_pd(p, a);
+    r = _mm512_mask_sub_pd(r, _mm512_cmp_pd_mask(abs_y, abs_x, _CMP_GT_OQ),
+                           _mm512_set1_pd(kHalfPi), r);
+    r = _mm512_mask_sub_pd(r, _mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ),
+                           _mm512_set1_pd(kPi), r);
+    const __m512i y_sign = _mm512_and_si512(_mm512_castpd_si512(y), sign);
+    return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(r), y_sign));
+}
+
+template<bool kJacobian>
+__attribute__((target("avx512f")))
+void radar_avx512(const RadarArgs& a, std::size_t begin, std::size_t end) {
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d min_rho = _mm512_set1_pd(kMinRho);
+    const __m512d min_range_sq = _mm512_set1_pd(kMinRangeSq);
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m512d px = _mm512_loadu_pd(a.px + i);
+        const __m512d py = _mm512_loadu_pd(a.py + i);
+        const __m512d vx = _mm512_loadu_pd(a.vx + i);
+        const __m512d vy = _mm512_loadu_pd(a.vy + i);
+
+        const __m512d c1 = _mm512_fmadd_pd(px, px, _mm512_mul_pd(py, py));
+        const __m512d rho = _mm512_sqrt_pd(c1);
+        const __m512d inv_r = _mm512_div_pd(one, rho);
+
+        _mm512_storeu_pd(a.rho + i, rho);
+        _mm512_storeu_pd(a.phi + i, atan2_avx512(py, px));
+        const __m512d dot = _mm512_fmadd_pd(px, vx, _mm512_mul_pd(py, vy));
+        _mm512_storeu_pd(a.rho_dot + i,
+                         _mm512_maskz_mul_pd(_mm512_cmp_pd_mask(rho, min_rho, _CMP_GT_OQ),
+                                             dot, inv_r));
+        if constexpr (!kJacobian) {
+            continue;
+        }
+
+        const __m512d inv_rj =
+            _mm512_mask_blend_pd(_mm512_cmp_pd_mask(c1, min_range_sq, _CMP_GE_OQ), zero, inv_r);
+        const __m512d inv_c1 = _mm512_mul_pd(inv_rj, inv_rj);
+        const __m512d inv_c3 = _mm512_mul_pd(inv_c1, inv_rj);
+        const __m512d cross = _mm512_fmsub_pd(vx, py, _mm512_mul_pd(vy, px));
+        const __m512d cross_c3 = _mm512_mul_pd(cross, inv_c3);
+
+        _mm512_storeu_pd(a.ux + i, _mm512_mul_pd(px, inv_rj));
+        _mm512_storeu_pd(a.uy + i, _mm512_mul_pd(py, inv_rj));
+        _mm512_storeu_pd(a.ax + i, _mm512_sub_pd(zero, _mm512_mul_pd(py, inv_c1)));
+        _mm512_storeu_pd(a.ay + i, _mm512_mul_pd(px, inv_c1));
+        _mm512_storeu_pd(a.dx + i, _mm512_fnmadd_pd(py, cross_c3, _mm512_mul_pd(vx, inv_rj)));
+        _mm512_storeu_pd(a.dy + i, _mm512_fmadd_pd(px, cross_c3, _mm512_mul_pd(vy, inv_rj)));
+    }
+
+    radar_scalar<kJacobian, true>(a, i, end);
+}
+
+#pragma GCC diagnostic pop
+
+#endif // MSFT_X86_DISPATCH
+
+using RadarKernel = void (*)(const RadarArgs&, std::size_t, std::size_t);
+
+struct KernelChoice {
+    RadarKernel fn;         // h(x) + H
+    RadarKernel fn_meas;    // h(x) 만
+    const char* name;
+};
+
+// 실행 중인 CPU 기능에 맞춰 한 번만 kernel 선택
+const KernelChoice& radar_kernel() {
+    static const KernelChoice choice = [] {
+#if MSFT_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return KernelChoice{radar_avx512<true>, radar_avx512<false>, "avx512"};
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return KernelChoice{radar_avx2<true>, radar_avx2<false>, "avx2"};
+        }
+#endif
+        return KernelChoice{radar_scalar<true, false>, radar_scalar<false, false>, "scalar"};
+    }();
+    return choice;
+}
+
+} // anonymous namespace
+
+void RadarPredictionSoA::resize(std::size_t n) {
+    for (auto* v : {&rho, &phi, &rho_dot, &ux, &uy, &ax, &ay, &dx, &dy}) {
+        v->resize(n);
+    }
+}
+
+void RadarPredictionSoA::reserve(std::size_t n) {
+    for (auto* v : {&rho, &phi, &rho_dot, &ux, &uy, &ax, &ay, &dx, &dy}) {
+        v->reserve(n);
+    }
+}
+
+Eigen::Matrix<double, 3, 4> RadarPredictionSoA::H(std::size_t i) const {
+    Eigen::Matrix<double, 3, 4> h;
+    h << ux[i], uy[i], 0.0, 0.0,
+         ax[i], ay[i], 0.0, 0.0,
+         dx[i], dy[i], ux[i], uy[i];
+    return h;
+}
+
+void radar_predict_batch(const double* px, const double* py,
+                         const double* vx, const double* vy,
+                         std::size_t begin, std::size_t end,
+                         RadarPredictionSoA& out) {
+    const RadarArgs args{px, py, vx, vy,
+                         out.rho.data(), out.phi.data(), out.rho_dot.data(),
+                         out.ux.data(), out.uy.data(),
+                         out.ax.data(), out.ay.data(),
+                         out.dx.data(), out.dy.data()};
+    radar_kernel().fn(args, begin, end);
+}
+
+void radar_measurement_batch(const double* px, const double* py,
+                             const double* vx, const double* vy,
+                             std::size_t begin, std::size_t end,
+                             double* rho, double* phi, double* rho_dot) {
+    const RadarArgs args{px, py, vx, vy, rho, phi, rho_dot,
+                         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    radar_kernel().fn_meas(args, begin, end);
+}
+
+const char* radar_batch_backend() {
+    return radar_kernel().name;
+}
+
+} // namespace msf
@@ -72,13 +72,13 @@ Eigen::Matrix<double, 3, 4> radar_H_jacobian(const Vec4& x) {
 }
 
 double normalize_angle(double angle) {
-    while (angle > M_PI) {
-        angle -= 2.0 * M_PI;
-    }
-    while (angle < -M_PI) {
-        angle += 2.0 * M_PI;
-    }
-    return angle;
+    // angle - 2pi * round(angle / 2pi) (분기 / 반복 없음, 입력 크기와 무관하게 상수 시간)
+    // round 는 1.5 * 2^52 를 더했다 빼는 방식 (기본 rounding mode, |k| < 2^51 에서 정확)
+    constexpr double kTwoPi = 2.0 * M_PI;
+    constexpr double kInvTwoPi = 1.0 / kTwoPi;
+    constexpr double kRound = 6755399441055744.0;  // 1.5 * 2^52
+    const double k = (angle * kInvTwoPi + kRound) - kRound;
+    return angle - kTwoPi * k;
 }
 
 } // namespace msf
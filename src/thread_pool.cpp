@@ -0,0 +1,84 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+namespace msf {
+
+ThreadPool::ThreadPool(int num_threads)
+    : num_threads_(std::max(1, num_threads)) {
+    threads_.reserve(num_threads_ - 1);
+    for (int w = 1; w < num_threads_; ++w) {
+        threads_.emplace_back([this, w] { worker_loop(w); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+void ThreadPool::run_partition(int worker) {
+    const std::size_t begin = n_ * worker / num_threads_;
+    const std::size_t end = n_ * (worker + 1) / num_threads_;
+    if (begin < end) {
+        task_(ctx_, begin, end, worker);
+    }
+}
+
+void ThreadPool::run(std::size_t n, Task task, void* ctx) {
+    if (n == 0) {
+        return;
+    }
+    if (num_threads_ == 1) {
+        task(ctx, 0, n, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = task;
+        ctx_ = ctx;
+        n_ = n;
+        pending_ = num_threads_ - 1;
+        ++generation_;
+    }
+    start_cv_.notify_all();
+
+    run_partition(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ThreadPool::worker_loop(int worker) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        run_partition(worker);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = (--pending_ == 0);
+        }
+        if (last) {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+} // namespace msf
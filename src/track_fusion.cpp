@@ -0,0 +1,50 @@
+#include "track_fusion.hpp"
+
+#include <algorithm>
+#include <limits>
+#include "kalman_filter.hpp"
+
+namespace msf {
+
+namespace {
+
+using CvFilter = KalmanFilter<4>;
+
+} // anonymous namespace
+
+bool fuse_information(Vec4& x, Mat4& P, const Vec4& xb, const Mat4& Pb) {
+    const Vec4 y = xb - x;
+    return CvFilter::update_innovation<4>(x, P, y, Mat4::Identity(), Pb);
+}
+
+double covariance_intersection_weight(const Mat4& Pa, const Mat4& Pb) {
+    const double ta = Pa.trace();
+    const double tb = Pb.trace();
+    if (!(ta + tb > 0.0)) {
+        return 0.5;
+    }
+    return std::clamp(tb / (ta + tb), 0.05, 0.95);
+}
+
+bool fuse_covariance_intersection(Vec4& x, Mat4& P, const Vec4& xb, const Mat4& Pb) {
+    const double w = covariance_intersection_weight(P, Pb);
+    Mat4 Pa = P / w;
+    const Mat4 Rb = Pb / (1.0 - w);
+    const Vec4 y = xb - x;
+    if (!CvFilter::update_innovation<4>(x, Pa, y, Mat4::Identity(), Rb)) {
+        return false;
+    }
+    P = Pa;
+    return true;
+}
+
+double track_distance_sq(const Vec4& xa, const Mat4& Pa, const Vec4& xb, const Mat4& Pb) {
+    const Eigen::LDLT<Mat4> ldlt(Pa + Pb);
+    if (ldlt.info() != Eigen::Success || !ldlt.isPositive()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const Vec4 d = xb - xa;
+    return d.dot(ldlt.solve(d));
+}
+
+} // namespace msf
@@ -0,0 +1,342 @@
+#include "track_store.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MSFT_X86_DISPATCH 1
+#include <immintrin.h>
+#else
+#define MSFT_X86_DISPATCH 0
+#endif
+
+namespace msf {
+
+namespace {
+
+// predict kernel 인자: SoA 배열 포인터 + 구간 공통 계수
+struct PredictArgs {
+    double* x;
+    double* y;
+    double* vx;
+    double* vy;
+    double* p[TrackStoreSoA::kNumCov];
+    double dt;
+    double dt2;
+    double q11;  // dt^4/4 * sigma^2
+    double q13;  // dt^3/2 * sigma^2
+    double q33;  // dt^2   * sigma^2
+};
+
+// P' = F P F^T + Q 를 고유 원소 10개에 대해 전개한 식 (F: constant velocity)
+//   P'00 = p00 + 2dt p02 + dt^2 p22 + q11    P'01 = p01 + dt (p03 + p12) + dt^2 p23
+//   P'02 = p02 + dt p22 + q13                P'03 = p03 + dt p23
+//   P'11 = p11 + 2dt p13 + dt^2 p33 + q11    P'12 = p12 + dt p23
+//   P'13 = p13 + dt p33 + q13                P'22 = p22 + q33
+//   P'23 = p23                               P'33 = p33 + q33
+void predict_scalar(const PredictArgs& a, std::size_t begin, std::size_t end) {
+    using S = TrackStoreSoA;
+    const double dt = a.dt;
+    const double dt2 = a.dt2;
+    const double two_dt = 2.0 * dt;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        a.x[i] += dt * a.vx[i];
+        a.y[i] += dt * a.vy[i];
+
+        const double p00 = a.p[S::P00][i], p01 = a.p[S::P01][i];
+        const double p02 = a.p[S::P02][i], p03 = a.p[S::P03][i];
+        const double p11 = a.p[S::P11][i], p12 = a.p[S::P12][i];
+        const double p13 = a.p[S::P13][i], p22 = a.p[S::P22][i];
+        const double p23 = a.p[S::P23][i], p33 = a.p[S::P33][i];
+
+        a.p[S::P00][i] = p00 + two_dt * p02 + dt2 * p22 + a.q11;
+        a.p[S::P01][i] = p01 + dt * (p03 + p12) + dt2 * p23;
+        a.p[S::P02][i] = p02 + dt * p22 + a.q13;
+        a.p[S::P03][i] = p03 + dt * p23;
+        a.p[S::P11][i] = p11 + two_dt * p13 + dt2 * p33 + a.q11;
+        a.p[S::P12][i] = p12 + dt * p23;
+        a.p[S::P13][i] = p13 + dt * p33 + a.q13;
+        a.p[S::P22][i] = p22 + a.q33;
+        a.p[S::P33][i] = p33 + a.q33;
+    }
+}
+
+#if MSFT_X86_DISPATCH
+
+__attribute__((target("avx2")))
+void predict_avx2(const PredictArgs& a, std::size_t begin, std::size_t end) {
+    using S = TrackStoreSoA;
+    const __m256d dt = _mm256_set1_pd(a.dt);
+    const __m256d dt2 = _mm256_set1_pd(a.dt2);
+    const __m256d two_dt = _mm256_set1_pd(2.0 * a.dt);
+    const __m256d q11 = _mm256_set1_pd(a.q11);
+    const __m256d q13 = _mm256_set1_pd(a.q13);
+    const __m256d q33 = _mm256_set1_pd(a.q33);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        _mm256_storeu_pd(a.x + i, _mm256_add_pd(_mm256_loadu_pd(a.x + i),
+                                                _mm256_mul_pd(dt, _mm256_loadu_pd(a.vx + i))));
+        _mm256_storeu_pd(a.y + i, _mm256_add_pd(_mm256_loadu_pd(a.y + i),
+                                                _mm256_mul_pd(dt, _mm256_loadu_pd(a.vy + i))));
+
+        const __m256d p00 = _mm256_loadu_pd(a.p[S::P00] + i);
+        const __m256d p01 = _mm256_loadu_pd(a.p[S::P01] + i);
+        const __m256d p02 = _mm256_loadu_pd(a.p[S::P02] + i);
+        const __m256d p03 = _mm256_loadu_pd(a.p[S::P03] + i);
+        const __m256d p11 = _mm256_loadu_pd(a.p[S::P11] + i);
+        const __m256d p12 = _mm256_loadu_pd(a.p[S::P12] + i);
+        const __m256d p13 = _mm256_loadu_pd(a.p[S::P13] + i);
+        const __m256d p22 = _mm256_loadu_pd(a.p[S::P22] + i);
+        const __m256d p23 = _mm256_loadu_pd(a.p[S::P23] + i);
+        const __m256d p33 = _mm256_loadu_pd(a.p[S::P33] + i);
+
+        __m256d r;
+        r = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(p00, _mm256_mul_pd(two_dt, p02)),
+                                        _mm256_mul_pd(dt2, p22)), q11);
+        _mm256_storeu_pd(a.p[S::P00] + i, r);
+        r = _mm256_add_pd(_mm256_add_pd(p01, _mm256_mul_pd(dt, _mm256_add_pd(p03, p12))),
+                          _mm256_mul_pd(dt2, p23));
+        _mm256_storeu_pd(a.p[S::P01] + i, r);
+        r = _mm256_add_pd(_mm256_add_pd(p02, _mm256_mul_pd(dt, p22)), q13);
+        _mm256_storeu_pd(a.p[S::P02] + i, r);
+        r = _mm256_add_pd(p03, _mm256_mul_pd(dt, p23));
+        _mm256_storeu_pd(a.p[S::P03] + i, r);
+        r = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(p11, _mm256_mul_pd(two_dt, p13)),
+                                        _mm256_mul_pd(dt2, p33)), q11);
+        _mm256_storeu_pd(a.p[S::P11] + i, r);
+        r = _mm256_add_pd(p12, _mm256_mul_pd(dt, p23));
+        _mm256_storeu_pd(a.p[S::P12] + i, r);
+        r = _mm256_add_pd(_mm256_add_pd(p13, _mm256_mul_pd(dt, p33)), q13);
+        _mm256_storeu_pd(a.p[S::P13] + i, r);
+        _mm256_storeu_pd(a.p[S::P22] + i, _mm256_add_pd(p22, q33));
+        _mm256_storeu_pd(a.p[S::P33] + i, _mm256_add_pd(p33, q33));
+    }
+
+    predict_scalar(a, i, end);
+}
+
+__attribute__((target("avx512f")))
+void predict_avx512(const PredictArgs& a, std::size_t begin, std::size_t end) {
+    using S = TrackStoreSoA;
+    const __m512d dt = _mm512_set1_pd(a.dt);
+    const __m512d dt2 = _mm512_set1_pd(a.dt2);
+    const __m512d two_dt = _mm512_set1_pd(2.0 * a.dt);
+    const __m512d q11 = _mm512_set1_pd(a.q11);
+    const __m512d q13 = _mm512_set1_pd(a.q13);
+    const __m512d q33 = _mm512_set1_pd(a.q33);
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        _mm512_storeu_pd(a.x + i, _mm512_add_pd(_mm512_loadu_pd(a.x + i),
+                                                _mm512_mul_pd(dt, _mm512_loadu_pd(a.vx + i))));
+        _mm512_storeu_pd(a.y + i, _mm512_add_pd(_mm512_loadu_pd(a.y + i),
+                                                _mm512_mul_pd(dt, _mm512_loadu_pd(a.vy + i))));
+
+        const __m512d p00 = _mm512_loadu_pd(a.p[S::P00] + i);
+        const __m512d p01 = _mm512_loadu_pd(a.p[S::P01] + i);
+        const __m512d p02 = _mm512_loadu_pd(a.p[S::P02] + i);
+        const __m512d p03 = _mm512_loadu_pd(a.p[S::P03] + i);
+        const __m512d p11 = _mm512_loadu_pd(a.p[S::P11] + i);
+        const __m512d p12 = _mm512_loadu_pd(a.p[S::P12] + i);
+        const __m512d p13 = _mm512_loadu_pd(a.p[S::P13] + i);
+        const __m512d p22 = _mm512_loadu_pd(a.p[S::P22] + i);
+        const __m512d p23 = _mm512_loadu_pd(a.p[S::P23] + i);
+        const __m512d p33 = _mm512_loadu_pd(a.p[S::P33] + i);
+
+        __m512d r;
+        r = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(p00, _mm512_mul_pd(two_dt, p02)),
+                                        _mm512_mul_pd(dt2, p22)), q11);
+        _mm512_storeu_pd(a.p[S::P00] + i, r);
+        r = _mm512_add_pd(_mm512_add_pd(p01, _mm512_mul_pd(dt, _mm512_add_pd(p03, p12))),
+                          _mm512_mul_pd(dt2, p23));
+        _mm512_storeu_pd(a.p[S::P01] + i, r);
+        r = _mm512_add_pd(_mm512_add_pd(p02, _mm512_mul_pd(dt, p22)), q13);
+        _mm512_storeu_pd(a.p[S::P02] + i, r);
+        r = _mm512_add_pd(p03, _mm512_mul_pd(dt, p23));
+        _mm512_storeu_pd(a.p[S::P03] + i, r);
+        r = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(p11, _mm512_mul_pd(two_dt, p13)),
+                                        _mm512_mul_pd(dt2, p33)), q11);
+        _mm512_storeu_pd(a.p[S::P11] + i, r);
+        r = _mm512_add_pd(p12, _mm512_mul_pd(dt, p23));
+        _mm512_storeu_pd(a.p[S::P12] + i, r);
+        r = _mm512_add_pd(_mm512_add_pd(p13, _mm512_mul_pd(dt, p33)), q13);
+        _mm512_storeu_pd(a.p[S::P13] + i, r);
+        _mm512_storeu_pd(a.p[S::P22] + i, _mm512_add_pd(p22, q33));
+        _mm512_storeu_pd(a.p[S::P33] + i, _mm512_add_pd(p33, q33));
+    }
+
+    predict_scalar(a, i, end);
+}
+
+#endif // MSFT_X86_DISPATCH
+
+using PredictKernel = void (*)(const PredictArgs&, std::size_t, std::size_t);
+
+struct KernelChoice {
+    PredictKernel fn;
+    const char* name;
+};
+
+// 실행 중인 CPU 기능에 맞춰 한 번만 kernel 선택
+const KernelChoice& predict_kernel() {
+    static const KernelChoice choice = [] {
+#if MSFT_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return KernelChoice{predict_avx512, "avx512"};
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return KernelChoice{predict_avx2, "avx2"};
+        }
+#endif
+        return KernelChoice{predict_scalar, "scalar"};
+    }();
+    return choice;
+}
+
+} // anonymous namespace
+
+void TrackStoreSoA::clear() {
+    x_.clear();
+    y_.clear();
+    vx_.clear();
+    vy_.clear();
+    for (auto& p : p_) p.clear();
+    last_ts_.clear();
+}
+
+void TrackStoreSoA::reserve(std::size_t n) {
+    x_.reserve(n);
+    y_.reserve(n);
+    vx_.reserve(n);
+    vy_.reserve(n);
+    for (auto& p : p_) p.reserve(n);
+    last_ts_.reserve(n);
+}
+
+void TrackStoreSoA::push_back(const Vec4& x, const Mat4& P, double last_timestamp) {
+    x_.push_back(x(0));
+    y_.push_back(x(1));
+    vx_.push_back(x(2));
+    vy_.push_back(x(3));
+    p_[P00].push_back(P(0, 0));
+    p_[P01].push_back(P(0, 1));
+    p_[P02].push_back(P(0, 2));
+    p_[P03].push_back(P(0, 3));
+    p_[P11].push_back(P(1, 1));
+    p_[P12].push_back(P(1, 2));
+    p_[P13].push_back(P(1, 3));
+    p_[P22].push_back(P(2, 2));
+    p_[P23].push_back(P(2, 3));
+    p_[P33].push_back(P(3, 3));
+    last_ts_.push_back(last_timestamp);
+}
+
+void TrackStoreSoA::load(std::size_t i, Vec4& x, Mat4& P) const {
+    x << x_[i], y_[i], vx_[i], vy_[i];
+    P << p_[P00][i], p_[P01][i], p_[P02][i], p_[P03][i],
+         p_[P01][i], p_[P11][i], p_[P12][i], p_[P13][i],
+         p_[P02][i], p_[P12][i], p_[P22][i], p_[P23][i],
+         p_[P03][i], p_[P13][i], p_[P23][i], p_[P33][i];
+}
+
+void TrackStoreSoA::store(std::size_t i, const Vec4& x, const Mat4& P) {
+    x_[i] = x(0);
+    y_[i] = x(1);
+    vx_[i] = x(2);
+    vy_[i] = x(3);
+    // 상삼각만 보관 (P 는 대칭이라고 가정)
+    p_[P00][i] = P(0, 0);
+    p_[P01][i] = P(0, 1);
+    p_[P02][i] = P(0, 2);
+    p_[P03][i] = P(0, 3);
+    p_[P11][i] = P(1, 1);
+    p_[P12][i] = P(1, 2);
+    p_[P13][i] = P(1, 3);
+    p_[P22][i] = P(2, 2);
+    p_[P23][i] = P(2, 3);
+    p_[P33][i] = P(3, 3);
+}
+
+void TrackStoreSoA::compact(const std::vector<char>& keep) {
+    const std::size_t n = size();
+    std::size_t w = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!keep[i]) continue;
+        if (w != i) {
+            x_[w] = x_[i];
+            y_[w] = y_[i];
+            vx_[w] = vx_[i];
+            vy_[w] = vy_[i];
+            for (auto& p : p_) p[w] = p[i];
+            last_ts_[w] = last_ts_[i];
+        }
+        ++w;
+    }
+    x_.resize(w);
+    y_.resize(w);
+    vx_.resize(w);
+    vy_.resize(w);
+    for (auto& p : p_) p.resize(w);
+    last_ts_.resize(w);
+}
+
+void TrackStoreSoA::predict(double timestamp, double sigma_a) {
+    predict(timestamp, sigma_a, 0, size());
+}
+
+void TrackStoreSoA::predict(double timestamp, double sigma_a,
+                            std::size_t begin, std::size_t end) {
+    PredictArgs args;
+    args.x = x_.data();
+    args.y = y_.data();
+    args.vx = vx_.data();
+    args.vy = vy_.data();
+    for (int k = 0; k < kNumCov; ++k) {
+        args.p[k] = p_[k].data();
+    }
+
+    const PredictKernel kernel = predict_kernel().fn;
+    const double sigma2 = sigma_a * sigma_a;
+
+    // dt 가 같은 연속 구간 [i, j) 단위로 Q 계산 후 kernel 호출
+    auto dt_of = [&](std::size_t i) {
+        double dt = 0.0;
+        if (last_ts_[i] > 0.0) {
+            dt = timestamp - last_ts_[i];
+        }
+        if (dt <= 0.0) {
+            dt = 1e-3; // 너무 작은 dt 방지
+        }
+        return dt;
+    };
+
+    std::size_t i = begin;
+    while (i < end) {
+        const double dt = dt_of(i);
+        std::size_t j = i + 1;
+        while (j < end && dt_of(j) == dt) {
+            ++j;
+        }
+
+        const double dt2 = dt * dt;
+        const double dt3 = dt2 * dt;
+        const double dt4 = dt3 * dt;
+        args.dt = dt;
+        args.dt2 = dt2;
+        args.q11 = dt4 / 4.0 * sigma2;
+        args.q13 = dt3 / 2.0 * sigma2;
+        args.q33 = dt2 * sigma2;
+        kernel(args, i, j);
+
+        for (std::size_t k = i; k < j; ++k) {
+            last_ts_[k] = timestamp;
+        }
+        i = j;
+    }
+}
+
+const char* TrackStoreSoA::simd_backend() {
+    return predict_kernel().name;
+}
+
+} // namespace msf
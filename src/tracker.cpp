@@ -1,10 +1,15 @@
 #include "tracker.hpp"
 #include "sensor_models.hpp"
 #include "data_association.hpp"
+#include "gating.hpp"
+#include "kalman_filter.hpp"
+#include "thread_pool.hpp"
+#include "track_fusion.hpp"
 
 #include <Eigen/Dense>
 #include <limits>
 #include <algorithm>
+#include <cmath>
 
 namespace msf {
 
@@ -58,204 +63,1565 @@ Eigen::Matrix3d make_radar_R(double sigma_r, double sigma_angle, double sigma_vr
     return R;
 }
 
-// Mahalanobis 거리 제곱 계산
-double mahalanobis_sq(const Eigen::VectorXd& y, const Eigen::MatrixXd& S) {
-    Eigen::MatrixXd S_inv = S.inverse();
-    double d2 = y.transpose() * S_inv * y;
-    return d2;
+using CvFilter = KalmanFilter<4>;
+
+// track 과 detection 한 쌍의 Mahalanobis 거리 제곱 (측정 차원이 맞지 않으면 inf)
+// z_pred, H, S 분해는 cache 에서 읽으므로 쌍마다 innovation 과 삼각 solve 만 남는다
+double pair_cost(const MeasurementCache& cache, const DetectionBatch& dets, int j) {
+    if (dets.sensor(j) == SensorType::Camera) {
+        if (dets.dim(j) != 2) return std::numeric_limits<double>::infinity();
+        const Eigen::Vector2d y = dets.camera_z(j) - cache.camera.z_pred;
+        return cache.camera.mahalanobis_sq(y);
+    }
+
+    // Radar
+    if (dets.dim(j) != 3) return std::numeric_limits<double>::infinity();
+    Eigen::Vector3d y = dets.radar_z(j) - cache.radar.z_pred;
+    // 각도 차이 normalize
+    y(1) = normalize_angle(y(1));
+    return cache.radar.mahalanobis_sq(y);
+}
+
+// 대칭 2x2 행렬 [[a, b], [b, d]] 의 최대 고유값
+double max_eigenvalue_2x2(double a, double b, double d) {
+    const double half_tr = 0.5 * (a + d);
+    const double half_diff = 0.5 * (a - d);
+    return half_tr + std::sqrt(half_diff * half_diff + b * b);
 }
 
 } // anonymous namespace
 
 MultiSensorTracker::MultiSensorTracker(const TrackerParams& params)
-    : params_(params) {}
+    : params_(params),
+      imm_(params),
+      cam_grid_(params.gating_cell_size),
+      radar_grid_(params.gating_cell_size),
+      pool_(std::make_unique<ThreadPool>(params.num_threads)),
+      gate_scratch_(pool_->size()),
+      arena_(params.frame_arena_bytes),
+      fusion_grid_(params.gating_cell_size) {
+    ukf_w_ = UkfWeights::make(params_.ukf_alpha, params_.ukf_beta, params_.ukf_kappa);
+    if (params_.track_capacity > 0) {
+        const size_t cap = static_cast<size_t>(params_.track_capacity);
+        tracks_.reserve(cap);
+        keep_.reserve(cap);
+        meas_cache_.reserve(cap);
+        radar_px_.reserve(cap);
+        radar_py_.reserve(cap);
+        radar_vx_.reserve(cap);
+        radar_vy_.reserve(cap);
+        radar_pred_.reserve(cap);
+        if (params_.radar_filter == RadarFilter::UKF) {
+            for (auto* v : {&sigma_px_, &sigma_py_, &sigma_vx_, &sigma_vy_,
+                            &sigma_rho_, &sigma_phi_, &sigma_rho_dot_}) {
+                v->reserve(cap * kUkfSigmaPoints);
+            }
+        }
+        retro_.reserve(cap);
+        retro_valid_.reserve(cap);
+        if (params_.track_storage == TrackStorage::SoA) {
+            soa_.reserve(cap);
+        }
+        if (params_.motion_model == MotionModel::IMM) {
+            imm_.reserve(cap);
+        }
+        if (params_.oosm_history_size > 0) {
+            history_.reserve(cap);
+            history_pool_.reserve(cap);
+        }
+    }
+    if (params_.association_method == AssociationMethod::MHT) {
+        mht_ = std::make_unique<MhtEngine>(params_);
+    }
+}
+
+void MultiSensorTracker::build_measurement_cache(const std::vector<TrackState>& tracks,
+                                                 const DetectionBatch& detections,
+                                                 const Eigen::Matrix2d& R_cam,
+                                                 const Eigen::Matrix3d& R_rad) {
+    bool has_cam = false;
+    bool has_radar = false;
+    for (size_t j = 0; j < detections.size() && !(has_cam && has_radar); ++j) {
+        if (detections.sensor(j) == SensorType::Camera) {
+            has_cam = true;
+        } else {
+            has_radar = true;
+        }
+    }
+
+    const size_t n_tracks = tracks.size();
+    meas_cache_.resize(n_tracks);
+    const bool ukf = params_.radar_filter == RadarFilter::UKF;
+    if (has_radar && ukf) {
+        for (auto* v : {&sigma_px_, &sigma_py_, &sigma_vx_, &sigma_vy_,
+                        &sigma_rho_, &sigma_phi_, &sigma_rho_dot_}) {
+            v->resize(n_tracks * kUkfSigmaPoints);
+        }
+    } else if (has_radar) {
+        radar_px_.resize(n_tracks);
+        radar_py_.resize(n_tracks);
+        radar_vx_.resize(n_tracks);
+        radar_vy_.resize(n_tracks);
+        radar_pred_.resize(n_tracks);
+    }
+    pool_->parallel_for(n_tracks, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i) {
+            if (has_cam) {
+                meas_cache_[i].compute_camera(tracks[i].x, tracks[i].P, R_cam);
+            }
+        }
+        if (!has_radar) {
+            return;
+        }
+        if (ukf) {
+            build_radar_unscented(tracks, begin, end, R_rad);
+            return;
+        }
+
+        // radar h(x), H 는 SoA 로 모아서 batch kernel (sqrt / atan2 / 나눗셈을 SIMD 로)
+        for (size_t i = begin; i < end; ++i) {
+            radar_px_[i] = tracks[i].x(0);
+            radar_py_[i] = tracks[i].x(1);
+            radar_vx_[i] = tracks[i].x(2);
+            radar_vy_[i] = tracks[i].x(3);
+        }
+        radar_predict_batch(radar_px_.data(), radar_py_.data(), radar_vx_.data(),
+                            radar_vy_.data(), begin, end, radar_pred_);
+        for (size_t i = begin; i < end; ++i) {
+            auto& radar = meas_cache_[i].radar;
+            radar.z_pred = radar_pred_.z(i);
+            radar.H = radar_pred_.H(i);
+            radar.factorize(tracks[i].P, R_rad);
+        }
+    });
+    MSFT_STATS_COUNT(stats_, factorizations, n_tracks * (int(has_cam) + int(has_radar)));
+}
+
+void MultiSensorTracker::build_radar_unscented(const std::vector<TrackState>& tracks,
+                                               size_t begin, size_t end,
+                                               const Eigen::Matrix3d& R_rad) {
+    constexpr size_t m = kUkfSigmaPoints;
+
+    // 구간의 모든 track 의 sigma point 를 한 배열로 모아 batch kernel 한 번으로 h(X) 계산
+    for (size_t i = begin; i < end; ++i) {
+        const bool ok = generate_sigma_points(tracks[i].x, tracks[i].P, ukf_w_,
+                                              &sigma_px_[m * i], &sigma_py_[m * i],
+                                              &sigma_vx_[m * i], &sigma_vy_[m * i]);
+        meas_cache_[i].radar.valid = ok;
+    }
+    radar_measurement_batch(sigma_px_.data(), sigma_py_.data(), sigma_vx_.data(),
+                            sigma_vy_.data(), m * begin, m * end,
+                            sigma_rho_.data(), sigma_phi_.data(), sigma_rho_dot_.data());
+    for (size_t i = begin; i < end; ++i) {
+        auto& radar = meas_cache_[i].radar;
+        if (!radar.valid) {
+            continue;
+        }
+        const size_t o = m * i;
+        radar_unscented_moments(&sigma_px_[o], &sigma_py_[o], &sigma_vx_[o], &sigma_vy_[o],
+                                &sigma_rho_[o], &sigma_phi_[o], &sigma_rho_dot_[o],
+                                ukf_w_, R_rad, radar);
+    }
+}
+
+void MultiSensorTracker::gate_candidates(const std::vector<TrackState>& tracks,
+                                         const DetectionBatch& detections,
+                                         const Eigen::Matrix2d& R_cam,
+                                         const Eigen::Matrix3d& R_rad) {
+    const int n_tracks = static_cast<int>(tracks.size());
+    const int n_dets   = static_cast<int>(detections.size());
+    const double gate = params_.max_association_maha_dist;
+
+    candidates_.clear();
+
+    // 센서별로 게이트 크기가 크게 다르므로 (radar 는 거리에 비례해 각도 오차가 커짐)
+    // camera / radar detection 을 각각 다른 격자에 넣는다
+    cam_pos_.clear();
+    cam_idx_.clear();
+    radar_pos_.clear();
+    radar_idx_.clear();
+    for (int j = 0; j < n_dets; ++j) {
+        const Eigen::Vector2d p(detections.pos_x(j), detections.pos_y(j));
+        if (detections.sensor(j) == SensorType::Camera) {
+            cam_pos_.push_back(p);
+            cam_idx_.push_back(j);
+        } else {
+            radar_pos_.push_back(p);
+            radar_idx_.push_back(j);
+        }
+    }
+    cam_grid_.build(cam_pos_);
+    radar_grid_.build(radar_pos_);
+
+    // 측정 노이즈를 Cartesian 위치 분산으로 근사할 때 쓰는 값
+    const double cam_var = R_cam(0, 0);
+    const double range_var = R_rad(0, 0);
+    const double angle_var = R_rad(1, 1);
+
+    // track 행 단위로 나눠 병렬 처리. worker 별 후보를 worker 순서대로 이어붙이면
+    // 단일 스레드와 같은 순서가 된다
+    for (auto& scratch : gate_scratch_) {
+        scratch.candidates.clear();
+        scratch.evaluated = 0;
+        // 한 번의 격자 질의 결과는 detection 수를 넘지 않으므로 미리 확보 (프레임 중 재할당 방지)
+        if (scratch.query.capacity() < static_cast<size_t>(n_dets)) {
+            scratch.query.reserve(n_dets + n_dets / 2);
+        }
+    }
+
+    pool_->parallel_for(n_tracks, [&](size_t begin, size_t end, int worker) {
+        auto& scratch = gate_scratch_[worker];
+
+        for (size_t i = begin; i < end; ++i) {
+            const auto& track = tracks[i];
+            const auto& cache = meas_cache_[i];
+            const double px = track.x(0);
+            const double py = track.x(1);
+
+            // 게이트 타원(S = P_pos + R)을 감싸는 원의 반경:
+            // d2 <= gate 이면 |dp|^2 <= gate * lambda_max(S) 이므로 이 원 밖은 볼 필요 없음
+            const double lambda_p = max_eigenvalue_2x2(track.P(0, 0), track.P(0, 1), track.P(1, 1));
+            const double range_sq = px * px + py * py;
+            const double cam_radius = std::sqrt(gate * (lambda_p + cam_var));
+            const double radar_radius =
+                std::sqrt(gate * (lambda_p + std::max(range_var, range_sq * angle_var)));
+
+            scratch.query.clear();
+            cam_grid_.query(px, py, cam_radius, scratch.query);
+            scratch.evaluated += scratch.query.size();
+            for (int k : scratch.query) {
+                const int j = cam_idx_[k];
+                const double d2 = pair_cost(cache, detections, j);
+                if (d2 <= gate) {
+                    scratch.candidates.push_back({static_cast<int>(i), j, d2});
+                }
+            }
+
+            scratch.query.clear();
+            radar_grid_.query(px, py, radar_radius, scratch.query);
+            scratch.evaluated += scratch.query.size();
+            for (int k : scratch.query) {
+                const int j = radar_idx_[k];
+                const double d2 = pair_cost(cache, detections, j);
+                if (d2 <= gate) {
+                    scratch.candidates.push_back({static_cast<int>(i), j, d2});
+                }
+            }
+        }
+    });
+
+    // 빈 vector 에 insert 하면 용량이 정확히 필요한 만큼만 늘어 최대치가 갱신될 때마다
+    // 재할당되므로 여유를 두고 확보
+    size_t n_candidates = 0;
+    for (const auto& scratch : gate_scratch_) {
+        n_candidates += scratch.candidates.size();
+    }
+    if (candidates_.capacity() < n_candidates) {
+        candidates_.reserve(2 * n_candidates);
+    }
+    for (const auto& scratch : gate_scratch_) {
+        candidates_.insert(candidates_.end(),
+                           scratch.candidates.begin(), scratch.candidates.end());
+        MSFT_STATS_COUNT(stats_, pairs_evaluated, scratch.evaluated);
+    }
+    MSFT_STATS_COUNT(stats_, pairs_gated, candidates_.size());
+}
 
 void MultiSensorTracker::predict(double timestamp) {
-    for (auto& track : tracks_) {
-        double dt = 0.0;
-        if (track.last_timestamp > 0.0) {
-            dt = timestamp - track.last_timestamp;
+    MSFT_STATS_SCOPE(stats_, TrackerStage::Predict);
+
+    if (params_.oosm_history_size > 0) {
+        // OOSM 모드에서는 시간을 되돌리지 않는다 (늦은 측정은 update 에서 retrodiction 처리)
+        if (timestamp <= latest_time_) {
+            return;
         }
-        if (dt <= 0.0) {
-            dt = 1e-3; // 너무 작은 dt 방지
+        latest_time_ = timestamp;
+    }
+    predict_time_ = timestamp;
+
+    if (mht_) {
+        // MHT 는 CV 모델 AoS 경로만: 모든 leaf (track hypothesis) 를 예측, tracks_ 는 출력 view
+        auto& leaves = mht_->leaves();
+        pool_->parallel_for(leaves.size(), [&](size_t begin, size_t end, int) {
+            for (size_t i = begin; i < end; ++i) {
+                predict_track(leaves[i], timestamp);
+            }
+        });
+        for (auto& track : tracks_) {
+            predict_track(track, timestamp);
         }
+        return;
+    }
 
-        // F 구성
-        Mat4 F = Mat4::Identity();
-        F(0, 2) = dt;
-        F(1, 3) = dt;
+    if (params_.motion_model == MotionModel::IMM) {
+        // 모델별 mixing + predict 후 결합 추정을 tracks_ 에 기록
+        const bool use_soa = params_.track_storage == TrackStorage::SoA;
+        pool_->parallel_for(tracks_.size(), [&](size_t begin, size_t end, int) {
+            imm_.predict(tracks_.data(), begin, end, timestamp);
+            for (size_t i = begin; i < end; ++i) {
+                auto& track = tracks_[i];
+                track.age += 1;
+                track.last_timestamp = timestamp;
+                if (use_soa) {
+                    soa_.store(i, track.x, track.P);
+                }
+            }
+        });
+        return;
+    }
 
-        Mat4 Q = make_process_noise(dt, params_.process_noise_std);
+    if (params_.track_storage == TrackStorage::SoA) {
+        // SoA batched kernel 로 예측한 뒤 AoS view(tracks_) 의 x, P 를 갱신
+        pool_->parallel_for(tracks_.size(), [&](size_t begin, size_t end, int) {
+            soa_.predict(timestamp, params_.process_noise_std, begin, end);
+            for (size_t i = begin; i < end; ++i) {
+                auto& track = tracks_[i];
+                soa_.load(i, track.x, track.P);
+                track.age += 1;
+                track.last_timestamp = timestamp;
+            }
+        });
+        return;
+    }
 
-        track.x = F * track.x;
-        track.P = F * track.P * F.transpose() + Q;
+    pool_->parallel_for(tracks_.size(), [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i) {
+            predict_track(tracks_[i], timestamp);
+        }
+    });
+}
 
-        track.age += 1;
-        track.last_timestamp = timestamp;
+void MultiSensorTracker::predict_track(TrackState& track, double timestamp) const {
+    double dt = 0.0;
+    if (track.last_timestamp > 0.0) {
+        dt = timestamp - track.last_timestamp;
+    }
+    if (dt <= 0.0) {
+        dt = 1e-3; // 너무 작은 dt 방지
     }
+
+    predict_state(track.x, track.P, dt);
+
+    track.age += 1;
+    track.last_timestamp = timestamp;
+}
+
+void MultiSensorTracker::predict_state(Vec4& x, Mat4& P, double dt) const {
+    // F 구성
+    Mat4 F = Mat4::Identity();
+    F(0, 2) = dt;
+    F(1, 3) = dt;
+
+    Mat4 Q = make_process_noise(dt, params_.process_noise_std);
+
+    CvFilter::predict(x, P, F, Q);
 }
 
 void MultiSensorTracker::update(const std::vector<Detection>& detections) {
+    // 내부 batch 로 옮겨서 처리 (batch 는 재사용되므로 steady state 에서 할당 없음)
+    batch_.clear();
+    for (const auto& det : detections) {
+        batch_.push_back(det);
+    }
+    update(batch_);
+}
+
+void MultiSensorTracker::update(const DetectionBatch& detections) {
+    arena_.reset();
+    MSFT_STATS_BEGIN_FRAME(stats_);
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Frame);
+        MSFT_STATS_COUNT(stats_, detections, detections.size());
+
+        if (params_.oosm_history_size > 0 && !mht_) {
+            // 이미 지나간 시각의 detection (늦게 도착한 패킷) 은 따로 모아 retrodiction 처리
+            in_seq_.clear();
+            late_.clear();
+            for (size_t j = 0; j < detections.size(); ++j) {
+                if (detections.timestamp(j) < latest_time_ - 1e-9) {
+                    late_.push_back(detections.at(j));
+                } else {
+                    in_seq_.push_back(detections.at(j));
+                }
+            }
+            // 늦은 detection 만 온 batch (재전송 패킷 등) 는 현재 프레임이 아니므로
+            // 빈 in-sequence pass 로 모든 track 의 missed 를 올리지 않는다
+            if (!in_seq_.empty() || late_.empty()) {
+                update_in_sequence(in_seq_);
+            }
+            update_late(late_);
+        } else {
+            update_in_sequence(detections);
+        }
+
+        prune_tracks();
+    }
+    MSFT_STATS_END_FRAME(stats_, tracks_.size());
+}
+
+void MultiSensorTracker::update_tracks(const std::vector<SensorTrack>& objects) {
+    arena_.reset();
+    MSFT_STATS_BEGIN_FRAME(stats_);
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Frame);
+        MSFT_STATS_COUNT(stats_, detections, objects.size());
+
+        // 센서 순서로 처리 (같은 센서 안에서는 입력 순서, stable_sort 대신 index 로 tie-break)
+        fusion_order_.resize(objects.size());
+        for (size_t k = 0; k < objects.size(); ++k) {
+            fusion_order_[k] = static_cast<int>(k);
+        }
+        std::sort(fusion_order_.begin(), fusion_order_.end(), [&](int a, int b) {
+            if (objects[a].sensor_id != objects[b].sensor_id) {
+                return objects[a].sensor_id < objects[b].sensor_id;
+            }
+            return a < b;
+        });
+
+        // 어느 센서와도 매칭되지 않은 track 만 missed 가 남도록 한 번만 올려 둔다
+        // (MHT 는 센서 그룹 하나가 scan 하나이고 missed 도 MhtEngine 이 센다)
+        if (!mht_) {
+            for (auto& track : tracks_) {
+                track.missed += 1;
+            }
+        }
+
+        size_t g = 0;
+        while (g < fusion_order_.size()) {
+            const int sensor = objects[fusion_order_[g]].sensor_id;
+            fusion_group_.clear();
+            while (g < fusion_order_.size() && objects[fusion_order_[g]].sensor_id == sensor) {
+                SensorTrack o = objects[fusion_order_[g]];
+                if (o.timestamp < predict_time_) {
+                    predict_state(o.x, o.P, predict_time_ - o.timestamp);
+                    o.timestamp = predict_time_;
+                }
+                fusion_group_.push_back(o);
+                ++g;
+            }
+            fuse_sensor_group(fusion_group_);
+        }
+
+        prune_tracks();
+    }
+    MSFT_STATS_END_FRAME(stats_, tracks_.size());
+}
+
+void MultiSensorTracker::gate_sensor_objects(const std::vector<TrackState>& tracks,
+                                             const std::vector<SensorTrack>& group) {
+    const int n_obj = static_cast<int>(group.size());
+    const double gate = params_.track_fusion_gate;
+
+    // object 위치 격자 + 4 차원 상태 차이의 Mahalanobis 게이트
+    // 위치 성분만의 거리가 전체 거리보다 작으므로 위치 공분산으로 잡은 원 밖은 볼 필요 없음
+    fusion_pos_.clear();
+    double obj_var = 0.0;
+    for (const auto& o : group) {
+        fusion_pos_.emplace_back(o.x(0), o.x(1));
+        obj_var = std::max(obj_var, max_eigenvalue_2x2(o.P(0, 0), o.P(0, 1), o.P(1, 1)));
+    }
+    fusion_grid_.build(fusion_pos_);
+
+    candidates_.clear();
+    for (auto& scratch : gate_scratch_) {
+        scratch.candidates.clear();
+        scratch.evaluated = 0;
+        if (scratch.query.capacity() < static_cast<size_t>(n_obj)) {
+            scratch.query.reserve(n_obj + n_obj / 2);
+        }
+    }
+    pool_->parallel_for(tracks.size(), [&](size_t begin, size_t end, int worker) {
+        auto& scratch = gate_scratch_[worker];
+        for (size_t i = begin; i < end; ++i) {
+            const auto& track = tracks[i];
+            const double lambda_p =
+                max_eigenvalue_2x2(track.P(0, 0), track.P(0, 1), track.P(1, 1));
+            const double radius = std::sqrt(gate * (lambda_p + obj_var));
+
+            scratch.query.clear();
+            fusion_grid_.query(track.x(0), track.x(1), radius, scratch.query);
+            scratch.evaluated += scratch.query.size();
+            for (int j : scratch.query) {
+                // 위치 성분만의 Mahalanobis 거리 (2x2 닫힌 식) 로 먼저 거름
+                // (부분 벡터의 거리는 전체 거리 이하이므로 놓치는 쌍은 없다)
+                const Mat4& Pj = group[j].P;
+                const double a = track.P(0, 0) + Pj(0, 0);
+                const double b = track.P(0, 1) + Pj(0, 1);
+                const double d = track.P(1, 1) + Pj(1, 1);
+                const double dx = group[j].x(0) - track.x(0);
+                const double dy = group[j].x(1) - track.x(1);
+                const double det = a * d - b * b;
+                if (det > 0.0 && d * dx * dx - 2.0 * b * dx * dy + a * dy * dy > gate * det) {
+                    continue;
+                }
+                const double d2 =
+                    track_distance_sq(track.x, track.P, group[j].x, group[j].P);
+                if (d2 <= gate) {
+                    scratch.candidates.push_back({static_cast<int>(i), j, d2});
+                }
+            }
+        }
+    });
+    for (const auto& scratch : gate_scratch_) {
+        candidates_.insert(candidates_.end(),
+                           scratch.candidates.begin(), scratch.candidates.end());
+        MSFT_STATS_COUNT(stats_, pairs_evaluated, scratch.evaluated);
+    }
+    MSFT_STATS_COUNT(stats_, pairs_gated, candidates_.size());
+}
+
+void MultiSensorTracker::fuse_sensor_group(const std::vector<SensorTrack>& group) {
+    if (mht_) {
+        fuse_sensor_group_mht(group);
+        return;
+    }
+
+    const int n_tracks = static_cast<int>(tracks_.size());
+    const int n_obj = static_cast<int>(group.size());
+    const double gate = params_.track_fusion_gate;
+
+    AssociationResult assoc(&arena_);
+    if (n_tracks > 0) {
+        {
+            MSFT_STATS_SCOPE(stats_, TrackerStage::Gating);
+            gate_sensor_objects(tracks_, group);
+        }
+
+        {
+            MSFT_STATS_SCOPE(stats_, TrackerStage::Association);
+            assoc = associate(n_tracks, n_obj, gate);
+        }
+
+        MSFT_STATS_SCOPE(stats_, TrackerStage::TrackFusion);
+        const bool ci = params_.track_fusion_method == TrackFusionMethod::CovarianceIntersection;
+        const bool use_soa = params_.track_storage == TrackStorage::SoA;
+        const bool use_imm = params_.motion_model == MotionModel::IMM;
+        pool_->parallel_for(n_tracks, [&](size_t begin, size_t end, int) {
+            for (size_t i = begin; i < end; ++i) {
+                const int j = assoc.track_assignment[i];
+                if (j < 0) continue;
+
+                auto& track = tracks_[i];
+                const Vec4 x_prior = track.x;
+                const Mat4 P_prior = track.P;
+                const bool ok = ci ? fuse_covariance_intersection(track.x, track.P,
+                                                                  group[j].x, group[j].P)
+                                   : fuse_information(track.x, track.P, group[j].x, group[j].P);
+                if (!ok) continue;
+
+                if (use_imm) {
+                    imm_.apply_correction(i, x_prior, P_prior, track.x, track.P);
+                }
+                if (use_soa) {
+                    soa_.store(i, track.x, track.P);
+                }
+                track.missed = 0;
+                if (!track.confirmed && track.age >= params_.min_hits_to_confirm) {
+                    track.confirmed = true;
+                }
+            }
+        });
+        MSFT_STATS_COUNT(stats_, tracks_fused, n_tracks - assoc.unassigned_tracks.size());
+    } else {
+        assoc.unassigned_detections.resize(n_obj);
+        for (int j = 0; j < n_obj; ++j) {
+            assoc.unassigned_detections[j] = j;
+        }
+    }
+
+    MSFT_STATS_SCOPE(stats_, TrackerStage::Birth);
+    for (int j : assoc.unassigned_detections) {
+        create_track(group[j].x, group[j].P, group[j].timestamp);
+    }
+}
+
+void MultiSensorTracker::fuse_sensor_group_mht(const std::vector<SensorTrack>& group) {
+    auto& leaves = mht_->leaves();
+    const size_t n_obj = group.size();
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Gating);
+        gate_sensor_objects(leaves, group);
+    }
+
+    // 후보 쌍 likelihood = P_D N(xb - xa; 0, Pa + Pb) / clutter 밀도, posterior 는 그 object 와 융합한 상태
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::TrackFusion);
+        const bool ci = params_.track_fusion_method == TrackFusionMethod::CovarianceIntersection;
+        const double norm = params_.detection_prob /
+                            (4.0 * M_PI * M_PI * params_.track_fusion_clutter_density);
+        const size_t n_cand = candidates_.size();
+        if (pair_likelihood_.capacity() < n_cand) {
+            pair_likelihood_.reserve(2 * n_cand);
+        }
+        if (mht_post_.capacity() < n_cand) {
+            mht_post_.reserve(2 * n_cand);
+        }
+        pair_likelihood_.resize(n_cand);
+        mht_post_.resize(n_cand);
+        pool_->parallel_for(n_cand, [&](size_t begin, size_t end, int) {
+            for (size_t k = begin; k < end; ++k) {
+                const auto& c = candidates_[k];
+                const auto& o = group[c.det];
+                auto& post = mht_post_[k];
+                post.x = leaves[c.track].x;
+                post.P = leaves[c.track].P;
+                const double det_S = (post.P + o.P).determinant();
+                const double g = norm * std::exp(-0.5 * c.cost) / std::sqrt(det_S);
+                pair_likelihood_[k] = std::max(g, std::numeric_limits<double>::min());
+                // 융합 실패 (게이트를 통과했으니 드묾) 면 leaf 상태를 그대로 둔다
+                if (ci) {
+                    fuse_covariance_intersection(post.x, post.P, o.x, o.P);
+                } else {
+                    fuse_information(post.x, post.P, o.x, o.P);
+                }
+            }
+        });
+        MSFT_STATS_COUNT(stats_, tracks_fused, n_cand);
+    }
+
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Birth);
+        if (mht_birth_.capacity() < n_obj) {
+            mht_birth_.reserve(2 * n_obj);
+        }
+        mht_birth_.resize(n_obj);
+        for (size_t j = 0; j < n_obj; ++j) {
+            mht_birth_[j].x = group[j].x;
+            mht_birth_[j].P = group[j].P;
+            mht_birth_[j].last_timestamp = group[j].timestamp;
+        }
+    }
+
+    run_mht_scan();
+}
+
+AssociationResult MultiSensorTracker::associate(int n_tracks, int n_dets, double max_cost) {
+    // 늦은 detection 과 update_tracks() 는 하나의 짝이 필요하므로 JPDA 도 최적 할당으로
+    if (params_.association_method != AssociationMethod::Greedy) {
+        return associate_optimal(candidates_, n_tracks, n_dets, max_cost, &arena_);
+    }
+    return associate_greedy(candidates_, n_tracks, n_dets, max_cost, &arena_);
+}
+
+void MultiSensorTracker::update_in_sequence(const DetectionBatch& detections) {
+    // MHT 는 scan 마다 target 당 detection 하나를 가정하므로 항상 센서 pass 하나가 scan 하나
+    if (params_.fusion_mode != FusionMode::Sequential && !mht_) {
+        update_frame(detections);
+        return;
+    }
+
+    // 센서별로 나눠 camera 먼저 association / update 하고, 그 posterior 로 radar 를 처리
+    // (camera 로 생긴 track 도 같은 프레임의 radar 와 매칭될 수 있어 중복 track 이 덜 생긴다)
+    seq_camera_.clear();
+    seq_radar_.clear();
+    for (size_t j = 0; j < detections.size(); ++j) {
+        (detections.sensor(j) == SensorType::Camera ? seq_camera_ : seq_radar_)
+            .push_back(detections.at(j));
+    }
+
+    // 어느 센서와도 매칭되지 않은 track 만 missed 가 남도록 프레임당 한 번 올려 둔다
+    for (auto& track : tracks_) {
+        track.missed += 1;
+    }
+    // 빈 센서 pass 는 건너뜀 (둘 다 비었을 때만 한 번 돌려 history 를 남긴다)
+    if (!seq_camera_.empty() || seq_radar_.empty()) {
+        update_frame(seq_camera_, false);
+    }
+    if (!seq_radar_.empty()) {
+        update_frame(seq_radar_, false);
+    }
+}
+
+void MultiSensorTracker::update_frame(const DetectionBatch& detections, bool count_missed) {
+    if (mht_) {
+        update_frame_mht(detections);
+        return;
+    }
+
     const int n_tracks = static_cast<int>(tracks_.size());
     const int n_dets   = static_cast<int>(detections.size());
 
     if (n_tracks == 0) {
         // 모든 detection으로부터 새 track 생성
-        for (const auto& det : detections) {
-            create_track_from_detection(det);
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Birth);
+        std::pmr::vector<int> all(n_dets, &arena_);
+        for (int j = 0; j < n_dets; ++j) {
+            all[j] = j;
         }
+        birth_tracks(detections, all);
         return;
     }
 
     if (n_dets == 0) {
         // 모든 track missed 증가
-        for (auto& track : tracks_) {
-            track.missed += 1;
+        if (count_missed) {
+            for (auto& track : tracks_) {
+                track.missed += 1;
+            }
         }
+        record_history(detections, nullptr);
+        return;
+    }
+
+    Eigen::Matrix2d R_cam = make_camera_R(params_.cam_pos_noise_std);
+    Eigen::Matrix3d R_rad = make_radar_R(params_.radar_r_noise_std,
+                                         params_.radar_angle_noise_std,
+                                         params_.radar_vr_noise_std);
+
+    double max_cost = params_.max_association_maha_dist;
+
+    // JPDA 는 게이트 안의 모든 detection 을 확률로 섞으므로 Information 흡수는 쓰지 않는다
+    const bool jpda = params_.association_method == AssociationMethod::JPDA;
+    const bool information = !jpda && params_.detection_update == DetectionUpdate::Information;
+
+    // track 별 detection 목록 (track i → members[offsets[i], offsets[i + 1]))
+    // Information 은 detection index, JPDA 는 candidates_ index
+    std::pmr::vector<int> offsets(&arena_);
+    std::pmr::vector<int> members(&arena_);
+
+    // assoc 과 대입되는 결과가 같은 arena 를 써야 move 가 복사 없이 끝난다
+    AssociationResult assoc(&arena_);
+    if (params_.use_spatial_gating) {
+        // 격자 기반 coarse gating → 후보 쌍만 Mahalanobis 계산
+        {
+            MSFT_STATS_SCOPE(stats_, TrackerStage::Gating);
+            build_measurement_cache(tracks_, detections, R_cam, R_rad);
+            gate_candidates(tracks_, detections, R_cam, R_rad);
+        }
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Association);
+        assoc = jpda ? associate_jpda(detections, n_tracks, n_dets, offsets, members)
+                     : associate(n_tracks, n_dets, max_cost);
     } else {
-        // 비용 행렬 (Mahalanobis 거리 제곱)
-        Eigen::MatrixXd cost(n_tracks, n_dets);
-        cost.setConstant(std::numeric_limits<double>::infinity());
+        // 비용 행렬 (Mahalanobis 거리 제곱), 저장 공간은 frame arena
+        const size_t n_cost = static_cast<size_t>(n_tracks) * n_dets;
+        Eigen::Map<Eigen::MatrixXd> cost(
+            static_cast<double*>(arena_.allocate(n_cost * sizeof(double), alignof(double))),
+            n_tracks, n_dets);
+        {
+            MSFT_STATS_SCOPE(stats_, TrackerStage::Gating);
+            cost.setConstant(std::numeric_limits<double>::infinity());
+            build_measurement_cache(tracks_, detections, R_cam, R_rad);
 
-        Eigen::Matrix2d R_cam = make_camera_R(params_.cam_pos_noise_std);
-        Eigen::Matrix3d R_rad = make_radar_R(params_.radar_r_noise_std,
-                                             params_.radar_angle_noise_std,
-                                             params_.radar_vr_noise_std);
+            pool_->parallel_for(n_tracks, [&](size_t begin, size_t end, int) {
+                for (size_t i = begin; i < end; ++i) {
+                    for (int j = 0; j < n_dets; ++j) {
+                        cost(i, j) = pair_cost(meas_cache_[i], detections, j);
+                    }
+                }
+            });
+            MSFT_STATS_COUNT(stats_, pairs_evaluated, cost.size());
+            MSFT_STATS_COUNT(stats_, pairs_gated, (cost.array() <= max_cost).count());
 
-        for (int i = 0; i < n_tracks; ++i) {
-            const auto& track = tracks_[i];
-            for (int j = 0; j < n_dets; ++j) {
-                const auto& det = detections[j];
-
-                if (det.sensor == SensorType::Camera) {
-                    if (det.z.size() != 2) continue;
-                    Eigen::Vector2d z = det.z.head<2>();
-                    Eigen::Vector2d z_pred = camera_measurement(track.x);
-                    Eigen::Matrix<double, 2, 4> H = camera_H();
-                    Eigen::Vector2d y = z - z_pred;
-                    Eigen::Matrix2d S = H * track.P * H.transpose() + R_cam;
-                    double d2 = mahalanobis_sq(y, S);
-                    cost(i, j) = d2;
-                } else { // Radar
-                    if (det.z.size() != 3) continue;
-                    Eigen::Vector3d z = det.z.head<3>();
-                    Eigen::Vector3d z_pred = radar_measurement(track.x);
-                    Eigen::Matrix<double, 3, 4> H = radar_H_jacobian(track.x);
-
-                    Eigen::Vector3d y = z - z_pred;
-                    // 각도 차이 normalize
-                    y(1) = normalize_angle(y(1));
-
-                    Eigen::Matrix3d S = H * track.P * H.transpose() + R_rad;
-                    double d2 = mahalanobis_sq(y, S);
-                    cost(i, j) = d2;
+            // 흡수 단계 / JPDA 는 게이트 통과 쌍 목록을 쓰므로 격자 경로와 같은 형태로 모아 둔다
+            if (information || jpda) {
+                candidates_.clear();
+                for (int i = 0; i < n_tracks; ++i) {
+                    for (int j = 0; j < n_dets; ++j) {
+                        if (cost(i, j) <= max_cost) {
+                            candidates_.push_back({i, j, cost(i, j)});
+                        }
+                    }
                 }
             }
         }
 
-        double max_cost = params_.max_association_maha_dist;
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Association);
+        if (jpda) {
+            assoc = associate_jpda(detections, n_tracks, n_dets, offsets, members);
+        } else if (params_.association_method == AssociationMethod::Optimal) {
+            assoc = associate_optimal(cost, max_cost, &arena_);
+        } else {
+            assoc = associate_greedy(cost, max_cost, &arena_);
+        }
+    }
 
-        AssociationResult assoc = associate_greedy(cost, max_cost);
+    if (information) {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Association);
+        absorb_detections(assoc, n_tracks, n_dets, offsets, members);
+    }
 
-        // 먼저 모든 track를 missed로 가정
+    // 먼저 모든 track를 missed로 가정
+    if (count_missed) {
         for (auto& track : tracks_) {
             track.missed += 1;
         }
+    }
+
+    // 매칭된 track 업데이트 (track 별로 독립이므로 병렬)
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Update);
+        pool_->parallel_for(n_tracks, [&](size_t begin, size_t end, int) {
+            // JPDA 의 IMM 은 결합 추정의 moment matching 결과를 보정량으로 모든 모델에 옮긴다
+            if (params_.motion_model == MotionModel::IMM && !jpda) {
+                imm_.update(tracks_.data(), begin, end, assoc.track_assignment.data(),
+                            detections, R_cam, R_rad);
+            }
+            for (size_t i = begin; i < end; ++i) {
+                if (jpda) {
+                    const int n_i = offsets[i + 1] - offsets[i];
+                    if (n_i > 0) {
+                        update_track_jpda(static_cast<int>(i), detections,
+                                          members.data() + offsets[i], n_i,
+                                          assoc.track_assignment[i] >= 0, R_cam, R_rad);
+                    }
+                    continue;
+                }
+                if (information) {
+                    const int n_i = offsets[i + 1] - offsets[i];
+                    if (n_i > 0) {
+                        update_track_information(static_cast<int>(i), detections,
+                                                 members.data() + offsets[i], n_i,
+                                                 assoc.track_assignment[i], R_cam, R_rad);
+                    }
+                    continue;
+                }
+                const int det_idx = assoc.track_assignment[i];
+                if (det_idx >= 0) {
+                    update_track(static_cast<int>(i), detections, det_idx, R_cam, R_rad);
+                }
+            }
+        });
+        MSFT_STATS_COUNT(stats_, ekf_updates,
+                         n_tracks - assoc.unassigned_tracks.size());
+
+        record_history(detections, &assoc.track_assignment);
+    }
+
+    // Unassigned detection → 새로운 track 생성
+    MSFT_STATS_SCOPE(stats_, TrackerStage::Birth);
+    birth_tracks(detections, assoc.unassigned_detections);
+}
+
+void MultiSensorTracker::update_frame_mht(const DetectionBatch& detections) {
+    auto& leaves = mht_->leaves();
+    const size_t n_dets = detections.size();
+    const Eigen::Matrix2d R_cam = make_camera_R(params_.cam_pos_noise_std);
+    const Eigen::Matrix3d R_rad = make_radar_R(params_.radar_r_noise_std,
+                                               params_.radar_angle_noise_std,
+                                               params_.radar_vr_noise_std);
+
+    // leaf 마다 게이트 안 detection 후보 (dense gating 설정과 무관하게 격자 경로)
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Gating);
+        build_measurement_cache(leaves, detections, R_cam, R_rad);
+        gate_candidates(leaves, detections, R_cam, R_rad);
+    }
+
+    // 후보 쌍마다 likelihood 와 그 detection 을 반영한 posterior (분기마다 필요하므로 모두 계산)
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Update);
+        compute_pair_likelihood(detections);
+        const size_t n_cand = candidates_.size();
+        if (mht_post_.capacity() < n_cand) {
+            mht_post_.reserve(2 * n_cand);
+        }
+        mht_post_.resize(n_cand);
+        pool_->parallel_for(n_cand, [&](size_t begin, size_t end, int) {
+            for (size_t k = begin; k < end; ++k) {
+                const auto& c = candidates_[k];
+                auto& post = mht_post_[k];
+                post.x = leaves[c.track].x;
+                post.P = leaves[c.track].P;
+                apply_cached_update(meas_cache_[c.track], detections, c.det, R_cam, R_rad,
+                                    post.x, post.P);
+            }
+        });
+        MSFT_STATS_COUNT(stats_, ekf_updates, n_cand);
+    }
+
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Birth);
+        if (mht_birth_.capacity() < n_dets) {
+            mht_birth_.reserve(2 * n_dets);
+        }
+        mht_birth_.resize(n_dets);
+        for (size_t j = 0; j < n_dets; ++j) {
+            initial_state(detections, static_cast<int>(j), mht_birth_[j].x, mht_birth_[j].P);
+            mht_birth_[j].last_timestamp = detections.timestamp(j);
+        }
+    }
+
+    run_mht_scan();
+}
+
+void MultiSensorTracker::run_mht_scan() {
+    {
+        MSFT_STATS_SCOPE(stats_, TrackerStage::Association);
+        mht_->update(candidates_, pair_likelihood_, mht_post_, mht_birth_, *pool_);
+    }
+    const auto& best = mht_->best_tracks();
+    if (tracks_.capacity() < best.size()) {
+        tracks_.reserve(2 * best.size());
+    }
+    tracks_.assign(best.begin(), best.end());
+
+#if MSFT_ENABLE_STATS
+    const MhtStats& s = mht_->stats();
+    MSFT_STATS_COUNT(stats_, mht_clusters, s.clusters);
+    MSFT_STATS_COUNT(stats_, mht_hypotheses, s.leaves);
+    MSFT_STATS_COUNT(stats_, mht_truncated, s.truncated + s.degraded);
+#endif
+}
+
+void MultiSensorTracker::compute_pair_likelihood(const DetectionBatch& dets) {
+    // 후보 쌍 likelihood = P_D N(y; 0, S) / clutter 밀도 (d2 는 gating 에서 계산한 y^T S^-1 y)
+    const double pd = params_.detection_prob;
+    const double cam_norm = pd / (2.0 * M_PI * params_.camera_clutter_density);
+    const double rad_norm =
+        pd / (std::pow(2.0 * M_PI, 1.5) * params_.radar_clutter_density);
+    const size_t n_cand = candidates_.size();
+    if (pair_likelihood_.capacity() < n_cand) {
+        pair_likelihood_.reserve(2 * n_cand);
+    }
+    pair_likelihood_.resize(n_cand);
+    pool_->parallel_for(n_cand, [&](size_t begin, size_t end, int) {
+        for (size_t k = begin; k < end; ++k) {
+            const auto& c = candidates_[k];
+            const auto& cache = meas_cache_[c.track];
+            const bool camera = dets.sensor(c.det) == SensorType::Camera;
+            const double det_S = camera ? cache.camera.S_ldlt.vectorD().prod()
+                                        : cache.radar.S_ldlt.vectorD().prod();
+            const double g = (camera ? cam_norm : rad_norm) * std::exp(-0.5 * c.cost) /
+                             std::sqrt(det_S);
+            pair_likelihood_[k] = std::max(g, std::numeric_limits<double>::min());
+        }
+    });
+}
+
+AssociationResult MultiSensorTracker::associate_jpda(const DetectionBatch& dets, int n_tracks,
+                                                    int n_dets, std::pmr::vector<int>& offsets,
+                                                    std::pmr::vector<int>& members) {
+    compute_pair_likelihood(dets);
+    const size_t n_cand = candidates_.size();
+    jpda_.solve(candidates_, pair_likelihood_, n_tracks, n_dets, params_.detection_prob,
+                params_.jpda_max_events, params_.jpda_k_best_max_tracks, *pool_);
+    MSFT_STATS_COUNT(stats_, jpda_clusters, jpda_.stats().clusters);
+    MSFT_STATS_COUNT(stats_, jpda_events, jpda_.stats().events);
+    MSFT_STATS_COUNT(stats_, jpda_truncated,
+                     jpda_.stats().k_best + jpda_.stats().approximate);
+
+    // track 별 후보 목록 (candidates_ index, CSR)
+    offsets.assign(n_tracks + 1, 0);
+    for (const auto& c : candidates_) {
+        ++offsets[c.track + 1];
+    }
+    for (int i = 0; i < n_tracks; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    members.resize(n_cand);
+    std::pmr::vector<int> cursor(offsets.begin(), offsets.end() - 1, &arena_);
+    for (size_t k = 0; k < n_cand; ++k) {
+        members[cursor[candidates_[k].track]++] = static_cast<int>(k);
+    }
+
+    AssociationResult result(&arena_);
+    result.track_assignment.assign(n_tracks, -1);
+    result.unassigned_tracks.reserve(n_tracks);
+    result.unassigned_detections.reserve(n_dets);
+    std::pmr::vector<char> gated(n_dets, 0, &arena_);
+    const auto& beta = jpda_.beta();
+    for (int i = 0; i < n_tracks; ++i) {
+        double best = jpda_.beta_miss()[i];
+        for (int m = offsets[i]; m < offsets[i + 1]; ++m) {
+            const int k = members[m];
+            gated[candidates_[k].det] = 1;
+            if (beta[k] > best) {
+                best = beta[k];
+                result.track_assignment[i] = candidates_[k].det;
+            }
+        }
+        if (offsets[i + 1] == offsets[i]) {
+            result.unassigned_tracks.push_back(i);
+        }
+    }
+    for (int j = 0; j < n_dets; ++j) {
+        if (!gated[j]) {
+            result.unassigned_detections.push_back(j);
+        }
+    }
+    return result;
+}
+
+void MultiSensorTracker::absorb_detections(AssociationResult& assoc, int n_tracks, int n_dets,
+                                           std::pmr::vector<int>& offsets,
+                                           std::pmr::vector<int>& members) {
+    // association 으로 정해진 짝은 고정하고, 남은 detection 은 게이트를 통과한 track 중
+    // 비용이 가장 작은 track 으로 (candidates_ 는 스레드 수와 무관한 순서라 동률 처리도 결정적)
+    std::pmr::vector<int> owner(n_dets, -1, &arena_);
+    std::pmr::vector<double> best(n_dets, std::numeric_limits<double>::infinity(), &arena_);
+    for (int i = 0; i < n_tracks; ++i) {
+        const int j = assoc.track_assignment[i];
+        if (j >= 0) {
+            owner[j] = i;
+            best[j] = -1.0;
+        }
+    }
+    for (const auto& c : candidates_) {
+        if (c.cost < best[c.det]) {
+            best[c.det] = c.cost;
+            owner[c.det] = c.track;
+        }
+    }
+
+    // 흡수된 detection 은 새 track 을 만들지 않는다
+    auto& unassigned = assoc.unassigned_detections;
+#if MSFT_ENABLE_STATS
+    const size_t n_before = unassigned.size();
+#endif
+    unassigned.erase(std::remove_if(unassigned.begin(), unassigned.end(),
+                                    [&](int j) { return owner[j] >= 0; }),
+                     unassigned.end());
+    MSFT_STATS_COUNT(stats_, dets_absorbed, n_before - unassigned.size());
+
+    // track 별로 detection index 순서의 CSR 목록
+    offsets.assign(n_tracks + 1, 0);
+    for (int j = 0; j < n_dets; ++j) {
+        if (owner[j] >= 0) {
+            ++offsets[owner[j] + 1];
+        }
+    }
+    for (int i = 0; i < n_tracks; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    members.resize(offsets[n_tracks]);
+    std::pmr::vector<int> cursor(offsets.begin(), offsets.end() - 1, &arena_);
+    for (int j = 0; j < n_dets; ++j) {
+        if (owner[j] >= 0) {
+            members[cursor[owner[j]]++] = j;
+        }
+    }
+}
+
+void MultiSensorTracker::birth_tracks(const DetectionBatch& dets,
+                                      const std::pmr::vector<int>& unassigned) {
+    if (params_.detection_update != DetectionUpdate::Information) {
+        for (int j : unassigned) {
+            create_track_from_detection(dets, j);
+        }
+        return;
+    }
+
+    // 같은 object 의 여러 detection 이 각각 track 이 되지 않도록 위치가 게이트 안인
+    // detection 끼리 묶는다 (먼저 나온 detection 이 seed, 두 측정 위치 분산의 합으로 판정)
+    const double gate = params_.max_association_maha_dist;
+    const double cam_var = params_.cam_pos_noise_std * params_.cam_pos_noise_std;
+    const double range_var = params_.radar_r_noise_std * params_.radar_r_noise_std;
+    const double angle_var = params_.radar_angle_noise_std * params_.radar_angle_noise_std;
+    auto pos_var = [&](int j) {
+        if (dets.sensor(j) == SensorType::Camera) return cam_var;
+        const double range_sq = dets.pos_x(j) * dets.pos_x(j) + dets.pos_y(j) * dets.pos_y(j);
+        return std::max(range_var, range_sq * angle_var);
+    };
 
-        // 매칭된 track 업데이트
+    const size_t n = unassigned.size();
+    std::pmr::vector<int> seed_of(n, -1, &arena_);
+    std::pmr::vector<int> seeds(&arena_);
+    seeds.reserve(n);
+    for (size_t a = 0; a < n; ++a) {
+        const int j = unassigned[a];
+        const double var_j = pos_var(j);
+        for (int s : seeds) {
+            const int k = unassigned[s];
+            const double dx = dets.pos_x(j) - dets.pos_x(k);
+            const double dy = dets.pos_y(j) - dets.pos_y(k);
+            if (dx * dx + dy * dy <= gate * (var_j + pos_var(k))) {
+                seed_of[a] = s;
+                break;
+            }
+        }
+        if (seed_of[a] < 0) {
+            seed_of[a] = static_cast<int>(a);
+            seeds.push_back(static_cast<int>(a));
+        }
+    }
+
+    const Eigen::Matrix2d R_cam = make_camera_R(params_.cam_pos_noise_std);
+    const Eigen::Matrix3d R_rad = make_radar_R(params_.radar_r_noise_std,
+                                               params_.radar_angle_noise_std,
+                                               params_.radar_vr_noise_std);
+    for (int s : seeds) {
+        const int j0 = unassigned[s];
+        Vec4 x;
+        Mat4 P;
+        initial_state(dets, j0, x, P);
+        for (size_t a = s + 1; a < n; ++a) {
+            if (seed_of[a] != s) continue;
+            const int j = unassigned[a];
+            apply_measurement(x, P, dets.sensor(j), dets.meas(j), R_cam, R_rad);
+            MSFT_STATS_COUNT(stats_, dets_absorbed, 1);
+        }
+        create_track(x, P, dets.timestamp(j0));
+    }
+}
+
+void MultiSensorTracker::record_history(const DetectionBatch& detections,
+                                        const std::pmr::vector<int>* assignment) {
+    if (params_.oosm_history_size <= 0) {
+        return;
+    }
+
+    // assignment 는 이번 프레임 새 track 생성 전 track 수 만큼만 유효
+    const size_t n = assignment ? assignment->size() : tracks_.size();
+    pool_->parallel_for(n, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& track = tracks_[i];
+            HistoryEntry e;
+            e.timestamp = track.last_timestamp;
+            e.x = track.x;
+            e.P = track.P;
+            const int j = assignment ? (*assignment)[i] : -1;
+            if (j >= 0) {
+                e.has_meas = true;
+                e.sensor = detections.sensor(j);
+                e.z = detections.meas(j);
+            }
+            history_[i].insert(e);
+        }
+    });
+}
+
+void MultiSensorTracker::update_late(const DetectionBatch& late) {
+    if (late.empty()) {
+        return;
+    }
+    MSFT_STATS_SCOPE(stats_, TrackerStage::Late);
+    MSFT_STATS_COUNT(stats_, late_detections, late.size());
+
+    Eigen::Matrix2d R_cam = make_camera_R(params_.cam_pos_noise_std);
+    Eigen::Matrix3d R_rad = make_radar_R(params_.radar_r_noise_std,
+                                         params_.radar_angle_noise_std,
+                                         params_.radar_vr_noise_std);
+
+    // timestamp 오름차순으로, 같은 timestamp 끼리 하나의 association 문제로 처리
+    late_order_.resize(late.size());
+    for (size_t j = 0; j < late.size(); ++j) {
+        late_order_[j] = static_cast<int>(j);
+    }
+    // 같은 timestamp 는 도착 순서 유지 (stable_sort 는 임시 buffer 를 할당하므로 index 로 tie-break)
+    std::sort(late_order_.begin(), late_order_.end(), [&](int a, int b) {
+        if (late.timestamp(a) != late.timestamp(b)) return late.timestamp(a) < late.timestamp(b);
+        return a < b;
+    });
+
+    size_t g = 0;
+    while (g < late_order_.size()) {
+        const double t_d = late.timestamp(late_order_[g]);
+        late_group_.clear();
+        while (g < late_order_.size() && late.timestamp(late_order_[g]) == t_d) {
+            late_group_.push_back(late.at(late_order_[g]));
+            ++g;
+        }
+
+        const int n_tracks = static_cast<int>(tracks_.size());
+
+        // 각 track 의 t_d 시점 상태 (history 에서 t_d 직전 posterior 를 예측)
+        // history 범위 밖(너무 오래된 측정, 또는 t_d 이후 생성된 track)은 제외
+        retro_.resize(n_tracks);
+        retro_valid_.assign(n_tracks, 0);
         for (int i = 0; i < n_tracks; ++i) {
-            int det_idx = assoc.track_assignment[i];
-            if (det_idx < 0) continue;
-
-            auto& track = tracks_[i];
-            const auto& det = detections[det_idx];
-
-            if (det.sensor == SensorType::Camera) {
-                Eigen::Vector2d z = det.z.head<2>();
-                Eigen::Vector2d z_pred = camera_measurement(track.x);
-                Eigen::Matrix<double, 2, 4> H = camera_H();
-                Eigen::Vector2d y = z - z_pred;
-                Eigen::Matrix2d R = make_camera_R(params_.cam_pos_noise_std);
-                Eigen::Matrix2d S = H * track.P * H.transpose() + R;
-                Eigen::Matrix<double, 4, 2> K = track.P * H.transpose() * S.inverse();
-
-                track.x = track.x + K * y;
-                Mat4 I = Mat4::Identity();
-                track.P = (I - K * H) * track.P;
-            } else {
-                Eigen::Vector3d z = det.z.head<3>();
-                Eigen::Vector3d z_pred = radar_measurement(track.x);
-                Eigen::Matrix<double, 3, 4> H = radar_H_jacobian(track.x);
-                Eigen::Vector3d y = z - z_pred;
-                y(1) = normalize_angle(y(1));
-                Eigen::Matrix3d R = make_radar_R(params_.radar_r_noise_std,
-                                                 params_.radar_angle_noise_std,
-                                                 params_.radar_vr_noise_std);
-                Eigen::Matrix3d S = H * track.P * H.transpose() + R;
-                Eigen::Matrix<double, 4, 3> K = track.P * H.transpose() * S.inverse();
-
-                track.x = track.x + K * y;
-                Mat4 I = Mat4::Identity();
-                track.P = (I - K * H) * track.P;
+            const auto& h = history_[i];
+            const int k = h.find_at_or_before(t_d);
+            if (k < 0) continue;
+            retro_[i].x = h.at(k).x;
+            retro_[i].P = h.at(k).P;
+            const double dt = t_d - h.at(k).timestamp;
+            if (dt > 0.0) {
+                predict_state(retro_[i].x, retro_[i].P, dt);
             }
+            retro_valid_[i] = 1;
+        }
 
-            track.missed = 0;
+        build_measurement_cache(retro_, late_group_, R_cam, R_rad);
+        gate_candidates(retro_, late_group_, R_cam, R_rad);
+        candidates_.erase(std::remove_if(candidates_.begin(), candidates_.end(),
+                                         [&](const GateCandidate& c) {
+                                             return !retro_valid_[c.track];
+                                         }),
+                          candidates_.end());
 
-            // hit 횟수 기반으로 confirmed 처리
-            if (!track.confirmed && track.age >= params_.min_hits_to_confirm) {
-                track.confirmed = true;
+        AssociationResult assoc = associate(n_tracks, static_cast<int>(late_group_.size()),
+                                           params_.max_association_maha_dist);
+
+        // 매칭된 track 만 rewind-and-replay
+        for (int i = 0; i < n_tracks; ++i) {
+            const int j = assoc.track_assignment[i];
+            if (j >= 0) {
+                replay_with_late_measurement(i, late_group_, j, R_cam, R_rad);
             }
         }
 
-        // Unassigned detection → 새로운 track 생성
-        for (int det_idx : assoc.unassigned_detections) {
-            create_track_from_detection(detections[det_idx]);
+        // 매칭되지 않은 늦은 detection 은 t_d 에서 track 을 만들고 현재 시각까지 예측
+        for (int j : assoc.unassigned_detections) {
+            create_track_from_detection(late_group_, j);
+        }
+    }
+}
+
+void MultiSensorTracker::replay_with_late_measurement(int i, const DetectionBatch& dets, int j,
+                                                      const Eigen::Matrix2d& R_cam,
+                                                      const Eigen::Matrix3d& R_rad) {
+    auto& track = tracks_[i];
+    auto& h = history_[i];
+
+    const double t_d = dets.timestamp(j);
+    const int k = h.find_at_or_before(t_d);
+    if (k < 0) {
+        return;
+    }
+
+    // t_d 직전 posterior 로 되감고 늦은 측정 적용
+    Vec4 x = h.at(k).x;
+    Mat4 P = h.at(k).P;
+    double t = h.at(k).timestamp;
+    if (t_d > t) {
+        predict_state(x, P, t_d - t);
+    }
+    apply_measurement(x, P, dets.sensor(j), dets.meas(j), R_cam, R_rad);
+    MSFT_STATS_COUNT(stats_, ekf_updates, 1);
+    MSFT_STATS_COUNT(stats_, factorizations, 1);
+
+    HistoryEntry late_entry;
+    late_entry.timestamp = t_d;
+    late_entry.x = x;
+    late_entry.P = P;
+    late_entry.has_meas = true;
+    late_entry.sensor = dets.sensor(j);
+    late_entry.z = dets.meas(j);
+    t = t_d;
+
+    // 이후 기록된 측정을 순서대로 다시 적용하면서 history posterior 도 갱신
+    for (size_t m = k + 1; m < h.size(); ++m) {
+        auto& e = h.at(m);
+        if (e.timestamp > t) {
+            predict_state(x, P, e.timestamp - t);
+            t = e.timestamp;
+        }
+        if (e.has_meas) {
+            apply_measurement(x, P, e.sensor, e.z, R_cam, R_rad);
+            MSFT_STATS_COUNT(stats_, ekf_updates, 1);
+            MSFT_STATS_COUNT(stats_, factorizations, 1);
         }
+        e.x = x;
+        e.P = P;
+    }
+    if (track.last_timestamp > t) {
+        predict_state(x, P, track.last_timestamp - t);
+    }
+
+    h.insert(late_entry);
+
+    if (params_.motion_model == MotionModel::IMM) {
+        // replay 는 결합 추정에 대해 CV 로 하고, 그 보정을 pseudo-measurement 로 모델마다 update
+        imm_.apply_correction(i, track.x, track.P, x, P);
     }
+    track.x = x;
+    track.P = P;
+    track.missed = 0;
+    if (params_.track_storage == TrackStorage::SoA) {
+        soa_.store(i, track.x, track.P);
+    }
+}
+
+void MultiSensorTracker::prune_tracks() {
+    if (mht_) {
+        return;   // MHT 는 MhtEngine 이 leaf 단위로 삭제하고 tracks_ 는 출력 view
+    }
+    MSFT_STATS_SCOPE(stats_, TrackerStage::Prune);
+#if MSFT_ENABLE_STATS
+    const size_t n_before = tracks_.size();
+#endif
 
     // 오래 missed 된 track 제거
+    const bool use_soa = params_.track_storage == TrackStorage::SoA;
+    const bool use_history = params_.oosm_history_size > 0;
+    const bool use_imm = params_.motion_model == MotionModel::IMM;
+    if (use_soa || use_history || use_imm) {
+        keep_.resize(tracks_.size());
+        for (size_t i = 0; i < tracks_.size(); ++i) {
+            keep_[i] = tracks_[i].missed <= params_.max_missed;
+        }
+        if (use_soa) {
+            soa_.compact(keep_);
+        }
+        if (use_imm) {
+            imm_.compact(keep_);
+        }
+        if (use_history) {
+            // 삭제되는 track 의 history buffer 는 pool 로 돌려 새 track 이 재사용
+            size_t w = 0;
+            for (size_t i = 0; i < history_.size(); ++i) {
+                if (keep_[i]) {
+                    if (w != i) std::swap(history_[w], history_[i]);
+                    ++w;
+                }
+            }
+            for (size_t i = w; i < history_.size(); ++i) {
+                history_pool_.push_back(std::move(history_[i]));
+            }
+            history_.resize(w);
+        }
+    }
     tracks_.erase(
         std::remove_if(tracks_.begin(), tracks_.end(),
                        [&](const TrackState& t) {
                            return t.missed > params_.max_missed;
                        }),
         tracks_.end());
+    MSFT_STATS_COUNT(stats_, tracks_deleted, n_before - tracks_.size());
 }
 
-void MultiSensorTracker::create_track_from_detection(const Detection& det) {
-    TrackState t;
-    t.id = next_id_++;
-    t.age = 1;
-    t.missed = 0;
-    t.confirmed = false;
-    t.last_timestamp = det.timestamp;
+void MultiSensorTracker::update_track(int i, const DetectionBatch& detections, int det_idx,
+                                      const Eigen::Matrix2d& R_cam,
+                                      const Eigen::Matrix3d& R_rad) {
+    auto& track = tracks_[i];
+    const auto& cache = meas_cache_[i];
+
+    // gating 에서 계산한 z_pred, H, P H^T, S 분해를 그대로 사용
+    // (매칭됐다는 것은 해당 센서의 cache 가 유효하다는 뜻)
+    // IMM 은 ImmFilterBank::update 가 모델별로 갱신하고 결합 추정을 이미 써 두었다
+    if (params_.motion_model != MotionModel::IMM) {
+        apply_cached_update(cache, detections, det_idx, R_cam, R_rad, track.x, track.P);
+    }
+    if (params_.track_storage == TrackStorage::SoA) {
+        soa_.store(i, track.x, track.P);
+    }
+
+    track.missed = 0;
+
+    // hit 횟수 기반으로 confirmed 처리
+    if (!track.confirmed && track.age >= params_.min_hits_to_confirm) {
+        track.confirmed = true;
+    }
+}
+
+void MultiSensorTracker::apply_cached_update(const MeasurementCache& cache,
+                                             const DetectionBatch& detections, int j,
+                                             const Eigen::Matrix2d& R_cam,
+                                             const Eigen::Matrix3d& R_rad,
+                                             Vec4& x, Mat4& P) const {
+    if (detections.sensor(j) == SensorType::Camera) {
+        const Eigen::Vector2d y = detections.camera_z(j) - cache.camera.z_pred;
+        CvFilter::update_factored<2>(x, P, y, cache.camera.H, cache.camera.PHt,
+                                     cache.camera.S_ldlt, R_cam);
+        return;
+    }
+    Eigen::Vector3d y = detections.radar_z(j) - cache.radar.z_pred;
+    y(1) = normalize_angle(y(1));
+    if (params_.radar_filter == RadarFilter::UKF) {
+        CvFilter::update_cross<3>(x, P, y, cache.radar.PHt, cache.radar.S_ldlt);
+    } else {
+        CvFilter::update_factored<3>(x, P, y, cache.radar.H, cache.radar.PHt,
+                                     cache.radar.S_ldlt, R_rad);
+    }
+}
+
+void MultiSensorTracker::update_track_jpda(int i, const DetectionBatch& detections,
+                                           const int* cands, int n, bool hit,
+                                           const Eigen::Matrix2d& R_cam,
+                                           const Eigen::Matrix3d& R_rad) {
+    auto& track = tracks_[i];
+    const auto& cache = meas_cache_[i];
+    const auto& beta = jpda_.beta();
+
+    // 가설 (미검출 + 후보별 posterior) 의 가중 혼합을 평균 / 공분산 하나로 (moment matching)
+    // 큰 좌표값끼리의 상쇄를 피하려고 사전 추정 기준 편차 d 로 모은다
+    //   x = x0 + sum(b d),  P = sum(b (P_k + d d^T)) - (sum b d)(sum b d)^T
+    const Vec4 x0 = track.x;
+    const Mat4 P0 = track.P;
+    Vec4 mean = Vec4::Zero();
+    Mat4 second = jpda_.beta_miss()[i] * P0;
+    for (int m = 0; m < n; ++m) {
+        const int k = cands[m];
+        const double b = beta[k];
+        if (b <= 0.0) continue;
+        Vec4 x = x0;
+        Mat4 P = P0;
+        apply_cached_update(cache, detections, candidates_[k].det, R_cam, R_rad, x, P);
+        const Vec4 d = x - x0;
+        mean.noalias() += b * d;
+        second.noalias() += b * (P + d * d.transpose());
+    }
+    track.x = x0 + mean;
+    track.P = second - mean * mean.transpose();
+    track.P = 0.5 * (track.P + track.P.transpose()).eval();
+
+    if (params_.motion_model == MotionModel::IMM) {
+        imm_.apply_correction(i, x0, P0, track.x, track.P);
+    }
+    if (params_.track_storage == TrackStorage::SoA) {
+        soa_.store(i, track.x, track.P);
+    }
+
+    // 게이트 안에 clutter 만 있어도 계속 살아남지 않도록 미검출이 가장 그럴듯하면 miss 로 센다
+    if (!hit) return;
+    track.missed = 0;
+    if (!track.confirmed && track.age >= params_.min_hits_to_confirm) {
+        track.confirmed = true;
+    }
+}
+
+void MultiSensorTracker::update_track_information(int i, const DetectionBatch& detections,
+                                                  const int* dets, int n, int primary,
+                                                  const Eigen::Matrix2d& R_cam,
+                                                  const Eigen::Matrix3d& R_rad) {
+    auto& track = tracks_[i];
+
+    // IMM 은 association 결과 (primary) 를 ImmFilterBank::update 가 모델별로 반영했으므로
+    // 나머지만 합산해서 ImmFilterBank::update_information 으로 모델마다 반영한다
+    const bool imm = params_.motion_model == MotionModel::IMM;
+
+    // 모든 detection 이 같은 선형화 점 (현재 x) 을 쓰므로 radar 의 h(x), H 는 track 당 한 번.
+    // H^T R^-1 H 는 센서별로 detection 수를 곱하면 되고 detection 마다 innovation 만 더한다
+    // (UKF 모드도 여기서는 Jacobian 선형화)
+    const Eigen::Vector2d cam_info = R_cam.diagonal().cwiseInverse();
+    const Eigen::Vector3d rad_info = R_rad.diagonal().cwiseInverse();
+    Eigen::Vector2d cam_sum = Eigen::Vector2d::Zero();
+    Eigen::Vector3d rad_sum = Eigen::Vector3d::Zero();
+    int n_cam = 0, n_rad = 0;
+    const Eigen::Vector2d cam_pred = camera_measurement(track.x);
+    Eigen::Vector3d rad_pred = Eigen::Vector3d::Zero();
+    for (int k = 0; k < n; ++k) {
+        const int j = dets[k];
+        if (imm && j == primary) continue;
+        if (detections.sensor(j) == SensorType::Camera) {
+            cam_sum += detections.camera_z(j) - cam_pred;
+            ++n_cam;
+        } else {
+            if (n_rad == 0) {
+                rad_pred = radar_measurement(track.x);
+            }
+            Eigen::Vector3d y = detections.radar_z(j) - rad_pred;
+            y(1) = normalize_angle(y(1));
+            rad_sum += y;
+            ++n_rad;
+        }
+    }
+
+    if (n_cam + n_rad > 0) {
+        // camera H = [I 0] 이라 위치 블록에만 더해진다
+        Mat4 J = Mat4::Zero();
+        Vec4 g = Vec4::Zero();
+        J.diagonal().head<2>() = n_cam * cam_info;
+        g.head<2>() = cam_info.cwiseProduct(cam_sum);
+        if (n_rad > 0) {
+            const Eigen::Matrix<double, 3, 4> H = radar_H_jacobian(track.x);
+            const Eigen::Matrix<double, 4, 3> HtRi = H.transpose() * rad_info.asDiagonal();
+            J.noalias() += n_rad * (HtRi * H);
+            g.noalias() += HtRi * rad_sum;
+        }
+
+        if (imm) {
+            // 선형화 점 x 기준 innovation 합 g 를 상태에 대한 정보 벡터로: y ≈ H (s - x)
+            imm_.update_information(i, J, g + J * track.x, track.x, track.P);
+        } else {
+            CvFilter::update_information(track.x, track.P, J, g);
+        }
+    }
+    if (params_.track_storage == TrackStorage::SoA) {
+        soa_.store(i, track.x, track.P);
+    }
+
+    track.missed = 0;
+    if (!track.confirmed && track.age >= params_.min_hits_to_confirm) {
+        track.confirmed = true;
+    }
+}
+
+void MultiSensorTracker::apply_measurement(Vec4& x, Mat4& P, SensorType sensor,
+                                           const MeasVec& z,
+                                           const Eigen::Matrix2d& R_cam,
+                                           const Eigen::Matrix3d& R_rad) const {
+    if (sensor == SensorType::Camera) {
+        Eigen::Vector2d y = z.head<2>() - camera_measurement(x);
+        CvFilter::update_innovation<2>(x, P, y, camera_H(), R_cam);
+    } else if (params_.radar_filter == RadarFilter::UKF) {
+        PredictedMeasurement<3> pred;
+        radar_unscented_predict(x, P, ukf_w_, R_rad, pred);
+        if (pred.valid) {
+            Eigen::Vector3d y = z.head<3>() - pred.z_pred;
+            y(1) = normalize_angle(y(1));
+            CvFilter::update_cross<3>(x, P, y, pred.PHt, pred.S_ldlt);
+        }
+    } else {
+        Eigen::Vector3d y = z.head<3>() - radar_measurement(x);
+        y(1) = normalize_angle(y(1));
+        CvFilter::update_innovation<3>(x, P, y, radar_H_jacobian(x), R_rad);
+    }
+}
+
+void MultiSensorTracker::create_track_from_detection(const DetectionBatch& dets, int j) {
+    Vec4 x;
+    Mat4 P;
+    initial_state(dets, j, x, P);
+    create_track(x, P, dets.timestamp(j));
+}
+
+void MultiSensorTracker::initial_state(const DetectionBatch& dets, int j, Vec4& x, Mat4& P) const {
 
     // 초기 상태 추정
-    if (det.sensor == SensorType::Camera && det.z.size() >= 2) {
-        double x = det.z(0);
-        double y = det.z(1);
-        t.x << x, y, 0.0, 0.0;
-    } else if (det.sensor == SensorType::Radar && det.z.size() >= 3) {
-        double r = det.z(0);
-        double phi = det.z(1);
-        double vr = det.z(2);
-        double x = r * std::cos(phi);
-        double y = r * std::sin(phi);
+    if (dets.sensor(j) == SensorType::Camera && dets.dim(j) >= 2) {
+        double px = dets.z(j, 0);
+        double py = dets.z(j, 1);
+        x << px, py, 0.0, 0.0;
+    } else if (dets.sensor(j) == SensorType::Radar && dets.dim(j) >= 3) {
+        double r = dets.z(j, 0);
+        double phi = dets.z(j, 1);
+        double vr = dets.z(j, 2);
+        double px = r * std::cos(phi);
+        double py = r * std::sin(phi);
         double vx = vr * std::cos(phi);
         double vy = vr * std::sin(phi);
-        t.x << x, y, vx, vy;
+        x << px, py, vx, vy;
     } else {
-        t.x.setZero();
+        x.setZero();
     }
 
     // 초기 공분산
-    t.P.setIdentity();
-    t.P(0, 0) *= 10.0;
-    t.P(1, 1) *= 10.0;
-    t.P(2, 2) *= 10.0;
-    t.P(3, 3) *= 10.0;
+    P = Mat4::Identity();
+    P(0, 0) *= 10.0;
+    P(1, 1) *= 10.0;
+    P(2, 2) *= 10.0;
+    P(3, 3) *= 10.0;
+}
 
+void MultiSensorTracker::create_track(const Vec4& x, const Mat4& P, double timestamp) {
+    TrackState t;
+    t.id = next_id_++;
+    t.age = 1;
+    t.missed = 0;
+    t.confirmed = false;
+    t.last_timestamp = timestamp;
+    t.x = x;
+    t.P = P;
+
+    if (params_.oosm_history_size > 0) {
+        if (history_pool_.empty()) {
+            history_.emplace_back(static_cast<size_t>(params_.oosm_history_size));
+        } else {
+            history_.push_back(std::move(history_pool_.back()));
+            history_pool_.pop_back();
+            history_.back().clear();
+        }
+        HistoryEntry e;
+        e.timestamp = t.last_timestamp;
+        e.x = t.x;
+        e.P = t.P;
+        history_.back().insert(e);
+
+        // 늦게 도착한 detection 으로 생성된 track 은 현재 시각까지 예측
+        if (t.last_timestamp < latest_time_) {
+            predict_state(t.x, t.P, latest_time_ - t.last_timestamp);
+            t.last_timestamp = latest_time_;
+        }
+    }
+    if (params_.track_storage == TrackStorage::SoA) {
+        soa_.push_back(t.x, t.P, t.last_timestamp);
+    }
+    if (params_.motion_model == MotionModel::IMM) {
+        imm_.push_back(t.x, t.P);
+    }
     tracks_.push_back(t);
+    MSFT_STATS_COUNT(stats_, tracks_born, 1);
 }
 
 } // namespace msf
@@ -0,0 +1,200 @@
+#include "tracker_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace msf {
+
+const char* stage_name(TrackerStage stage) {
+    switch (stage) {
+    case TrackerStage::Predict:     return "predict";
+    case TrackerStage::Gating:      return "gating";
+    case TrackerStage::Association: return "association";
+    case TrackerStage::Update:      return "update";
+    case TrackerStage::Birth:       return "birth";
+    case TrackerStage::Late:        return "late";
+    case TrackerStage::Prune:       return "prune";
+    case TrackerStage::TrackFusion: return "track_fusion";
+    case TrackerStage::Frame:       return "frame";
+    default:                        return "?";
+    }
+}
+
+void TrackerCounters::add(const TrackerCounters& o) {
+    frames += o.frames;
+    detections += o.detections;
+    pairs_evaluated += o.pairs_evaluated;
+    pairs_gated += o.pairs_gated;
+    ekf_updates += o.ekf_updates;
+    factorizations += o.factorizations;
+    tracks_born += o.tracks_born;
+    tracks_deleted += o.tracks_deleted;
+    late_detections += o.late_detections;
+    tracks_fused += o.tracks_fused;
+    dets_absorbed += o.dets_absorbed;
+    jpda_clusters += o.jpda_clusters;
+    jpda_events += o.jpda_events;
+    jpda_truncated += o.jpda_truncated;
+    mht_clusters += o.mht_clusters;
+    mht_hypotheses += o.mht_hypotheses;
+    mht_truncated += o.mht_truncated;
+}
+
+namespace {
+
+// octave 당 4 개 bucket: ns = 2^k * (1 + sub/4 ...) → index 4k + sub
+int bucket_index(std::uint64_t ns) {
+    if (ns < 4) {
+        return static_cast<int>(ns);
+    }
+    int k = 63 - __builtin_clzll(ns);
+    const int sub = static_cast<int>((ns >> (k - 2)) & 3);
+    return std::min(4 * k + sub, StageTiming::kBuckets - 1);
+}
+
+// bucket 의 상한 [ns]
+double bucket_upper_ns(int idx) {
+    if (idx < 8) {
+        return idx + 1.0;
+    }
+    const int k = idx / 4;
+    const int sub = idx % 4;
+    return std::ldexp(4.0 + sub + 1.0, k - 2);
+}
+
+} // namespace
+
+void StageTiming::record(std::uint64_t ns) {
+    ++count;
+    total_ns += ns;
+    max_ns = std::max(max_ns, ns);
+    last_ns = ns;
+    ++histogram[bucket_index(ns)];
+}
+
+double StageTiming::percentile_us(double q) const {
+    if (count == 0) {
+        return 0.0;
+    }
+    const std::uint64_t rank =
+        std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * count)));
+    std::uint64_t seen = 0;
+    for (int k = 0; k < kBuckets; ++k) {
+        seen += histogram[k];
+        if (seen >= rank) {
+            // bucket 상한, 단 관측된 최대값을 넘지 않게
+            return std::min(bucket_upper_ns(k), static_cast<double>(max_ns)) * 1e-3;
+        }
+    }
+    return max_ns * 1e-3;
+}
+
+void TrackerStats::reset() {
+    stages_ = {};
+    totals_ = TrackerCounters{};
+    frame_ = TrackerCounters{};
+    trace_.clear();
+    epoch_ = Clock::now();
+}
+
+void TrackerStats::enable_trace(std::size_t max_events) {
+    trace_enabled_ = true;
+    trace_max_events_ = max_events;
+    trace_.reserve(std::min<std::size_t>(max_events, 1 << 16));
+}
+
+void TrackerStats::begin_frame() {
+    frame_ = TrackerCounters{};
+    frame_.frames = 1;
+}
+
+void TrackerStats::end_frame(std::size_t n_tracks) {
+    totals_.add(frame_);
+    if (trace_enabled_ && trace_.size() < trace_max_events_) {
+        TraceEvent e;
+        e.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+        e.dur_ns = 0;
+        e.stage = -1;
+        e.tracks = static_cast<std::uint32_t>(n_tracks);
+        e.detections = static_cast<std::uint32_t>(frame_.detections);
+        trace_.push_back(e);
+    }
+}
+
+void TrackerStats::record(TrackerStage s, Clock::time_point begin, Clock::time_point end) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    stages_[static_cast<int>(s)].record(static_cast<std::uint64_t>(std::max<std::int64_t>(ns, 0)));
+
+    if (trace_enabled_ && trace_.size() < trace_max_events_) {
+        TraceEvent e;
+        e.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - epoch_).count();
+        e.dur_ns = ns;
+        e.stage = static_cast<int>(s);
+        e.tracks = 0;
+        e.detections = 0;
+        trace_.push_back(e);
+    }
+}
+
+bool TrackerStats::write_trace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+
+    // trace-event format: ts / dur 단위는 us
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+           "\"args\":{\"name\":\"MultiSensorTracker\"}}";
+    char buf[256];
+    for (const auto& e : trace_) {
+        if (e.stage < 0) {
+            std::snprintf(buf, sizeof(buf),
+                          ",\n{\"name\":\"scene\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":%.3f,"
+                          "\"args\":{\"tracks\":%u,\"detections\":%u}}",
+                          e.ts_ns * 1e-3, e.tracks, e.detections);
+        } else {
+            std::snprintf(buf, sizeof(buf),
+                          ",\n{\"name\":\"%s\",\"cat\":\"tracker\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                          "\"ts\":%.3f,\"dur\":%.3f}",
+                          stage_name(static_cast<TrackerStage>(e.stage)),
+                          e.ts_ns * 1e-3, e.dur_ns * 1e-3);
+        }
+        out << buf;
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+std::string TrackerStats::summary() const {
+    std::ostringstream os;
+    char buf[160];
+    std::snprintf(buf, sizeof(buf), "%-12s %8s %10s %10s %10s %10s\n",
+                  "stage", "count", "mean[us]", "p50[us]", "p99[us]", "max[us]");
+    os << buf;
+    for (int s = 0; s < static_cast<int>(TrackerStage::kCount); ++s) {
+        const auto& t = stages_[s];
+        if (t.count == 0) continue;
+        std::snprintf(buf, sizeof(buf), "%-12s %8llu %10.1f %10.1f %10.1f %10.1f\n",
+                      stage_name(static_cast<TrackerStage>(s)),
+                      static_cast<unsigned long long>(t.count), t.mean_us(),
+                      t.percentile_us(0.5), t.percentile_us(0.99), t.max_ns * 1e-3);
+        os << buf;
+    }
+    const auto& c = totals_;
+    os << "frames=" << c.frames << " detections=" << c.detections
+       << " pairs_evaluated=" << c.pairs_evaluated << " pairs_gated=" << c.pairs_gated
+       << " ekf_updates=" << c.ekf_updates << " factorizations=" << c.factorizations
+       << " born=" << c.tracks_born << " deleted=" << c.tracks_deleted
+       << " late=" << c.late_detections << " fused=" << c.tracks_fused
+       << " absorbed=" << c.dets_absorbed << " jpda_clusters=" << c.jpda_clusters
+       << " jpda_events=" << c.jpda_events << " jpda_truncated=" << c.jpda_truncated
+       << " mht_clusters=" << c.mht_clusters << " mht_hypotheses=" << c.mht_hypotheses
+       << " mht_truncated=" << c.mht_truncated << "\n";
+    return os.str();
+}
+
+} // namespace msf
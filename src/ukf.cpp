@@ -0,0 +1,95 @@
+#include "ukf.hpp"
+
+#include <cmath>
+#include "radar_batch.hpp"
+#include "sensor_models.hpp"
+
+namespace msf {
+
+UkfWeights UkfWeights::make(double alpha, double beta, double kappa) {
+    constexpr double n = kUkfStateDim;
+    const double lambda = alpha * alpha * (n + kappa) - n;
+
+    UkfWeights w;
+    w.gamma = std::sqrt(n + lambda);
+    w.wm0 = lambda / (n + lambda);
+    w.wc0 = w.wm0 + 1.0 - alpha * alpha + beta;
+    w.wi = 0.5 / (n + lambda);
+    return w;
+}
+
+bool generate_sigma_points(const Vec4& x, const Mat4& P, const UkfWeights& w,
+                           double* px, double* py, double* vx, double* vy) {
+    double* out[kUkfStateDim] = {px, py, vx, vy};
+    for (int d = 0; d < kUkfStateDim; ++d) {
+        for (int k = 0; k < kUkfSigmaPoints; ++k) {
+            out[d][k] = x(d);
+        }
+    }
+
+    const Eigen::LLT<Mat4> llt(P);
+    if (llt.info() != Eigen::Success) {
+        return false;
+    }
+    const Mat4 L = w.gamma * Mat4(llt.matrixL());
+    for (int k = 0; k < kUkfStateDim; ++k) {
+        for (int d = 0; d < kUkfStateDim; ++d) {
+            out[d][1 + k] += L(d, k);
+            out[d][1 + kUkfStateDim + k] -= L(d, k);
+        }
+    }
+    return true;
+}
+
+void radar_unscented_moments(const double* px, const double* py,
+                             const double* vx, const double* vy,
+                             const double* rho, const double* phi, const double* rho_dot,
+                             const UkfWeights& w, const Eigen::Matrix3d& R,
+                             PredictedMeasurement<3>& out) {
+    // 각도는 +-pi 경계를 넘을 수 있으므로 Z_0 의 phi 기준 차이로 평균
+    double mean_rho = w.wm0 * rho[0];
+    double mean_dphi = 0.0;
+    double mean_rho_dot = w.wm0 * rho_dot[0];
+    for (int k = 1; k < kUkfSigmaPoints; ++k) {
+        mean_rho += w.wi * rho[k];
+        mean_dphi += w.wi * normalize_angle(phi[k] - phi[0]);
+        mean_rho_dot += w.wi * rho_dot[k];
+    }
+    const double mean_phi = normalize_angle(phi[0] + mean_dphi);
+    out.z_pred << mean_rho, mean_phi, mean_rho_dot;
+
+    Eigen::Matrix3d S = R;
+    Eigen::Matrix<double, 4, 3> Pxz = Eigen::Matrix<double, 4, 3>::Zero();
+    for (int k = 0; k < kUkfSigmaPoints; ++k) {
+        const double wc = k == 0 ? w.wc0 : w.wi;
+        const Eigen::Vector3d dz(rho[k] - mean_rho,
+                                 normalize_angle(phi[k] - mean_phi),
+                                 rho_dot[k] - mean_rho_dot);
+        S.noalias() += (wc * dz) * dz.transpose();
+        // X_0 = x 이므로 k = 0 항은 0
+        if (k > 0) {
+            const Vec4 dx(px[k] - px[0], py[k] - py[0], vx[k] - vx[0], vy[k] - vy[0]);
+            Pxz.noalias() += (wc * dx) * dz.transpose();
+        }
+    }
+
+    out.PHt = Pxz;
+    out.S_ldlt.compute(S);
+    out.valid = out.S_ldlt.info() == Eigen::Success && out.S_ldlt.isPositive();
+}
+
+void radar_unscented_predict(const Vec4& x, const Mat4& P, const UkfWeights& w,
+                             const Eigen::Matrix3d& R, PredictedMeasurement<3>& out) {
+    double px[kUkfSigmaPoints], py[kUkfSigmaPoints];
+    double vx[kUkfSigmaPoints], vy[kUkfSigmaPoints];
+    if (!generate_sigma_points(x, P, w, px, py, vx, vy)) {
+        out.valid = false;
+        return;
+    }
+
+    double rho[kUkfSigmaPoints], phi[kUkfSigmaPoints], rho_dot[kUkfSigmaPoints];
+    radar_measurement_batch(px, py, vx, vy, 0, kUkfSigmaPoints, rho, phi, rho_dot);
+    radar_unscented_moments(px, py, vx, vy, rho, phi, rho_dot, w, R, out);
+}
+
+} // namespace msf
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""Compare two Google Benchmark JSON results and fail on regressions.
+
+Usage:
+    python3 tools/compare_bench.py BASELINE.json CURRENT.json [--threshold 0.15]
+                                   [--metric real_time|cpu_time] [--noise-factor 2.0]
+                                   [--record-missing]
+
+A benchmark regresses when current / baseline - 1 > threshold for the chosen
+metric. Benchmarks present in only one of the files are listed but ignored.
+With repetitions, the median is compared. A slowdown above the threshold
+but within noise_factor x the coefficient of variation (larger of the two
+files) is reported as noisy and does not fail; anything beyond that band
+still fails. Results whose context has msft_build_type (the configuration
+libmsft was built with) outside Release / RelWithDebInfo / MinSizeRel are
+rejected, since they say nothing about optimized timings.
+With --record-missing, a missing baseline is created from CURRENT and the
+comparison passes; baselines are machine-specific.
+Exit code: 0 = no regression, 1 = at least one regression, 2 = bad input.
+"""
+
+import argparse
+import json
+import shutil
+import sys
+from pathlib import Path
+
+# Unit conversion to nanoseconds
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+# libmsft configurations built with optimization
+OPTIMIZED_BUILD_TYPES = {"Release", "RelWithDebInfo", "MinSizeRel"}
+
+
+def load_results(path: Path, metric: str):
+    with path.open() as f:
+        data = json.load(f)
+    build_type = data.get("context", {}).get("msft_build_type")
+    if build_type not in OPTIMIZED_BUILD_TYPES:
+        raise ValueError(f"{path}: libmsft build type {build_type!r} is not optimized "
+                         "(configure with -DCMAKE_BUILD_TYPE=Release)")
+    results = {}
+    spread = {}
+    for b in data.get("benchmarks", []):
+        name = b.get("run_name", b["name"])
+        if b.get("run_type") == "aggregate":
+            # With repetitions, compare the median (robust to outlier runs); keep cv for noise
+            if b.get("aggregate_name") == "cv":
+                spread[name] = float(b[metric])
+            if b.get("aggregate_name") != "median":
+                continue
+        scale = TIME_UNIT_NS.get(b.get("time_unit", "ns"), 1.0)
+        results[name] = float(b[metric]) * scale
+    return results, spread
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", type=Path)
+    parser.add_argument("current", type=Path)
+    parser.add_argument("--threshold", type=float, default=0.15,
+                        help="allowed relative slowdown (default 0.15 = 15%%)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time")
+    parser.add_argument("--noise-factor", type=float, default=2.0,
+                        help="excuse slowdowns up to this many coefficients of variation "
+                             "(default 2.0)")
+    parser.add_argument("--record-missing", action="store_true",
+                        help="create BASELINE from CURRENT when it does not exist")
+    args = parser.parse_args()
+
+    if args.record_missing and not args.baseline.exists():
+        try:
+            load_results(args.current, args.metric)
+            args.baseline.parent.mkdir(parents=True, exist_ok=True)
+            shutil.copyfile(args.current, args.baseline)
+        except (OSError, ValueError, KeyError) as e:
+            print(f"compare_bench: {e}", file=sys.stderr)
+            return 2
+        print(f"No baseline yet: recorded {args.current} as {args.baseline}")
+        return 0
+
+    try:
+        base, base_cv = load_results(args.baseline, args.metric)
+        cur, cur_cv = load_results(args.current, args.metric)
+    except (OSError, ValueError, KeyError) as e:
+        print(f"compare_bench: {e}", file=sys.stderr)
+        return 2
+
+    regressions = []
+    noisy = []
+    width = max((len(n) for n in base.keys() | cur.keys()), default=10)
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'current':>12} {'change':>8}")
+    for name in sorted(base.keys() & cur.keys()):
+        change = cur[name] / base[name] - 1.0 if base[name] > 0 else 0.0
+        cv = max(base_cv.get(name, 0.0), cur_cv.get(name, 0.0))
+        flag = ""
+        if args.threshold < change <= args.noise_factor * cv:
+            noisy.append(name)
+            flag = f"  noisy (cv {cv:.0%})"
+        elif change > args.threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print(f"{name:<{width}} {base[name]:>10.0f}ns {cur[name]:>10.0f}ns {change:>+7.1%}{flag}")
+
+    for name in sorted(base.keys() - cur.keys()):
+        print(f"{name:<{width}} missing in current")
+    for name in sorted(cur.keys() - base.keys()):
+        print(f"{name:<{width}} new (no baseline)")
+
+    if noisy:
+        print(f"\n{len(noisy)} benchmark(s) slower but within "
+              f"{args.noise_factor:g} x cv (too noisy to judge)")
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than "
+              f"{args.threshold:.0%} ({args.metric})")
+        return 1
+    print(f"\nNo regression above {args.threshold:.0%} ({args.metric})")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
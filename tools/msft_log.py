@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""Reader for the chunked binary logs written by run_simulation (*.bin).
+
+The layout matches include/binary_log.hpp. Each chunk is exposed as a
+numpy.memmap, so nothing is copied until the records are actually used.
+"""
+
+from pathlib import Path
+
+import numpy as np
+
+LOG_MAGIC = 0x31474F4C5446534D  # "MSFTLOG1"
+CHUNK_MAGIC = 0x4B4E4843  # "CHNK"
+INDEX_MAGIC = 0x58444E49  # "INDX"
+
+HEADER_DTYPE = np.dtype(
+    [("magic", "<u8"), ("version", "<u4"), ("record_type", "<u4"),
+     ("record_size", "<u4"), ("reserved", "<u4", (3,))]
+)
+CHUNK_HEADER_DTYPE = np.dtype(
+    [("magic", "<u4"), ("count", "<u4"), ("t_min", "<f8"), ("t_max", "<f8"),
+     ("reserved", "<u8")]
+)
+INDEX_DTYPE = np.dtype(
+    [("offset", "<u8"), ("count", "<u4"), ("reserved", "<u4"),
+     ("t_min", "<f8"), ("t_max", "<f8")]
+)
+TRAILER_DTYPE = np.dtype(
+    [("index_offset", "<u8"), ("num_chunks", "<u4"), ("magic", "<u4"),
+     ("total_records", "<u8")]
+)
+
+RECORD_DTYPES = {
+    # Detection
+    1: np.dtype([("timestamp", "<f8"), ("z", "<f8", (3,)), ("confidence", "<f8"),
+                 ("sensor", "<u4"), ("dim", "<u4")]),
+    # Track
+    2: np.dtype([("timestamp", "<f8"), ("track_id", "<i4"), ("confirmed", "<u4"),
+                 ("x", "<f8", (4,)), ("missed", "<i4"), ("age", "<i4")]),
+    # GroundTruth
+    3: np.dtype([("timestamp", "<f8"), ("obj_id", "<i4"), ("reserved", "<i4"),
+                 ("x", "<f8", (4,))]),
+}
+
+
+def _read_index(path: Path, size: int, record_size: int):
+    if size >= HEADER_DTYPE.itemsize + TRAILER_DTYPE.itemsize:
+        trailer = np.fromfile(path, dtype=TRAILER_DTYPE, count=1,
+                              offset=size - TRAILER_DTYPE.itemsize)[0]
+        n = int(trailer["num_chunks"])
+        index_offset = int(trailer["index_offset"])
+        if (int(trailer["magic"]) == INDEX_MAGIC and
+                index_offset + n * INDEX_DTYPE.itemsize + TRAILER_DTYPE.itemsize == size):
+            return np.fromfile(path, dtype=INDEX_DTYPE, count=n, offset=index_offset)
+
+    # No index (writer was interrupted): walk the chunk headers instead
+    entries = []
+    off = HEADER_DTYPE.itemsize
+    while off + CHUNK_HEADER_DTYPE.itemsize <= size:
+        h = np.fromfile(path, dtype=CHUNK_HEADER_DTYPE, count=1, offset=off)[0]
+        end = off + CHUNK_HEADER_DTYPE.itemsize + int(h["count"]) * record_size
+        if int(h["magic"]) != CHUNK_MAGIC or end > size:
+            break
+        entries.append((off, h["count"], 0, h["t_min"], h["t_max"]))
+        off = end
+    return np.array(entries, dtype=INDEX_DTYPE)
+
+
+def open_log(path):
+    """Return (record dtype, list of per-chunk numpy.memmap)."""
+    path = Path(path)
+    size = path.stat().st_size
+    header = np.fromfile(path, dtype=HEADER_DTYPE, count=1)
+    if len(header) != 1 or int(header[0]["magic"]) != LOG_MAGIC:
+        raise ValueError(f"{path} is not a binary tracker log")
+    header = header[0]
+
+    dtype = RECORD_DTYPES.get(int(header["record_type"]))
+    if dtype is None or dtype.itemsize != int(header["record_size"]):
+        raise ValueError(f"{path}: unsupported record type {int(header['record_type'])}")
+
+    chunks = []
+    for e in _read_index(path, size, dtype.itemsize):
+        count = int(e["count"])
+        if count == 0:
+            continue
+        chunks.append(np.memmap(path, dtype=dtype, mode="r", shape=(count,),
+                                offset=int(e["offset"]) + CHUNK_HEADER_DTYPE.itemsize))
+    return dtype, chunks
+
+
+def load_records(path):
+    """All records of a log as one structured array."""
+    dtype, chunks = open_log(path)
+    if not chunks:
+        return np.zeros(0, dtype=dtype)
+    if len(chunks) == 1:
+        return chunks[0]
+    return np.concatenate(chunks)
@@ -5,8 +5,11 @@ import csv
 from pathlib import Path
 
 import matplotlib
+import numpy as np
 import matplotlib.pyplot as plt
 
+from msft_log import load_records
+
 # Automatically adjust layout when the window is resized
 plt.rcParams["figure.constrained_layout.use"] = True
 
@@ -48,18 +51,34 @@ def load_gt(filename: Path):
     return data
 
 
+def load_bin(filename: Path, id_field: str):
+    """Group a binary log (tracks.bin / ground_truth.bin) by id via numpy memmap."""
+    rec = load_records(filename)
+    ids = rec[id_field]
+    data = {}
+    for oid in np.unique(ids):
+        sel = rec[ids == oid]
+        data[int(oid)] = {"t": sel["timestamp"], "x": sel["x"][:, 0], "y": sel["x"][:, 1]}
+    return data
+
+
 def main():
+    gt_bin = OUTPUT_DIR / "ground_truth.bin"
+    tracks_bin = OUTPUT_DIR / "tracks.bin"
     gt_file = OUTPUT_DIR / "ground_truth.csv"
     tracks_file = OUTPUT_DIR / "tracks.csv"
 
-    if not gt_file.exists() or not tracks_file.exists():
-        print(f"Cannot find CSV files in {OUTPUT_DIR}.")
+    if gt_bin.exists() and tracks_bin.exists():
+        gt = load_bin(gt_bin, "obj_id")
+        tracks = load_bin(tracks_bin, "track_id")
+    elif gt_file.exists() and tracks_file.exists():
+        gt = load_gt(gt_file)
+        tracks = load_tracks(tracks_file)
+    else:
+        print(f"Cannot find output files in {OUTPUT_DIR}.")
         print("Run the simulation first (e.g., ./run_all.sh).")
         return
 
-    gt = load_gt(gt_file)
-    tracks = load_tracks(tracks_file)
-
     # Create figure and axes (layout will be auto-adjusted)
     fig, ax = plt.subplots(constrained_layout=True)
 
@@ -6,6 +6,8 @@ from pathlib import Path
 import matplotlib.pyplot as plt
 import matplotlib.image as mpimg
 
+from msft_log import load_records
+
 ROOT_DIR = Path(__file__).resolve().parent.parent
 OUTPUT_DIR = ROOT_DIR / "output"
 
@@ -29,6 +31,17 @@ def load_last_positions(filename: Path, id_field: str):
     return last_time, positions
 
 
+def load_last_positions_bin(filename: Path, id_field: str):
+    """Same as load_last_positions, for a binary log read via numpy memmap."""
+    rec = load_records(filename)
+    if len(rec) == 0:
+        return None, {}
+    last_time = rec["timestamp"].max()
+    last = rec[rec["timestamp"] == last_time]
+    positions = {int(r[id_field]): (float(r["x"][0]), float(r["x"][1])) for r in last}
+    return float(last_time), positions
+
+
 def main():
     if len(sys.argv) < 2:
         print("Usage: python3 tools/visualize_image_with_tracks.py <image_path>")
@@ -42,18 +55,23 @@ def main():
         print(f"Image not found: {img_path}")
         sys.exit(1)
 
+    gt_bin = OUTPUT_DIR / "ground_truth.bin"
+    tracks_bin = OUTPUT_DIR / "tracks.bin"
     gt_file = OUTPUT_DIR / "ground_truth.csv"
     tracks_file = OUTPUT_DIR / "tracks.csv"
 
-    if not gt_file.exists() or not tracks_file.exists():
-        print(f"Missing CSV files in {OUTPUT_DIR}. Run the simulation first (e.g., ./run_all.sh).")
+    if gt_bin.exists() and tracks_bin.exists():
+        gt_time, gt_pos = load_last_positions_bin(gt_bin, "obj_id")
+        tr_time, tr_pos = load_last_positions_bin(tracks_bin, "track_id")
+    elif gt_file.exists() and tracks_file.exists():
+        gt_time, gt_pos = load_last_positions(gt_file, "obj_id")
+        tr_time, tr_pos = load_last_positions(tracks_file, "track_id")
+    else:
+        print(f"Missing output files in {OUTPUT_DIR}. Run the simulation first (e.g., ./run_all.sh).")
         sys.exit(1)
 
-    gt_time, gt_pos = load_last_positions(gt_file, "obj_id")
-    tr_time, tr_pos = load_last_positions(tracks_file, "track_id")
-
     if not gt_pos and not tr_pos:
-        print("No positions found in CSVs.")
+        print("No positions found in output files.")
         sys.exit(1)
 
     # Collect all coordinates for scaling